@@ -10,7 +10,7 @@
 #include "ExhibitionArea.hpp"
 #include "LightingSystem.hpp"
 #include "Robot.hpp"
-#include "Shader.hpp"
+#include "ShaderLibrary.hpp"
 
 
 class Application {
@@ -40,7 +40,7 @@ private:
     std::unique_ptr<ExhibitionArea> exhibitionArea;
     std::unique_ptr<LightingSystem> lightingSystem;
     std::unique_ptr<Robot> robot;
-    std::unique_ptr<Shader> shader;
+    std::unique_ptr<ShaderLibrary> shaderLibrary;
     
    
     void processInput();
@@ -0,0 +1,59 @@
+#ifndef BENCHMARK_HPP
+#define BENCHMARK_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "GLStats.hpp"
+
+class Robot;
+class Camera;
+
+// --benchmark modu: robot ve kamera sabit bir senaryoyla sürülür, sabit deltaTime ile
+// belirli sayıda kare çizilir ve başlangıç aşamaları, kare süresi yüzdelikleri, çizim
+// çağrıları, durum değişiklikleri, üçgenler ve bellek JSON/CSV olarak yazılır.
+class Benchmark {
+public:
+    // Kare süreleri ilk birkaç karede shader çözümü ve önbellek ısınmasıyla dalgalanır;
+    // bu kareler CSV'de kalır ama yüzdeliklere katılmaz
+    static const int WARMUP_FRAMES = 30;
+
+    Benchmark();
+
+    // Önceki aşamayı bitirip yenisini başlatır
+    void beginPhase(const std::string& name);
+    void endPhases();
+
+    // Senaryodaki frame. adımı uygular; InputManager::processInput yerine çağrılır
+    void driveRobot(int frame, float deltaTime, Robot* robot, Camera* camera);
+
+    // Ana döngüden çağrılır
+    void recordFrame(double milliseconds);
+
+    // GL bağlamının bulunduğu thread'den çağrılır
+    void recordRenderStats(const GLStats::Counters& counters);
+
+    // JSON özetini ve aynı adla .csv uzantılı kare tablosunu yazar
+    bool writeReport(const std::string& jsonPath);
+
+    static size_t getResidentMemoryBytes();
+    static size_t getPeakMemoryBytes();
+
+private:
+    struct Phase {
+        std::string name;
+        double milliseconds;
+    };
+
+    std::vector<Phase> phases;
+    std::chrono::steady_clock::time_point phaseStart;
+    bool phaseOpen;
+    size_t startupResidentBytes;
+
+    std::vector<double> frameMilliseconds;
+    std::vector<GLStats::Counters> renderStats;
+};
+
+#endif
@@ -0,0 +1,109 @@
+#ifndef COLLISION_WORLD_HPP
+#define COLLISION_WORLD_HPP
+
+#include <glm/glm.hpp>
+#include <cstddef>
+#include <vector>
+
+class Statue;
+
+// Statik çarpışma dünyası: sergi eserleri ve duvarlar. Her parça kendi üçgenlerini ve bu
+// üçgenlerin BVH'sini (vekil) taşır; parçaların kutuları da üst seviye bir BVH'dedir (geniş faz).
+// Hareket eden ajanlar küre olarak süpürülür: hareket boyunca ilk temas bulunur, oraya kadar
+// ilerlenir ve kalan hareket temas yüzeyi boyunca kaydırılır.
+// build() sonrası sorgular salt okunurdur; birden çok iş parçacığından aynı anda çağrılabilir.
+class CollisionWorld {
+public:
+    struct Hit {
+        float time;        // hareketin [0, 1] aralığındaki kesri
+        glm::vec3 normal;  // temas noktasından kürenin merkezine doğru
+        int piece;
+    };
+
+    CollisionWorld();
+
+    // Parça ekleme; build() çağrılana kadar sorgulara yansımaz. Dönen değer parça numarası, boşsa -1.
+    // Heykelin vekili mesh'lerinin dünya uzayındaki üçgenlerinden üretilir.
+    int addStatue(const Statue& statue);
+    int addTriangles(const std::vector<glm::vec3>& points);
+    int addBox(const glm::vec3& minCorner, const glm::vec3& maxCorner);
+
+    // Parçaların ve geniş fazın BVH'lerini kurar
+    void build();
+    void clear();
+
+    // center'dan center + motion'a süpürülen kürenin ilk teması; başlangıçta iç içe geçmiş
+    // ve yüzeye doğru ilerliyorsa temas zamanı 0'dır
+    bool sweepSphere(const glm::vec3& center, const glm::vec3& motion, float radius, Hit& hit) const;
+
+    // Çarp ve kay: kürenin motion boyunca ulaşabildiği konum
+    glm::vec3 moveSphere(const glm::vec3& center, const glm::vec3& motion, float radius) const;
+
+    // Çok sayıda ajan; JobSystem'e parça parça dağıtılır
+    void moveSpheres(glm::vec3* centers, const glm::vec3* motions, size_t count, float radius) const;
+
+    bool overlapsSphere(const glm::vec3& center, float radius) const;
+
+    size_t getPieceCount() const { return pieces.size(); }
+    size_t getTriangleCount() const { return triangles.size(); }
+
+    // --collision-benchmark: geniş fazı kaba kuvvetle doğrular, yüzlerce ajanın adım süresini yazdırır.
+    // Süpürme kaba kuvvetten farklıysa, bir ajan engele girerse ya da paralel sonuç seri sonuçtan ayrılırsa false döner
+    static bool runBenchmarks();
+
+    static const int MAX_SLIDES = 4;
+    static const int LEAF_SIZE = 4;
+
+private:
+    struct Bounds {
+        glm::vec3 min;
+        glm::vec3 max;
+    };
+
+    // İç düğümde first sol çocuk (sağ çocuk first + 1), yaprakta ilk öğe; count 0 ise iç düğüm
+    struct Node {
+        Bounds bounds;
+        int first;
+        int count;
+    };
+
+    struct Triangle {
+        glm::vec3 a;
+        glm::vec3 b;
+        glm::vec3 c;
+        glm::vec3 normal;
+    };
+
+    struct Piece {
+        Bounds bounds;
+        int firstTriangle;
+        int triangleCount;
+        int root;  // meshNodes içinde
+    };
+
+    std::vector<Triangle> triangles;  // parça parça ardışık
+    std::vector<Piece> pieces;
+    std::vector<Node> meshNodes;
+    std::vector<Node> pieceNodes;     // geniş faz
+    std::vector<int> pieceOrder;      // geniş faz yapraklarındaki parçalar
+    bool built;
+
+    void buildNode(std::vector<Node>& nodes, int nodeIndex, std::vector<int>& items,
+                   const std::vector<Bounds>& itemBounds, int first, int count);
+    void buildPiece(Piece& piece);
+
+    bool sweepPiece(const Piece& piece, const glm::vec3& center, const glm::vec3& motion, float radius,
+                    Bounds& swept, Hit& hit) const;
+    static bool sweepTriangle(const Triangle& triangle, const glm::vec3& center, const glm::vec3& motion,
+                              float radius, Hit& hit);
+
+    // Kürenin hareketin [0, time] kısmında taradığı kutu
+    static Bounds sweptBounds(const glm::vec3& center, const glm::vec3& motion, float radius, float time);
+    static bool overlaps(const Bounds& a, const Bounds& b) {
+        return a.min.x <= b.max.x && a.max.x >= b.min.x && a.min.y <= b.max.y && a.max.y >= b.min.y &&
+               a.min.z <= b.max.z && a.max.z >= b.min.z;
+    }
+    static glm::vec3 closestPoint(const Triangle& triangle, const glm::vec3& point);
+};
+
+#endif
@@ -0,0 +1,41 @@
+#ifndef COMPONENTS_HPP
+#define COMPONENTS_HPP
+
+#include <glm/glm.hpp>
+#include <cstdint>
+
+// EntityWorld bileşenleri. Sadece sık okunan sıcak veri tutulur; başlık, açıklama,
+// model yolu ve GL tutamaçları gibi soğuk veriler sahibi olan sınıfta kalır.
+
+struct Position {
+    glm::vec3 value;
+};
+
+// Derece cinsinden (TransformSystem ile aynı)
+struct Rotation {
+    glm::vec3 value;
+};
+
+struct Velocity {
+    glm::vec3 value;
+};
+
+// Yakınlık ve çarpışma sorguları için sınırlayıcı küre
+struct Bounds {
+    float radius;
+};
+
+// Heykelin StatueManager listesindeki sırası
+struct StatueRef {
+    int index;
+};
+
+// Ziyaretçi: hedef heykele yürür, bir süre bakar ve rastgele yeni heykel seçer
+struct Visitor {
+    int targetStatue;
+    float dwell;     // kalan bakma süresi; yürürken 0
+    float speed;
+    uint32_t seed;
+};
+
+#endif
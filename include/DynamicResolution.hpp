@@ -0,0 +1,75 @@
+#ifndef DYNAMIC_RESOLUTION_HPP
+#define DYNAMIC_RESOLUTION_HPP
+
+#include <glad/glad.h>
+#include "ShaderLibrary.hpp"
+
+// Sahneyi pencereden küçük olabilen bir offscreen hedefe çizer ve sonucu keskinleştirerek
+// pencereye büyütür. Çözünürlük ölçeği, sahne geçişinin ölçülen GPU süresine göre
+// hedef kare süresini tutturacak şekilde otomatik ayarlanır.
+class DynamicResolution {
+public:
+    DynamicResolution();
+    ~DynamicResolution();
+
+    // Keskinleştirme shader'ı kütüphanede derlenmeye başlar, ilk present()'te sonuçlanır
+    bool initialize(int windowWidth, int windowHeight, ShaderLibrary& shaderLibrary);
+
+    void cleanup();
+
+    // Offscreen hedefi bağlar ve viewport'u ölçekli boyuta ayarlar. Pencere boyutu
+    // değiştiyse hedef yeniden oluşturulur.
+    void beginScene(int windowWidth, int windowHeight);
+
+    // Sahne zaman ölçümünü bitirir ve çıkış framebuffer'ına döner
+    void endScene();
+
+    // present() ve arayüzün çizileceği framebuffer; varsayılan 0 (pencere)
+    void setOutputFramebuffer(GLuint framebuffer) { outputFramebuffer = framebuffer; }
+
+    // Sahneyi pencereye büyütüp keskinleştirerek çizer
+    void present();
+
+    void setEnabled(bool enabled);
+    bool isEnabled() const { return enabled; }
+
+    void setTargetFrameTime(float milliseconds) { targetMilliseconds = milliseconds; }
+
+    float getScale() const { return scale; }
+    float getSceneMilliseconds() const { return sceneMilliseconds; }
+    int getSceneWidth() const { return sceneWidth; }
+    int getSceneHeight() const { return sceneHeight; }
+
+    static const float MIN_SCALE;
+
+private:
+    GLuint framebuffer;
+    GLuint colorTexture;
+    GLuint depthRenderbuffer;
+    GLuint emptyVAO;
+    ShaderHandle sharpenShader;
+    GLuint outputFramebuffer;
+
+    // Zaman damgası sorguları; sonuç iki kare sonra okunur
+    GLuint timestampQueries[2][2];
+    bool queryIssued[2];
+    int queryIndex;
+
+    int targetWidth, targetHeight;  // ayrılan doku boyutu (pencere boyutu)
+    int sceneWidth, sceneHeight;    // bu karede kullanılan kısım
+    int windowWidth, windowHeight;
+
+    bool enabled;
+    float scale;
+    float targetMilliseconds;
+    float sceneMilliseconds;
+    int framesSinceAdjust;
+
+    bool createTarget(int width, int height);
+    void destroyTarget();
+    void createSharpenShader(ShaderLibrary& shaderLibrary);
+    void collectTiming();
+    void adjustScale();
+};
+
+#endif
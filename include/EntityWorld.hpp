@@ -0,0 +1,255 @@
+#ifndef ENTITY_WORLD_HPP
+#define ENTITY_WORLD_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+#include "JobSystem.hpp"
+
+// Varlık: kayıt tablosundaki yeri ve o yerin kaçıncı kez kullanıldığı.
+// Silinen varlığın eski tutamacı nesil farkından dolayı geçersiz sayılır.
+struct Entity {
+    uint32_t index;
+    uint32_t generation;
+
+    Entity() : index(UINT32_MAX), generation(0) {}
+    Entity(uint32_t index, uint32_t generation) : index(index), generation(generation) {}
+
+    bool isValid() const { return index != UINT32_MAX; }
+    bool operator==(const Entity& other) const { return index == other.index && generation == other.generation; }
+    bool operator!=(const Entity& other) const { return !(*this == other); }
+};
+
+typedef int ComponentId;
+typedef uint32_t ComponentMask;
+
+// Arketip tabanlı varlık-bileşen deposu. Aynı bileşen kümesine sahip varlıklar bir
+// arketipte toplanır; arketip verisi 16 KB'lık parçalarda (chunk) her bileşen için ayrı
+// dizi olarak (SoA) durur. Sorgular sadece eşleşen arketiplerin parçalarını sırayla
+// gezer, işaretçi takibi yoktur. Parçalar iş sistemine dağıtılabilir.
+// Bileşenler memcpy ile taşınabilen düz yapılar olmalıdır; metin gibi soğuk veriler
+// sahibi olan sınıfta kalır, bileşen sadece onun sırasını tutar.
+// Sorgu sürerken varlık eklemek, silmek veya bileşen değiştirmek yasaktır.
+class EntityWorld {
+public:
+    static const int MAX_COMPONENTS = 32;
+    static const size_t CHUNK_SIZE = 16 * 1024;
+
+    EntityWorld();
+    ~EntityWorld();
+
+    // Bileşen türünün numarası; ilk kullanımda kaydedilir
+    template <typename T>
+    static ComponentId componentId();
+
+    template <typename... Ts>
+    static ComponentMask maskOf();
+
+    // Verilen bileşenlerle yeni varlık
+    template <typename... Ts>
+    Entity create(const Ts&... components);
+
+    void destroy(Entity entity);
+    bool isAlive(Entity entity) const;
+    void clear();
+
+    // Bileşen eklemek/çıkarmak varlığı başka arketipe taşır
+    template <typename T>
+    void add(Entity entity, const T& component);
+
+    template <typename T>
+    void remove(Entity entity);
+
+    template <typename T>
+    bool has(Entity entity) const;
+
+    // Varlıkta bileşen yoksa nullptr; işaretçi bir sonraki yapısal değişikliğe kadar geçerlidir
+    template <typename T>
+    T* get(Entity entity);
+
+    // function(Entity, Ts&...) her eşleşen varlık için
+    template <typename... Ts, typename Function>
+    void each(Function&& function);
+
+    // function(size_t count, const Entity*, Ts*...) her eşleşen parça için; diziler
+    // doğrudan SimdKernels gibi toplu işlere verilebilir
+    template <typename... Ts, typename Function>
+    void eachChunk(Function&& function);
+
+    // eachChunk'ın iş sistemine dağıtılmış hali; function farklı thread'lerden aynı
+    // anda çağrılır ama her parça tek bir çağrıya düşer
+    template <typename... Ts, typename Function>
+    void parallelEachChunk(const Function& function);
+
+    size_t getEntityCount() const { return entityCount; }
+    size_t getArchetypeCount() const { return archetypes.size(); }
+    size_t getChunkCount() const;
+
+    // Maskeye uyan varlık sayısı
+    size_t count(ComponentMask mask) const;
+
+private:
+    struct ComponentInfo {
+        size_t size;
+        size_t alignment;
+    };
+
+    struct Chunk {
+        unsigned char* data;
+        uint32_t count;
+    };
+
+    struct Archetype {
+        ComponentMask mask;
+        uint32_t capacity;
+        size_t offsets[MAX_COMPONENTS];  // parça içindeki dizi başlangıcı; yoksa 0
+        std::vector<Chunk> chunks;
+    };
+
+    // Varlığın nerede durduğu
+    struct Record {
+        Archetype* archetype;
+        uint32_t chunk;
+        uint32_t row;
+        uint32_t generation;
+    };
+
+    // (arketip, parça) çifti; paralel sorguda iş bölümü bunun üzerinden yapılır
+    struct ChunkRef {
+        Archetype* archetype;
+        uint32_t chunk;
+    };
+
+    std::vector<Archetype*> archetypes;
+    std::vector<Record> records;
+    std::vector<uint32_t> freeIndices;
+    size_t entityCount;
+    std::vector<ChunkRef> queryChunks;
+
+    static std::vector<ComponentInfo>& componentInfos();
+    static ComponentId registerComponent(size_t size, size_t alignment);
+
+    Archetype* findArchetype(ComponentMask mask);
+    Entity allocateEntity(Archetype* archetype);
+
+    // Satır ayırır; parçalar hep dolu tutulur, sadece son parçada boşluk olur
+    void allocateRow(Archetype* archetype, uint32_t& chunk, uint32_t& row);
+
+    // Son satırı boşalan yere taşır ve yer değiştiren varlığın kaydını günceller
+    void releaseRow(Archetype* archetype, uint32_t chunk, uint32_t row);
+
+    void moveEntity(Entity entity, ComponentMask newMask);
+
+    Entity* entitiesOf(const Chunk& chunk) const { return reinterpret_cast<Entity*>(chunk.data); }
+    void* componentAt(const Archetype* archetype, const Chunk& chunk, ComponentId id, uint32_t row) const;
+    const Record* recordOf(Entity entity) const;
+
+    void collectChunks(ComponentMask mask);
+
+    template <typename T>
+    static T* arrayOf(const Archetype* archetype, const Chunk& chunk) {
+        return reinterpret_cast<T*>(chunk.data + archetype->offsets[componentId<T>()]);
+    }
+
+    EntityWorld(const EntityWorld&) = delete;
+    EntityWorld& operator=(const EntityWorld&) = delete;
+};
+
+template <typename T>
+ComponentId EntityWorld::componentId() {
+    static_assert(std::is_trivially_copyable<T>::value, "Bileşenler memcpy ile taşınabilmeli");
+    static_assert(alignof(T) <= 16, "Bileşen hizalaması en fazla 16 olabilir");
+    static const ComponentId id = registerComponent(sizeof(T), alignof(T));
+    return id;
+}
+
+template <typename... Ts>
+ComponentMask EntityWorld::maskOf() {
+    ComponentMask mask = 0;
+    int expand[] = { 0, (mask |= 1u << componentId<Ts>(), 0)... };
+    (void)expand;
+    return mask;
+}
+
+template <typename... Ts>
+Entity EntityWorld::create(const Ts&... components) {
+    Archetype* archetype = findArchetype(maskOf<Ts...>());
+    Entity entity = allocateEntity(archetype);
+    int expand[] = { 0, (*get<Ts>(entity) = components, 0)... };
+    (void)expand;
+    return entity;
+}
+
+template <typename T>
+void EntityWorld::add(Entity entity, const T& component) {
+    const Record* record = recordOf(entity);
+    if (!record) return;
+    ComponentMask bit = 1u << componentId<T>();
+    if (!(record->archetype->mask & bit)) {
+        moveEntity(entity, record->archetype->mask | bit);
+    }
+    *get<T>(entity) = component;
+}
+
+template <typename T>
+void EntityWorld::remove(Entity entity) {
+    const Record* record = recordOf(entity);
+    if (!record) return;
+    ComponentMask bit = 1u << componentId<T>();
+    if (record->archetype->mask & bit) {
+        moveEntity(entity, record->archetype->mask & ~bit);
+    }
+}
+
+template <typename T>
+bool EntityWorld::has(Entity entity) const {
+    const Record* record = recordOf(entity);
+    return record && (record->archetype->mask & (1u << componentId<T>())) != 0;
+}
+
+template <typename T>
+T* EntityWorld::get(Entity entity) {
+    const Record* record = recordOf(entity);
+    ComponentId id = componentId<T>();
+    if (!record || !(record->archetype->mask & (1u << id))) return nullptr;
+    const Chunk& chunk = record->archetype->chunks[record->chunk];
+    return static_cast<T*>(componentAt(record->archetype, chunk, id, record->row));
+}
+
+template <typename... Ts, typename Function>
+void EntityWorld::each(Function&& function) {
+    eachChunk<Ts...>([&function](size_t count, const Entity* entities, Ts*... arrays) {
+        for (size_t i = 0; i < count; i++) {
+            function(entities[i], arrays[i]...);
+        }
+    });
+}
+
+template <typename... Ts, typename Function>
+void EntityWorld::eachChunk(Function&& function) {
+    ComponentMask mask = maskOf<Ts...>();
+    for (Archetype* archetype : archetypes) {
+        if ((archetype->mask & mask) != mask) continue;
+        for (const Chunk& chunk : archetype->chunks) {
+            if (chunk.count == 0) continue;
+            function(static_cast<size_t>(chunk.count), entitiesOf(chunk), arrayOf<Ts>(archetype, chunk)...);
+        }
+    }
+}
+
+template <typename... Ts, typename Function>
+void EntityWorld::parallelEachChunk(const Function& function) {
+    collectChunks(maskOf<Ts...>());
+    const std::vector<ChunkRef>& chunks = queryChunks;
+    JobSystem::instance().parallelFor(0, chunks.size(), 1, [this, &chunks, &function](size_t first, size_t last) {
+        for (size_t i = first; i < last; i++) {
+            const Archetype* archetype = chunks[i].archetype;
+            const Chunk& chunk = archetype->chunks[chunks[i].chunk];
+            function(static_cast<size_t>(chunk.count), entitiesOf(chunk), arrayOf<Ts>(archetype, chunk)...);
+        }
+    });
+}
+
+#endif
@@ -8,6 +8,7 @@
 #include <memory>
 
 #include "Statue.hpp"
+#include "SpatialHash.hpp"
 
 
 class ExhibitionArea {
@@ -19,7 +20,8 @@ public:
     ~ExhibitionArea();
     
     
-    bool initialize();
+    // Shader derlemesi kütüphanede başlar, modeller yüklenirken sürer
+    bool initialize(ShaderLibrary& shaderLibrary);
     
     
     void render(const glm::mat4& viewMatrix, const glm::mat4& projectionMatrix);
@@ -34,15 +36,19 @@ public:
                      const glm::vec3& rotation);
     
     const std::vector<std::unique_ptr<Statue>>& getStatues() const;
+    
+    // Heykel konumları; tutamaç getStatues() içindeki sıradır
+    const SpatialHash& getStatueIndex() const { return statueIndex; }
 
 private:
     
     std::vector<std::unique_ptr<Statue>> statues;
+    SpatialHash statueIndex;
   
-    GLuint shaderProgram;
+    ShaderHandle shader;
     
     
-    void createShaders();
+    void createShaders(ShaderLibrary& shaderLibrary);
    
     void placeObjects();
     
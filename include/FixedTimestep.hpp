@@ -0,0 +1,42 @@
+#ifndef FIXED_TIMESTEP_HPP
+#define FIXED_TIMESTEP_HPP
+
+#include <cstdint>
+
+// Simülasyonu kare hızından bağımsız, sabit aralıklı adımlarla ilerletir.
+// Her karede geçen gerçek süre biriktirilir ve biriken süre kadar adım çalıştırılır;
+// artan kısım iki adım arasındaki interpolasyon oranı olarak çizime verilir.
+class FixedTimestep {
+public:
+    FixedTimestep(double tickRate = 60.0, int maxSteps = 5);
+
+    // Hz cinsinden; geçersiz değerlerde varsayılan kullanılır
+    void setTickRate(double tickRate);
+
+    // Bir karede çalıştırılabilecek en fazla adım; aşan süre atılır ki yavaş
+    // kareler simülasyonu giderek daha da geride bırakmasın
+    void setMaxSteps(int steps) { maxSteps = steps > 0 ? steps : 1; }
+
+    // Geçen süreyi ekler ve bu karede çalıştırılacak adım sayısını döner
+    int advance(double frameSeconds);
+
+    double getStep() const { return step; }
+    double getTickRate() const { return 1.0 / step; }
+
+    // Son adımdan bu yana geçen sürenin adım süresine oranı, [0, 1)
+    float getAlpha() const { return static_cast<float>(accumulator / step); }
+
+    uint64_t getTickCount() const { return tickCount; }
+
+    // Yetişemeyip atılan toplam simülasyon süresi
+    double getDroppedSeconds() const { return droppedSeconds; }
+
+private:
+    double step;
+    double accumulator;
+    int maxSteps;
+    uint64_t tickCount;
+    double droppedSeconds;
+};
+
+#endif
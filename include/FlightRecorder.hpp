@@ -0,0 +1,100 @@
+#ifndef FLIGHT_RECORDER_HPP
+#define FLIGHT_RECORDER_HPP
+
+#include <glm/glm.hpp>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "GLStats.hpp"
+#include "Profiler.hpp"
+
+// Son birkaç saniyenin kare sürelerini, profiler bölgelerini, çizim sayaçlarını ve
+// girdileri halka tamponda tutar. Bir kare eşiği aşarsa o pencere arka planda Chrome
+// trace JSON olarak diske yazılır; yazımlar arasında bekleme süresi ve toplam sınır vardır.
+// İlk saniyelerdeki kareler (ertelenmiş shader derlemesi, kaynak yükleme) takılma sayılmaz.
+class FlightRecorder {
+public:
+    // Ana thread'in kare sonunda bildirdiği değerler
+    struct FrameSample {
+        double milliseconds;
+        float deltaTime;
+        glm::vec3 robotPosition;
+        int activeStatue;
+        bool scanning;
+        const char* heldKeys;
+        int inputEvents;
+    };
+
+    FlightRecorder();
+    ~FlightRecorder();
+
+    bool initialize(const std::string& directory, double thresholdMilliseconds);
+    void shutdown();
+
+    // Döngünün başında, Profiler::beginFrame()'den sonra çağrılır; önceki karenin
+    // bölgelerini kaydına ekler ve eşik aşıldıysa yazımı başlatır
+    void beginFrame();
+    void endFrame(const FrameSample& sample);
+
+    // GL bağlamının bulunduğu thread'den, kare çizildikten sonra çağrılır
+    void recordRenderStats(const GLStats::Counters& counters);
+
+private:
+    static const int CAPACITY = 512;
+    static const int MAX_ZONES = 64;
+    static const int MAX_DUMPS = 20;
+    static const double WINDOW_SECONDS;
+    static const double DUMP_COOLDOWN_SECONDS;
+    static const double WARMUP_SECONDS;
+
+    struct FrameRecord {
+        uint64_t frameIndex;
+        uint64_t start;
+        double milliseconds;
+        float deltaTime;
+        glm::vec3 robotPosition;
+        int activeStatue;
+        bool scanning;
+        char heldKeys[12];
+        int inputEvents;
+        uint64_t drawCalls;
+        uint64_t stateChanges;
+        uint64_t triangles;
+        int zoneCount;
+        Profiler::Event zones[MAX_ZONES];
+    };
+
+    std::vector<FrameRecord> frames;
+    uint64_t frameCount;
+    uint64_t frameStart;
+    uint64_t firstFrameStart;
+    bool recordPending;
+
+    std::atomic<uint64_t> drawCalls;
+    std::atomic<uint64_t> stateChanges;
+    std::atomic<uint64_t> triangles;
+
+    std::string directory;
+    double thresholdMilliseconds;
+    uint64_t lastDumpTime;
+    int dumpCount;
+
+    // Yazıcı thread; bir seferde tek yazım, meşgulken gelen takılmalar atlanır
+    std::thread writer;
+    std::mutex writerMutex;
+    std::condition_variable writerWake;
+    std::vector<FrameRecord> pendingFrames;
+    uint64_t pendingHitchFrame;
+    bool dumpPending;
+    bool stopping;
+
+    void requestDump(const FrameRecord& hitch);
+    void writerLoop();
+    bool writeDump(const std::vector<FrameRecord>& window, uint64_t hitchFrame);
+};
+
+#endif
@@ -0,0 +1,37 @@
+#ifndef FRAME_CAPTURE_HPP
+#define FRAME_CAPTURE_HPP
+
+#include <glad/glad.h>
+#include <string>
+#include <vector>
+
+// Başsız modda son görüntünün çizildiği framebuffer. Pencere görünmediği için varsayılan
+// framebuffer'ın içeriği tanımsızdır; sahne ve arayüz buraya çizilir ve istenirse PNG
+// olarak diske yazılır.
+class FrameCapture {
+public:
+    FrameCapture();
+    ~FrameCapture();
+
+    bool initialize(int width, int height);
+
+    void cleanup();
+
+    GLuint getFramebuffer() const { return framebuffer; }
+    int getWidth() const { return width; }
+    int getHeight() const { return height; }
+
+    // Framebuffer'ı okuyup PNG olarak kaydeder
+    bool capture(const std::string& path);
+
+    // Sıkıştırmasız (stored deflate) RGBA PNG yazar; ilk satır görüntünün üstüdür
+    static bool writePNG(const std::string& path, int width, int height, const unsigned char* rgba);
+
+private:
+    GLuint framebuffer;
+    GLuint colorRenderbuffer;
+    int width, height;
+    std::vector<unsigned char> pixels;
+};
+
+#endif
@@ -0,0 +1,92 @@
+#ifndef FRAME_PACER_HPP
+#define FRAME_PACER_HPP
+
+#include <atomic>
+#include <mutex>
+
+// Kare temposunu ve girişten ekrana gecikmeyi yönetir.
+//  - MODE_UNLIMITED: bekleme yok
+//  - MODE_LIMIT: kareler hedef hızın periyoduna göre sabit aralıklarla başlar
+//  - MODE_JUST_IN_TIME: input, beklenen sunum anından ölçülen kare işi kadar önce
+//    örneklenir; bekleme input'tan önce yapıldığı için gecikme en aza iner
+// Vsync ayarı GL thread'inde applySwapInterval() ile uygulanır.
+class FramePacer {
+public:
+    enum Mode {
+        MODE_UNLIMITED = 0,
+        MODE_LIMIT = 1,
+        MODE_JUST_IN_TIME = 2
+    };
+
+    enum Vsync {
+        VSYNC_OFF = 0,
+        VSYNC_ON = 1,
+        VSYNC_ADAPTIVE = 2   // geç kalan kare beklemeden sunulur (EXT_swap_control_tear)
+    };
+
+    FramePacer();
+
+    void setMode(Mode mode) { this->mode = mode; }
+    Mode getMode() const { return mode; }
+
+    // Hz; 0 ekran yenileme hızını kullanır
+    void setTargetRate(double rate) { targetRate = rate > 0.0 ? rate : 0.0; }
+    void setRefreshRate(double rate) { refreshRate = rate > 0.0 ? rate : 60.0; }
+
+    void setVsync(Vsync vsync) { requestedVsync = vsync; }
+    Vsync getVsync() const { return requestedVsync; }
+
+    // Ana thread'de, olaylar okunmadan hemen önce çağrılır; gerekirse uyur. Input zamanı
+    // olaylar okunduktan sonra now() ile alınır ve frameSubmitted()/framePresented()'a verilir.
+    void waitForFrame();
+
+    // GL bağlamının bulunduğu thread'de, swap'tan önce; vsync değiştiyse swap aralığını kurar
+    void applySwapInterval();
+
+    // GL bağlamının bulunduğu thread'de, glfwSwapBuffers'tan hemen önce. Input'tan buraya kadar
+    // geçen süre kare işidir; swap içindeki vsync beklemesi işe sayılmaz.
+    void frameSubmitted(double inputTime);
+
+    // GL bağlamının bulunduğu thread'de, glfwSwapBuffers döndükten sonra
+    void framePresented(double inputTime);
+
+    // ImGui penceresi; ana thread'de newFrame() ile endFrame() arasında çağrılır
+    void renderPanel();
+    void togglePanel() { panelVisible = !panelVisible; }
+
+    static double now();
+
+private:
+    static const int HISTORY = 120;
+
+    Mode mode;
+    double targetRate;
+    double refreshRate;
+    bool panelVisible;
+
+    std::atomic<Vsync> requestedVsync;
+    Vsync appliedVsync;
+    bool appliedOnce;
+
+    double nextDeadline;   // MODE_LIMIT: bir sonraki karenin başlama zamanı
+
+    // framePresented() render thread'den de çağrılabilir
+    mutable std::mutex statsMutex;
+    float presentIntervals[HISTORY];  // ms, ardışık iki sunum arası
+    float workTimes[HISTORY];         // ms, input örneklemeden swap çağrısına kadar
+    float latencies[HISTORY];         // ms, input örneklemeden sunuma kadar
+    double submittedWork;             // son frameSubmitted() ölçümü, saniye
+    int historyCount;
+    int historyIndex;
+    double lastPresent;
+
+    // Sadece ana thread
+    float wakeErrors[HISTORY];        // ms, hedeflenen uyanma zamanından gecikme
+    int wakeCount;
+    int wakeIndex;
+
+    double periodSeconds() const;
+    double estimateWork() const;
+};
+
+#endif
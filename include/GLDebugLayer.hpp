@@ -0,0 +1,31 @@
+#ifndef GL_DEBUG_LAYER_HPP
+#define GL_DEBUG_LAYER_HPP
+
+#include <glad/glad.h>
+#include <cstdint>
+
+// --gl-debug ile açılan teşhis katmanı. GLStats gibi glad'in fonksiyon işaretçilerini
+// sarmalayıcılarla değiştirir ve her fonksiyonun kare başına sürücüye giden çağrılarını sayar.
+// Gereksiz çağrılar kendi gölge durumuyla değil, GLStateCache'in atlama sayaçlarından alınır.
+// KHR_debug performans uyarılarını da toplar. Çağrıların davranışı değişmez.
+class GLDebugLayer {
+public:
+    // gladLoadGLLoader ve GLExtensions::load'dan sonra, GL thread'inde bir kez çağrılır
+    static void install();
+
+    static bool isInstalled() { return installed; }
+
+    // GL thread'inde, bir karenin çizimi bittiğinde çağrılır
+    static void endFrame();
+
+    // ImGui penceresi; ana thread'de newFrame() ile endFrame() arasında çağrılır
+    static void renderPanel();
+
+    // Çalışma boyunca kare başına ortalamaları konsola yazar
+    static void logReport();
+
+private:
+    static bool installed;
+};
+
+#endif
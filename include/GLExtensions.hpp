@@ -0,0 +1,79 @@
+#ifndef GL_EXTENSIONS_HPP
+#define GL_EXTENSIONS_HPP
+
+#include <glad/glad.h>
+#include <string>
+
+// glad sadece GL 3.3 çekirdeğiyle üretildiği için ihtiyaç duyduğumuz
+// eklenti fonksiyonlarını burada kendimiz yüklüyoruz.
+
+#ifndef GL_PROGRAM_BINARY_RETRIEVABLE_HINT
+#define GL_PROGRAM_BINARY_RETRIEVABLE_HINT 0x8257
+#endif
+#ifndef GL_PROGRAM_BINARY_LENGTH
+#define GL_PROGRAM_BINARY_LENGTH 0x8741
+#endif
+#ifndef GL_NUM_PROGRAM_BINARY_FORMATS
+#define GL_NUM_PROGRAM_BINARY_FORMATS 0x87FE
+#endif
+
+#ifndef GL_COMPLETION_STATUS_KHR
+#define GL_COMPLETION_STATUS_KHR 0x91B1
+#endif
+
+// GL_KHR_debug ve GL_ARB_debug_output aynı enum değerlerini kullanır
+#ifndef GL_DEBUG_OUTPUT
+#define GL_DEBUG_OUTPUT 0x92E0
+#endif
+#ifndef GL_DEBUG_OUTPUT_SYNCHRONOUS
+#define GL_DEBUG_OUTPUT_SYNCHRONOUS 0x8242
+#endif
+#ifndef GL_DEBUG_TYPE_ERROR
+#define GL_DEBUG_TYPE_ERROR 0x824C
+#define GL_DEBUG_TYPE_DEPRECATED_BEHAVIOR 0x824D
+#define GL_DEBUG_TYPE_UNDEFINED_BEHAVIOR 0x824E
+#define GL_DEBUG_TYPE_PORTABILITY 0x824F
+#define GL_DEBUG_TYPE_PERFORMANCE 0x8250
+#define GL_DEBUG_TYPE_OTHER 0x8251
+#endif
+#ifndef GL_DEBUG_SEVERITY_HIGH
+#define GL_DEBUG_SEVERITY_HIGH 0x9146
+#define GL_DEBUG_SEVERITY_MEDIUM 0x9147
+#define GL_DEBUG_SEVERITY_LOW 0x9148
+#define GL_DEBUG_SEVERITY_NOTIFICATION 0x826B
+#endif
+
+typedef void (APIENTRYP PFNVMGETPROGRAMBINARYPROC)(GLuint program, GLsizei bufSize, GLsizei* length, GLenum* binaryFormat, void* binary);
+typedef void (APIENTRYP PFNVMPROGRAMBINARYPROC)(GLuint program, GLenum binaryFormat, const void* binary, GLsizei length);
+typedef void (APIENTRYP PFNVMPROGRAMPARAMETERIPROC)(GLuint program, GLenum pname, GLint value);
+typedef void (APIENTRYP PFNVMMAXSHADERCOMPILERTHREADSPROC)(GLuint count);
+typedef void (APIENTRYP PFNVMDEBUGMESSAGECALLBACKPROC)(GLDEBUGPROC callback, const void* userParam);
+typedef void (APIENTRYP PFNVMDEBUGMESSAGECONTROLPROC)(GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint* ids, GLboolean enabled);
+
+class GLExtensions {
+public:
+    // Eklenti listesini okur ve fonksiyon adreslerini yükler. gladLoadGLLoader'dan sonra çağrılmalı.
+    static void load(GLADloadproc loader);
+
+    static bool has(const char* extension);
+
+    // GL_ARB_get_program_binary
+    static bool programBinary;
+    static PFNVMGETPROGRAMBINARYPROC GetProgramBinary;
+    static PFNVMPROGRAMBINARYPROC ProgramBinary;
+    static PFNVMPROGRAMPARAMETERIPROC ProgramParameteri;
+
+    // GL_KHR_parallel_shader_compile / GL_ARB_parallel_shader_compile
+    static bool parallelShaderCompile;
+    static PFNVMMAXSHADERCOMPILERTHREADSPROC MaxShaderCompilerThreads;
+
+    // GL_KHR_debug / GL_ARB_debug_output; mesaj gelmesi için bağlam debug olarak açılmalı
+    static bool debugOutput;
+    static PFNVMDEBUGMESSAGECALLBACKPROC DebugMessageCallback;
+    static PFNVMDEBUGMESSAGECONTROLPROC DebugMessageControl;
+
+private:
+    static std::string extensionList;
+};
+
+#endif
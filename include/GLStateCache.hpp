@@ -0,0 +1,75 @@
+#ifndef GL_STATE_CACHE_HPP
+#define GL_STATE_CACHE_HPP
+
+#include <glad/glad.h>
+#include <cstdint>
+
+// GL durumunun gölge kopyası. Aktif program, VAO, tampon bağlamaları, aktif doku birimi,
+// birim başına doku bağlamaları, derinlik/cull/blend durumu ve program başına uniform
+// değerleri tutulur; mevcut durumu değiştirmeyen çağrılar sürücüye hiç gönderilmez.
+// Fonksiyonlar GL karşılıklarıyla aynı imzayı taşır. Durumu değiştiren tüm kod bu sınıftan
+// geçmelidir; geçmeyen kod (ImGui backend'i gibi) sonrasında invalidate() çağırmalıdır.
+// Sadece GL bağlamının o an aktif olduğu thread'den kullanılır.
+class GLStateCache {
+public:
+    // Önbelleğin sürücüye göndermeden atlayabildiği çağrılar
+    enum Call {
+        CALL_USE_PROGRAM, CALL_BIND_VERTEX_ARRAY, CALL_BIND_BUFFER, CALL_ACTIVE_TEXTURE, CALL_BIND_TEXTURE,
+        CALL_ENABLE, CALL_DISABLE, CALL_DEPTH_FUNC, CALL_DEPTH_MASK, CALL_CULL_FACE, CALL_BLEND_FUNC,
+        CALL_COLOR_MASK, CALL_UNIFORM_1I, CALL_UNIFORM_1F, CALL_UNIFORM_2F, CALL_UNIFORM_3F, CALL_UNIFORM_2FV,
+        CALL_UNIFORM_3FV, CALL_UNIFORM_4FV, CALL_UNIFORM_MATRIX_3FV, CALL_UNIFORM_MATRIX_4FV,
+        CALL_COUNT
+    };
+
+    static void useProgram(GLuint program);
+    static void bindVertexArray(GLuint array);
+    static void bindBuffer(GLenum target, GLuint buffer);
+    static void activeTexture(GLenum texture);
+    static void bindTexture(GLenum target, GLuint texture);
+
+    static void enable(GLenum capability);
+    static void disable(GLenum capability);
+    static void depthFunc(GLenum function);
+    static void depthMask(GLboolean flag);
+    static void cullFace(GLenum mode);
+    static void blendFunc(GLenum source, GLenum destination);
+    static void colorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha);
+
+    // Aktif programın uniform'ları
+    static void uniform1i(GLint location, GLint v0);
+    static void uniform1f(GLint location, GLfloat v0);
+    static void uniform2f(GLint location, GLfloat v0, GLfloat v1);
+    static void uniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2);
+    static void uniform2fv(GLint location, GLsizei count, const GLfloat* value);
+    static void uniform3fv(GLint location, GLsizei count, const GLfloat* value);
+    static void uniform4fv(GLint location, GLsizei count, const GLfloat* value);
+    static void uniformMatrix3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat* value);
+    static void uniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat* value);
+
+    // Nesne numaraları yeniden kullanıldığı için silme ve bağlama da önbellekten geçer
+    static void linkProgram(GLuint program);
+    static void deleteProgram(GLuint program);
+    static void deleteVertexArrays(GLsizei count, const GLuint* arrays);
+    static void deleteBuffers(GLsizei count, const GLuint* buffers);
+    static void deleteTextures(GLsizei count, const GLuint* textures);
+
+    // Tüm gölge durumu "bilinmiyor" yapar; sonraki ilk çağrılar sürücüye gider
+    static void invalidate();
+
+    // Doğrulama açıkken validate() gölge durumu glGet ile okunan gerçek durumla karşılaştırır,
+    // farkları konsola yazar ve önbelleği sıfırlar
+    static void setValidation(bool enabled) { validation = enabled; }
+    static bool validate(const char* where);
+
+    // Durumu değiştirmediği için atlanan çağrıların sayısı (-1 konumuna uniform yazımı dahil).
+    // GLDebugLayer bunları gereksiz çağrı olarak gösterir; karşılık gelen GL fonksiyonunun adı
+    // getCallName() ile alınır. takeSkipCounts() sayaçları kopyalayıp sıfırlar.
+    static const char* getCallName(Call call);
+    static void takeSkipCounts(uint64_t counts[CALL_COUNT]);
+
+private:
+    static bool validation;
+    static uint64_t skipCounts[CALL_COUNT];
+};
+
+#endif
@@ -0,0 +1,33 @@
+#ifndef GL_STATS_HPP
+#define GL_STATS_HPP
+
+#include <glad/glad.h>
+#include <cstdint>
+
+// glad'in çizim ve durum fonksiyon işaretçilerini sayan sarmalayıcılarla değiştirir.
+// Böylece Statue, Room, Renderer gibi tüm çağrı noktaları değiştirilmeden kare başına
+// çizim çağrısı, üçgen ve durum değişikliği sayılabilir. ImGui kendi yükleyicisini
+// kullandığı için arayüz çağrıları sayılmaz.
+class GLStats {
+public:
+    struct Counters {
+        uint64_t drawCalls;
+        uint64_t triangles;
+        uint64_t stateChanges;
+    };
+
+    // gladLoadGLLoader'dan sonra bir kez çağrılır; sayaçlar sadece kurulduktan sonra artar
+    static void install();
+
+    static bool isInstalled() { return installed; }
+
+    static void reset();
+
+    // Sayaçlar GL bağlamının bulunduğu thread'de artar ve okunmalıdır
+    static const Counters& get();
+
+private:
+    static bool installed;
+};
+
+#endif
@@ -6,34 +6,120 @@
 #include "Robot.hpp"
 #include "Camera.hpp"
 #include "StatueManager.hpp"
+#include "InputQueue.hpp"
+#include <fstream>
+#include <string>
+#include <vector>
 
+class Renderer;
+class FramePacer;
+
+// Callback'ler olayı sadece zaman damgasıyla kuyruğa yazar; olaylar simülasyon adımı
+// başında, o adımın zamanına kadar sırayla tüketilir. Bir kareden kısa basışlar da
+// kaçmaz. Tuşlar eylemlere bağlanır ve olaylar adım numarasıyla kaydedilip aynen
+// tekrar oynatılabilir.
 class InputManager {
 public:
+    enum Action {
+        ACTION_NONE = -1,
+        ACTION_MOVE_FORWARD = 0,
+        ACTION_MOVE_BACKWARD,
+        ACTION_MOVE_LEFT,
+        ACTION_MOVE_RIGHT,
+        ACTION_MOVE_UP,
+        ACTION_MOVE_DOWN,
+        ACTION_ROTATE_LEFT,
+        ACTION_ROTATE_RIGHT,
+        ACTION_SCAN,
+        ACTION_CLOSE_PANEL,
+        ACTION_TOGGLE_PREPASS,
+        ACTION_TOGGLE_PROFILER,
+        ACTION_TOGGLE_PACER,
+        ACTION_TOGGLE_AUTOPILOT,
+        ACTION_BACK,
+        ACTION_COUNT
+    };
+
     InputManager(GLFWwindow* window, Robot* robot, Camera* camera, StatueManager* statueManager);
     
     ~InputManager();
     
     void setupCallbacks();
     
-    void processInput(float deltaTime);
+    // Bir simülasyon adımı; zamanı tickTime'a kadar olan olayları işler
+    void processTick(float deltaTime, double tickTime);
     
+    // Callback'ler; olayı kuyruğa ekler
     void processKeyPress(int key, int scancode, int action, int mods);
     
     void processMouseMovement(double xpos, double ypos);
     
     void processMouseScroll(double xoffset, double yoffset);
     
+    // Renderer input manager'dan sonra oluşturulduğu için ayrıca bağlanır
+    void setRenderer(Renderer* renderer) { this->renderer = renderer; }
+    void setFramePacer(FramePacer* framePacer) { this->framePacer = framePacer; }
+    
+    // Ölçümde robotu senaryo sürer; tuşlar yine de çalışır
+    void setMovementEnabled(bool enabled) { movementEnabled = enabled; }
+    
+    // Tuşu eyleme bağlar; ACTION_NONE bağlantıyı kaldırır
+    void bindKey(int key, Action action);
+    
+    // Tüketilen olayları adım numarasıyla dosyaya yazar
+    bool startRecording(const std::string& path);
+    
+    // Kayıttaki olayları aynı adımlarda uygular; canlı klavye olayları yok sayılır
+    bool startReplay(const std::string& path);
+    bool isReplaying() const { return replaying; }
+    
+    // Bu karede basılı tutulan hareket tuşları, örn. "WQ" (kayıt için)
+    const char* getHeldKeys() const { return heldKeys; }
+    
+    // Son çağrıdan beri gelen klavye/scroll olayı sayısı
+    int takeEventCount() {
+        int count = eventCount;
+        eventCount = 0;
+        return count;
+    }
+    
 private:
     GLFWwindow* window;
     Robot* robot;
     Camera* camera;
     StatueManager* statueManager;
+    Renderer* renderer;
+    FramePacer* framePacer;
     
     float screenWidth;
     float screenHeight;
     
     float robotSpeed;
     float rotationSpeed;
+    
+    char heldKeys[12];
+    int eventCount;
+    
+    InputQueue queue;
+    int keyActions[GLFW_KEY_LAST + 1];
+    bool keyDown[GLFW_KEY_LAST + 1];
+    bool actionHeld[ACTION_COUNT];
+    bool actionPressed[ACTION_COUNT];  // bu adımda basıldı (bırakılmış olsa da)
+    bool movementEnabled;
+    
+    uint64_t tickIndex;
+    std::ofstream recordFile;
+    struct RecordedEvent {
+        uint64_t tick;
+        InputEvent event;
+    };
+    std::vector<RecordedEvent> replayEvents;
+    size_t replayPosition;
+    bool replaying;
+    
+    void handleEvent(const InputEvent& event);
+    void triggerAction(Action action);
+    bool isActive(Action action) const { return actionHeld[action] || actionPressed[action]; }
 };
 
 void key_callback_wrapper(GLFWwindow* window, int key, int scancode, int action, int mods);
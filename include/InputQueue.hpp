@@ -0,0 +1,46 @@
+#ifndef INPUT_QUEUE_HPP
+#define INPUT_QUEUE_HPP
+
+#include <atomic>
+#include <cstdint>
+
+// GLFW'den gelen tek bir olay; zaman FramePacer::now() saatindendir
+struct InputEvent {
+    enum Type {
+        TYPE_KEY = 0,
+        TYPE_SCROLL = 1
+    };
+
+    double time;
+    int type;
+    int key;
+    int action;
+    int mods;
+    float x;
+    float y;
+};
+
+// Tek üretici (GLFW callback'leri), tek tüketici (simülasyon adımı) halka kuyruk.
+// Kilit kullanmaz; doluysa yeni olay düşürülür ve sayılır.
+class InputQueue {
+public:
+    static const uint32_t CAPACITY = 256;
+
+    InputQueue();
+
+    bool push(const InputEvent& event);
+
+    // Sıradaki olayın zamanı limit'ten büyük değilse onu çıkarıp true döner.
+    // Adım sınırına kadar olan olaylar böylece sırayla tüketilir.
+    bool popUntil(double limit, InputEvent& event);
+
+    uint32_t getDroppedCount() const { return dropped.load(std::memory_order_relaxed); }
+
+private:
+    InputEvent events[CAPACITY];
+    std::atomic<uint32_t> writeIndex;
+    std::atomic<uint32_t> readIndex;
+    std::atomic<uint32_t> dropped;
+};
+
+#endif
@@ -0,0 +1,172 @@
+#ifndef JOB_SYSTEM_HPP
+#define JOB_SYSTEM_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+class JobSystem;
+
+// Tek bir iş. Fonksiyon nesnesi işin içine gömülür, böylece iş oluşturmak bellek ayırmaz.
+// İşler çağıran thread'in havuzundan alınır; bitince onları bekleyen sayaç azaltılır.
+struct alignas(64) Job {
+    typedef void (*Function)(Job* job);
+
+    static const size_t PAYLOAD_SIZE = 64 - 3 * sizeof(void*) - 8;
+
+    alignas(16) unsigned char payload[PAYLOAD_SIZE];
+    Function function;
+    std::atomic<int>* counter;
+    Job* continuation;
+
+    // Oluşturulunca 1, iş bitince 0; havuz yuvası ancak 0 iken yeniden verilir
+    std::atomic<int> unfinished;
+    bool heapAllocated;  // havuz yuvası doluyken ayrılan iş; bitince silinir
+};
+
+static_assert(sizeof(Job) == 64, "Job bir önbellek satırına sığmalı");
+
+// Chase-Lev iş çalma kuyruğu. Sahibi alttan ekler/çıkarır, diğer thread'ler üstten çalar.
+class WorkStealingQueue {
+public:
+    static const int64_t CAPACITY = 4096;
+
+    WorkStealingQueue();
+
+    // Kuyruk doluysa false döner; çağıran işi kendisi çalıştırır
+    bool push(Job* job);
+    Job* pop();
+    Job* steal();
+
+    bool isEmpty() const;
+
+private:
+    std::atomic<Job*> jobs[CAPACITY];
+    std::atomic<int64_t> top;
+    std::atomic<int64_t> bottom;
+};
+
+// Donanım thread sayısı kadar çalışanı olan iş çalma tabanlı iş sistemi. Ana thread de
+// çalışan 0 olarak sayılır ve wait() içinde iş yürütür. İş sadece ana thread'den veya
+// çalışanlardan kuyruğa eklenebilir; diğer thread'lerden gelen işler hemen çalıştırılır.
+class JobSystem {
+public:
+    typedef std::atomic<int> Counter;
+
+    static JobSystem& instance();
+
+    // workerCount 0 ise hardware_concurrency kullanılır (ana thread dahil)
+    bool initialize(unsigned int workerCount = 0);
+    void shutdown();
+
+    bool isInitialized() const { return !queues.empty(); }
+    unsigned int getWorkerCount() const { return static_cast<unsigned int>(queues.size()); }
+
+    // Çağıran thread'in çalışan numarası; iş sistemine ait değilse -1
+    static int getThreadIndex();
+
+    // Fonksiyon nesnesini çağıran thread'in iş havuzundaki bir işe kopyalar.
+    // Havuz halkasaldır; sıradaki yuvanın işi henüz bitmediyse iş heap'ten ayrılır.
+    template <typename Function>
+    Job* createJob(Function&& function);
+
+    // job bitince continuation kuyruğa eklenir; run() öncesinde çağrılmalıdır.
+    // Zincirdeki işler de run()'a verilen sayaca dahil edilir.
+    void setContinuation(Job* job, Job* continuation) { job->continuation = continuation; }
+
+    // counter verilirse iş bitene kadar sıfırdan büyük kalır
+    void run(Job* job, Counter* counter = nullptr);
+
+    // Sayaç sıfırlanana kadar bekler; beklerken kuyruktaki işleri yürütür
+    void wait(Counter& counter);
+
+    // [begin, end) aralığını grain boyutunda parçalara bölüp function(first, last) çağırır.
+    // grain 0 ise her çalışana birkaç parça düşecek şekilde seçilir. Bitene kadar bekler.
+    template <typename Function>
+    void parallelFor(size_t begin, size_t end, size_t grain, const Function& function);
+
+    // --job-benchmark: zamanlama maliyetini ve çalışan sayısına göre ölçeklenmeyi yazdırır.
+    // Bir iş kaybolur, iki kez çalışır ya da parallelFor sonucu seri hesaptan farklıysa false döner
+    static bool runBenchmarks();
+
+    static const size_t JOB_POOL_SIZE = 4096;
+
+private:
+    JobSystem();
+    ~JobSystem();
+
+    std::vector<WorkStealingQueue*> queues;
+    std::vector<std::thread> workers;
+    std::atomic<bool> running;
+
+    // Boştaki çalışanlar uyur; yeni iş gelince sadece uyuyan varsa uyandırılır
+    std::mutex sleepMutex;
+    std::condition_variable wakeCondition;
+    std::atomic<int> sleepingWorkers;
+    std::atomic<int> queuedJobs;
+
+    Job* allocateJob();
+    void enqueue(Job* job);
+    Job* findJob(int threadIndex);
+    void execute(Job* job);
+    void finish(Job* job);
+    void workerLoop(int threadIndex);
+};
+
+template <typename Function>
+Job* JobSystem::createJob(Function&& function) {
+    typedef typename std::decay<Function>::type Stored;
+    static_assert(sizeof(Stored) <= Job::PAYLOAD_SIZE, "İş verisi Job::PAYLOAD_SIZE'a sığmıyor");
+    static_assert(alignof(Stored) <= 16, "İş verisinin hizalaması desteklenmiyor");
+
+    Job* job = allocateJob();
+    job->counter = nullptr;
+    job->continuation = nullptr;
+    new (job->payload) Stored(std::forward<Function>(function));
+    job->function = [](Job* self) {
+        Stored* stored = reinterpret_cast<Stored*>(self->payload);
+        (*stored)();
+        stored->~Stored();
+    };
+    return job;
+}
+
+template <typename Function>
+void JobSystem::parallelFor(size_t begin, size_t end, size_t grain, const Function& function) {
+    if (begin >= end) return;
+
+    size_t count = end - begin;
+    if (grain == 0) {
+        size_t chunks = static_cast<size_t>(getWorkerCount()) * 4;
+        grain = chunks > 0 ? (count + chunks - 1) / chunks : count;
+    }
+
+    // Parça sayısı iş havuzunu taşırmasın; yoksa işler heap'ten ayrılmaya başlar
+    const size_t maxChunks = JOB_POOL_SIZE / 4;
+    if ((count + grain - 1) / grain > maxChunks) {
+        grain = (count + maxChunks - 1) / maxChunks;
+    }
+
+    // Tek parça ya da iş sistemi kapalıysa doğrudan çalıştır
+    if (count <= grain || !isInitialized()) {
+        function(begin, end);
+        return;
+    }
+
+    Counter counter(0);
+    const Function* target = &function;
+    for (size_t first = begin; first < end; first += grain) {
+        size_t last = first + grain < end ? first + grain : end;
+        run(createJob([target, first, last]() { (*target)(first, last); }), &counter);
+    }
+    wait(counter);
+}
+
+#endif
@@ -4,6 +4,13 @@
 #include <glad/glad.h>
 #include <glm/glm.hpp>
 #include <vector>
+#include <cstdint>
+#include "ShadowAtlas.hpp"
+#include "ShaderLibrary.hpp"
+
+class Statue;
+class Robot;
+class RobotFleet;
 
 
 class LightingSystem {
@@ -15,7 +22,8 @@ public:
     ~LightingSystem();
     
    
-    bool initialize();
+    // Işık küplerinin shader'ı kütüphanede derlenmeye başlar, ilk çizimde sonuçlanır
+    bool initialize(ShaderLibrary& shaderLibrary);
     
     void apply(const glm::mat4& viewMatrix, 
               const glm::mat4& projectionMatrix, 
@@ -38,6 +46,26 @@ public:
     int addDirectionalLight(const glm::vec3& direction, 
                            const glm::vec3& color, 
                            float intensity);
+    
+    // Gölge atlasını kurar. Yönlü ışıkların ortografik izdüşümü verilen küreyi kapsar.
+    bool initializeShadows(const glm::vec3& sceneCenter, float sceneRadius);
+    
+    // Statik katmanı sadece ışık ya da heykel değiştiyse, dinamik katmanı sadece
+    // robot veya rehber filosu hareket ettiyse yeniden çizer
+    void updateShadows(const std::vector<Statue*>& staticCasters, Robot* dynamicCaster, ShaderLibrary& shaderLibrary,
+                       const RobotFleet* fleet = nullptr);
+    
+    // SHADOWS varyantının ihtiyaç duyduğu doku ve ışık uniform'larını yükler
+    void applyShadows(GLuint program) const;
+    
+    bool hasShadows() const { return shadowAtlas.isInitialized(); }
+    
+    // Statik katmandaki tüm karoların bir sonraki güncellemede yeniden çizilmesini ister
+    void invalidateShadows();
+    
+    int getStaticShadowRenderCount() const { return staticShadowRenders; }
+    
+    static const int SHADOW_TEXTURE_UNIT = 5;
 
 private:
     
@@ -69,10 +97,31 @@ private:
     
    
     GLuint lightVAO, lightVBO;
-    GLuint shaderProgram;
+    ShaderHandle lightShader;
+    
+    // Atlasta bir karo kullanan spot ya da yönlü ışık
+    struct ShadowedLight {
+        bool spot;
+        int lightIndex;
+        glm::mat4 lightSpaceMatrix;
+        bool staticDirty;
+    };
+    
+    ShadowAtlas shadowAtlas;
+    std::vector<ShadowedLight> shadowedLights;
+    bool shadowLightsChanged;
+    glm::vec3 shadowCenter;
+    float shadowRadius;
+    uint64_t staticCasterVersion;
+    uint64_t dynamicCasterVersion;
+    bool dynamicLayerEmpty;
+    int staticShadowRenders;
+    
+    void rebuildShadowedLights();
+    glm::mat4 computeLightSpaceMatrix(const ShadowedLight& light) const;
     
    
-    void createShaders();
+    void createShaders(ShaderLibrary& shaderLibrary);
     
     
     void renderLightSources(const glm::mat4& viewMatrix, 
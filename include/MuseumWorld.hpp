@@ -0,0 +1,89 @@
+#ifndef MUSEUM_WORLD_HPP
+#define MUSEUM_WORLD_HPP
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <vector>
+#include "EntityWorld.hpp"
+#include "Components.hpp"
+#include "RobotFleet.hpp"
+
+class Statue;
+class RobotMesh;
+
+// Müzedeki heykel ve ziyaretçi varlıklarını EntityWorld'de tutar ve üzerlerinde çalışan
+// sistemleri içerir. Heykelin sıcak verisi (konum, dönüş, sınır) sadece varlıktadır;
+// yakınlık, rehber turları, yol haritası ve ziyaretçiler heykel konumlarını buradan sorgular.
+// Statue soğuk veriyi (metin, mesh, doku) ve çizim transformunu tutar.
+// Ziyaretçiler sadece burada yaşar: hareket sistemi ve çizim için örnek matrisleri
+// aynı parça sorgularıyla okunur.
+class MuseumWorld {
+public:
+    MuseumWorld();
+    ~MuseumWorld();
+
+    // Her heykel için bir varlık oluşturur. roomHalfSize odanın yarı boyutları; ziyaretçiler
+    // zeminde, duvarların içinde kalır. mesh verilirse ziyaretçiler robot gövdesiyle, küçültülmüş olarak çizilir
+    bool initialize(const std::vector<Statue*>& statues, const RobotMesh* mesh, const glm::vec3& roomHalfSize);
+
+    void cleanup();
+
+    // Heykel varlıkları StatueManager sırasıyla; index o listedeki sıradır
+    size_t getStatueCount() const { return statueEntities.size(); }
+    glm::vec3 getStatuePosition(int index);
+
+    // Parça sorgusuyla heykel konumları (ve istenirse sınır yarıçapları), StatueRef sırasıyla
+    void collectStatues(std::vector<glm::vec3>& positions, std::vector<float>* radii = nullptr);
+
+    // Ziyaretçiler giriş bölgesinde doğar ve her biri rastgele bir heykele yürür
+    void spawnVisitors(int count);
+
+    // Ziyaretçi hareketi ve bakma süreleri; parçalar iş sistemine dağıtılır
+    void updateVisitors(float deltaTime);
+
+    // Son güncellemede bir heykele bakmakta olan ziyaretçi sayısı
+    int getViewingCount() const { return viewingCount; }
+    size_t getVisitorCount() const;
+
+    // Ziyaretçilerin gövde matrislerini pakete yazar (kollar boş kalır); versiyon her adımda artar
+    void captureVisitors(FleetInstances& instances);
+
+    // GL thread'inde; RobotFleet::upload ve render ile aynı düzen, program INSTANCED varyantı olmalı
+    void uploadVisitors(const FleetInstances& instances);
+    void renderVisitors(const glm::mat4& viewMatrix, const glm::mat4& projectionMatrix, GLuint shaderProgram) const;
+    size_t getUploadedVisitorCount() const { return uploadedCount; }
+
+    EntityWorld& getWorld() { return world; }
+
+    // --ecs-benchmark: nesne dizisi ile parça tabanlı SoA depolamanın gezinme hızını karşılaştırır.
+    // İki düzenin sonuçları farklıysa false döner
+    static bool runBenchmarks();
+
+private:
+    EntityWorld world;
+
+    std::vector<Entity> statueEntities;
+
+    // Ziyaretçi sistemi için her adımın başında heykel varlıklarından doldurulur; işler salt okur
+    std::vector<glm::vec3> exhibits;
+    std::vector<float> exhibitRadii;
+    glm::vec3 minBounds;
+    glm::vec3 maxBounds;
+    float floorHeight;
+    int viewingCount;
+    uint64_t visitorVersion;
+
+    // captureVisitors çıktısı; sadece simülasyon thread'i dokunur
+    std::vector<glm::mat4> visitorMatrices;
+
+    // GL tarafı; sadece GL thread'i dokunur
+    const RobotMesh* mesh;
+    GLuint instanceBuffer;
+    GLuint vao;
+    size_t uploadedCount;
+    size_t bufferCapacity;
+    uint64_t uploadedVersion;
+};
+
+#endif
@@ -0,0 +1,128 @@
+#ifndef NAV_GRID_HPP
+#define NAV_GRID_HPP
+
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+// Bir odanın XZ düzlemindeki yürünebilirlik ızgarası. Engeller (daire, kutu ya da heykel
+// mesh'inin üçgenleri) hücrelere işlenir, sonra ajan yarıçapı kadar şişirilir; böylece
+// robot merkezi nokta gibi planlanabilir. Yol 8 komşulu ızgarada JPS ile bulunur (köşe
+// kesilmez), ardından görüş hattı ile gereksiz ara noktalar atılır (string pulling).
+// Bulunan yollar başlangıç/hedef hücre çiftine göre önbellekte tutulur.
+// Noktalar glm::vec2(x, z) olarak verilir.
+class NavGrid {
+public:
+    enum Search {
+        SEARCH_JPS = 0,
+        SEARCH_ASTAR = 1
+    };
+
+    NavGrid();
+
+    // minCorner/maxCorner odanın iç duvarları; duvarlar da ajan yarıçapı kadar şişirilir
+    bool initialize(const glm::vec2& minCorner, const glm::vec2& maxCorner, float cellSize, float agentRadius);
+
+    // Engel ekleme; build() çağrılana kadar yol aramaya yansımaz
+    void addCircle(const glm::vec2& center, float radius);
+    void addBox(const glm::vec2& minCorner, const glm::vec2& maxCorner);
+    void addTriangle(const glm::vec2& a, const glm::vec2& b, const glm::vec2& c);
+
+    // Engelleri şişirip yürünebilir hücreleri hesaplar; yol önbelleği temizlenir
+    void build();
+
+    bool contains(const glm::vec2& point) const;
+    bool isWalkable(const glm::vec2& point) const;
+
+    // En yakın yürünebilir hücrenin merkezi; hiç yoksa false. region >= 0 ise sadece o bölgedeki hücreler.
+    bool nearestWalkable(const glm::vec2& point, glm::vec2& result, int region = -1) const;
+
+    // Birbirine yürünerek ulaşılabilen hücre kümesi (engellerle kapanmış cepler ayrı bölgedir); yoksa -1
+    int regionOf(const glm::vec2& point) const;
+    int getMainRegion() const { return mainRegion; }
+
+    // İlk nokta start, son nokta goal. Hedef engelin içindeyse en yakın yürünebilir noktada biter.
+    bool findPath(const glm::vec2& start, const glm::vec2& goal, std::vector<glm::vec2>& path,
+                  Search search = SEARCH_JPS);
+
+    // Önbelleğe bakmadan ızgara üzerindeki en kısa yolun uzunluğu (yoksa -1); doğrulama ve ölçüm için
+    float searchCost(const glm::vec2& start, const glm::vec2& goal, Search search);
+
+    // source'tan tüm hücrelere ızgara üzerindeki yürüme mesafesi (ulaşılamazsa -1); kapılar arası
+    // ve kapıdan hedefe mesafeler bu alanlardan okunur
+    void computeDistanceField(const glm::vec2& source, std::vector<float>& field);
+
+    // Nokta engeldeyse en yakın yürünebilir hücrenin değeri
+    float sampleField(const std::vector<float>& field, const glm::vec2& point) const;
+
+    // Doğru parçası sadece yürünebilir hücrelerden geçiyor mu
+    bool hasLineOfSight(const glm::vec2& from, const glm::vec2& to) const;
+
+    static float pathLength(const std::vector<glm::vec2>& path);
+
+    void clearCache() { pathCache.clear(); }
+    uint64_t getCacheHits() const { return cacheHits; }
+    uint64_t getCacheMisses() const { return cacheMisses; }
+
+    int getWidth() const { return width; }
+    int getHeight() const { return height; }
+    float getCellSize() const { return cellSize; }
+    size_t getWalkableCount() const;
+
+    static const size_t MAX_CACHED_PATHS = 4096;
+
+private:
+    glm::vec2 origin;
+    glm::vec2 extent;
+    float cellSize;
+    float agentRadius;
+    int width;
+    int height;
+
+    std::vector<uint8_t> blocked;   // engellerin kendisi
+    std::vector<uint8_t> walkable;  // şişirme sonrası
+    std::vector<int> regions;       // yürünebilir hücrelerin bağlı bölgesi, engelde -1
+    int mainRegion;                 // en büyük bölge
+
+    // Arama durumu hücre başına; her arama yeni bir damga kullanır, diziler sıfırlanmaz
+    std::vector<float> costs;
+    std::vector<int> parents;
+    std::vector<uint32_t> openStamps;
+    std::vector<uint32_t> closedStamps;
+    uint32_t searchStamp;
+    struct OpenNode {
+        float priority;
+        int cell;
+        bool operator>(const OpenNode& other) const { return priority > other.priority; }
+    };
+    std::vector<OpenNode> openList;
+    std::vector<int> cellPath;
+
+    // Hücre çiftine göre ara noktalar (başlangıç ve hedef hariç)
+    std::unordered_map<uint64_t, std::vector<glm::vec2>> pathCache;
+    uint64_t cacheHits;
+    uint64_t cacheMisses;
+
+    int cellIndex(int x, int z) const { return z * width + x; }
+    bool cellWalkable(int x, int z) const {
+        return x >= 0 && z >= 0 && x < width && z < height && walkable[cellIndex(x, z)] != 0;
+    }
+    glm::ivec2 cellOf(const glm::vec2& point) const;
+    glm::vec2 cellCenter(int cell) const;
+    void markBlocked(int x, int z);
+    void labelRegions();
+    int snappedCell(const glm::vec2& point) const;
+
+    // Yürünebilir başlangıç ve hedef hücresi arasında arar; cellPath'e hedeften başa doğru yazar
+    float search(int startCell, int goalCell, Search search);
+    void expandJumpPoints(int cell, int goalCell);
+    void expandNeighbors(int cell, int goalCell);
+    bool jump(int x, int z, int dx, int dz, int goalCell, int& result) const;
+    void pushOpen(int cell, int parent, float cost, int goalCell);
+
+    // Ara hücre noktalarından görüş hattı olanları atlar
+    void smoothPath(std::vector<glm::vec2>& points) const;
+};
+
+#endif
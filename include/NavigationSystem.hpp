@@ -0,0 +1,81 @@
+#ifndef NAVIGATION_SYSTEM_HPP
+#define NAVIGATION_SYSTEM_HPP
+
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "NavGrid.hpp"
+
+class Statue;
+
+// Müze yol haritası: her oda kendi NavGrid'ine sahiptir, odalar kapılarla (portal) bağlanır.
+// Aynı odadaki iki nokta arası doğrudan ızgarada planlanır. Farklı odalar için önce kapı
+// uçlarından oluşan küçük grafikte en kısa kapı dizisi bulunur; her kapı ucunun odasındaki
+// mesafe alanı build() sırasında hesaplandığı için bu adım ızgara araması yapmaz. Sonra
+// sadece ilk ve son oda parçası aranır, kapıdan kapıya parçalar ızgaranın önbelleğinden gelir.
+class NavigationSystem {
+public:
+    NavigationSystem();
+    ~NavigationSystem();
+
+    // minCorner.y zemin, maxCorner.y ajanın boyu; bu aralığın dışındaki üçgenler engel sayılmaz
+    int addRoom(const glm::vec3& minCorner, const glm::vec3& maxCorner, float cellSize, float agentRadius);
+
+    // Heykel mesh'inin üçgenleri (dünya uzayında) içine düştükleri odalara işlenir
+    void addStatue(const Statue& statue);
+    void addObstacle(const glm::vec3& center, float radius);
+    void addTriangles(const std::vector<glm::vec3>& triangles);
+
+    // Kapı: iki odada birer uç; uçlar arasındaki geçiş düz çizgidir (kapı boşluğu)
+    int addPortal(int roomA, const glm::vec3& pointA, int roomB, const glm::vec3& pointB);
+
+    // Izgaraları şişirir ve kapı uçları arasındaki mesafeleri hesaplar
+    void build();
+
+    // Noktayı içeren oda; yoksa -1
+    int findRoom(const glm::vec3& point) const;
+
+    // İlk nokta start, son nokta hedefe en yakın yürünebilir nokta; y start'ınkidir
+    bool findPath(const glm::vec3& start, const glm::vec3& goal, std::vector<glm::vec3>& path);
+
+    size_t getRoomCount() const { return rooms.size(); }
+    NavGrid& getGrid(int room) { return rooms[room]->grid; }
+    uint64_t getQueryCount() const { return queryCount; }
+    uint64_t getCacheHits() const;
+
+    // --nav-benchmark: JPS'yi A* ile doğrular, büyük bir müzede sorgu sürelerini yazdırır.
+    // JPS A*'dan farklıysa, yol engele giriyorsa ya da eserler arası bir yol bulunamazsa false döner
+    static bool runBenchmarks();
+
+private:
+    struct Room {
+        NavGrid grid;
+        glm::vec3 minCorner;
+        glm::vec3 maxCorner;
+        std::vector<int> endpoints;
+    };
+
+    // Kapının bir odadaki ucu; kapı p'nin uçları 2p ve 2p+1'dir
+    struct Endpoint {
+        int room;
+        glm::vec2 point;
+        std::vector<float> field;  // odasındaki hücrelere yürüme mesafesi
+    };
+
+    std::vector<std::unique_ptr<Room>> rooms;
+    std::vector<Endpoint> endpoints;
+    std::vector<float> endpointCosts;  // endpoints x endpoints, aynı odada değilse ya da ulaşılamazsa negatif
+    uint64_t queryCount;
+
+    // Arama tamponları sorgular arasında yeniden kullanılır
+    std::vector<float> nodeCosts;
+    std::vector<int> nodeParents;
+    std::vector<uint8_t> nodeDone;
+    std::vector<glm::vec2> segment;
+
+    static glm::vec2 flatten(const glm::vec3& point) { return glm::vec2(point.x, point.z); }
+    void appendSegment(std::vector<glm::vec3>& path, float y);
+};
+
+#endif
@@ -0,0 +1,157 @@
+#ifndef PROFILER_HPP
+#define PROFILER_HPP
+
+#include <glad/glad.h>
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Kare içinde zamanın nereye gittiğini gösteren hiyerarşik CPU/GPU profiler.
+// CPU bölgeleri her thread'in kendi halka tamponuna yazılır; GPU bölgeleri zaman damgası
+// sorgularıyla ölçülür ve birkaç kare sonra, sonuç hazır olduğunda okunur.
+// VM_ENABLE_PROFILER tanımlı değilse VM_PROFILE_* makroları hiçbir kod üretmez.
+class Profiler {
+public:
+    // Kapanmış bir CPU bölgesi; zamanlar steady_clock ns
+    struct Event {
+        const char* name;
+        uint64_t start;
+        uint64_t end;
+        int depth;
+        int threadIndex;
+    };
+
+    static Profiler& instance();
+
+    // Ana döngünün başında çağrılır; önceki karenin CPU olaylarını istatistiklere işler
+    void beginFrame();
+
+    // Çağıran thread'in bölge yığınına ekler / çıkarır
+    static void beginZone(const char* name);
+    static void endZone();
+
+    // GL bağlamının bulunduğu thread'de, karenin GL çizimi başlamadan önce çağrılır
+    void beginGpuFrame();
+    void beginGpuZone(const char* name);
+    void endGpuZone();
+
+    void toggleOverlay() { overlayVisible = !overlayVisible; }
+    bool isOverlayVisible() const { return overlayVisible; }
+
+    // ImGui penceresi; newFrame() ile endFrame() arasında çağrılır
+    void renderOverlay();
+
+    // Son beginFrame() çağrısında toplanan, önceki kareye ait tüm thread'lerin bölgeleri
+    const std::vector<Event>& getLastFrameEvents() const { return lastFrameEvents; }
+
+    void cleanup();
+
+private:
+    Profiler();
+    ~Profiler();
+
+    // Tek yazar (sahibi thread), tek okur (beginFrame) halka tamponu; doluysa yeni olaylar atılır
+    struct ThreadBuffer {
+        static const uint32_t CAPACITY = 4096;
+        static const int MAX_DEPTH = 32;
+
+        int threadIndex;
+        Event events[CAPACITY];
+        std::atomic<uint32_t> writeIndex;
+        std::atomic<uint32_t> readIndex;
+
+        const char* openNames[MAX_DEPTH];
+        uint64_t openStarts[MAX_DEPTH];
+        int depth;
+    };
+
+    struct ZoneStats {
+        std::string name;
+        int threadIndex;
+        int depth;
+        double averageMilliseconds;
+        double lastMilliseconds;
+        uint64_t lastSeenFrame;
+    };
+
+    struct GpuZone {
+        const char* name;
+        int depth;
+        GLuint beginQuery;
+        GLuint endQuery;
+    };
+
+    // Sorgular bu kadar kare sonra okunur; böylece CPU GPU'yu beklemez
+    static const int GPU_FRAME_LATENCY = 3;
+
+    struct GpuFrame {
+        std::vector<GpuZone> zones;
+        std::vector<GLuint> queryPool;
+        size_t usedQueries;
+        bool issued;
+        int64_t clockOffset;  // CPU saati - GPU saati (ns), iz kaydı için
+    };
+
+    static ThreadBuffer* threadBuffer();
+    static uint64_t now();
+
+    std::mutex registryMutex;
+    std::vector<ThreadBuffer*> buffers;
+
+    uint64_t frameIndex;
+    uint64_t frameStart;
+    double frameMilliseconds;
+    std::vector<Event> lastFrameEvents;
+    std::map<std::string, ZoneStats> cpuStats;
+
+    GpuFrame gpuFrames[GPU_FRAME_LATENCY];
+    int gpuFrameIndex;
+    int gpuDepth;
+    std::vector<size_t> gpuOpenZones;
+
+    // GPU sonuçları render thread'de yazılır, arayüz ana thread'de okur
+    std::mutex gpuStatsMutex;
+    std::map<std::string, ZoneStats> gpuStats;
+
+    bool overlayVisible;
+
+    GLuint acquireQuery(GpuFrame& frame);
+    void collectGpuFrame(GpuFrame& frame);
+    static void updateStats(ZoneStats& stats, double milliseconds, uint64_t frame);
+};
+
+// Kapsam boyunca süren CPU bölgesi
+class ProfileZone {
+public:
+    explicit ProfileZone(const char* name) { Profiler::beginZone(name); }
+    ~ProfileZone() { Profiler::endZone(); }
+};
+
+// Kapsam boyunca süren CPU + GPU bölgesi; sadece GL thread'inde kullanılır
+class GpuProfileZone {
+public:
+    explicit GpuProfileZone(const char* name) {
+        Profiler::beginZone(name);
+        Profiler::instance().beginGpuZone(name);
+    }
+    ~GpuProfileZone() {
+        Profiler::instance().endGpuZone();
+        Profiler::endZone();
+    }
+};
+
+#define VM_PROFILE_CONCAT_INNER(a, b) a##b
+#define VM_PROFILE_CONCAT(a, b) VM_PROFILE_CONCAT_INNER(a, b)
+
+#ifdef VM_ENABLE_PROFILER
+#define VM_PROFILE_ZONE(name) ProfileZone VM_PROFILE_CONCAT(profileZone, __LINE__)(name)
+#define VM_PROFILE_GPU_ZONE(name) GpuProfileZone VM_PROFILE_CONCAT(gpuProfileZone, __LINE__)(name)
+#else
+#define VM_PROFILE_ZONE(name) ((void)0)
+#define VM_PROFILE_GPU_ZONE(name) ((void)0)
+#endif
+
+#endif
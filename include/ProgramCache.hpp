@@ -0,0 +1,46 @@
+#ifndef PROGRAM_CACHE_HPP
+#define PROGRAM_CACHE_HPP
+
+#include <glad/glad.h>
+#include <cstdint>
+#include <string>
+
+// Bağlanmış shader programlarını glGetProgramBinary ile diske yazar ve sonraki
+// açılışlarda glProgramBinary ile geri yükler. Anahtar; kaynak kod (define'lar dahil),
+// sürücü üreticisi, renderer ve GL sürümünün hash'idir.
+class ProgramCache {
+public:
+    // GL bağlamı ve GLExtensions yüklendikten sonra çağrılmalı
+    static bool initialize(const std::string& directory = "shader_cache");
+
+    static bool isEnabled();
+
+    static uint64_t makeKey(const char* vertexSource, const char* fragmentSource);
+
+    // Önbellekteki programı yükler. Yoksa ya da sürücü reddederse 0 döner.
+    static GLuint load(uint64_t key);
+
+    // Program bağlanmadan önce binary'nin alınabilir olmasını işaretler
+    static void prepareForLink(GLuint program);
+
+    static void store(uint64_t key, GLuint program);
+
+    // Başlangıç sonunda isabet oranını loglar
+    static void logStats();
+
+    static int getHits() { return hits; }
+    static int getMisses() { return misses; }
+    static int getRejected() { return rejected; }
+
+private:
+    static bool enabled;
+    static std::string cacheDirectory;
+    static std::string driverSignature;
+    static int hits;
+    static int misses;
+    static int rejected;
+
+    static std::string pathFor(uint64_t key);
+};
+
+#endif
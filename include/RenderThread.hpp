@@ -0,0 +1,94 @@
+#ifndef RENDER_THREAD_HPP
+#define RENDER_THREAD_HPP
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+#include <glm/glm.hpp>
+#include <atomic>
+#include <functional>
+#include <thread>
+#include <vector>
+#include "imgui.h"
+#include "TransformSystem.hpp"
+#include "RobotFleet.hpp"
+
+// Simülasyonun bir kare için ürettiği ve render thread'in sadece okuduğu veriler.
+// Gönderildikten sonra render thread işini bitirene kadar değiştirilmez.
+struct FramePacket {
+    TransformSystem::Snapshot transforms;
+    FleetInstances fleet;
+    FleetInstances visitors;  // sadece gövdeler
+    glm::mat4 view;
+    glm::mat4 projection;
+    glm::vec3 cameraPosition;
+    bool robotPopupVisible;  // simülasyon popup'ı açıp kapatır, render thread sadece bu kopyayı okur
+    int framebufferWidth;
+    int framebufferHeight;
+
+    // Bu karenin input'unun örneklendiği an (FramePacer::now()); gecikme ölçümü için
+    double inputTime;
+
+    // Çizilecek arayüz; copyDrawData() sonrası pakete ait kopyayı gösterir
+    ImDrawData* drawData;
+
+    FramePacket();
+    ~FramePacket();
+
+    // ImGui'nin listeleri bir sonraki NewFrame'de yeniden yazıldığı için kopyalanır
+    void copyDrawData(const ImDrawData* source);
+
+private:
+    ImDrawData ownedDrawData;
+    std::vector<ImDrawList*> ownedLists;
+
+    void releaseDrawLists();
+
+    FramePacket(const FramePacket&) = delete;
+    FramePacket& operator=(const FramePacket&) = delete;
+};
+
+// GL bağlamının sahibi olan ayrı thread. İki paket dönüşümlü kullanılır: simülasyon
+// N+1. kareyi yazarken render thread N. kareyi çizer. Simülasyon en fazla bir kare
+// önde olabilir; teslimat kilitsiz, sadece atomik durum bayraklarıyla yapılır.
+class RenderThread {
+public:
+    typedef std::function<void(const FramePacket&)> RenderFunction;
+    typedef std::function<void(const FramePacket&)> PresentFunction;
+
+    RenderThread();
+    ~RenderThread();
+
+    // Bağlamı çağıran thread'den bırakıp render thread'e devreder. presentFunction
+    // verildiyse her swap'tan sonra render thread'de çağrılır.
+    bool start(GLFWwindow* window, RenderFunction renderFunction, PresentFunction presentFunction = PresentFunction());
+
+    // Kalan paketi çizer, thread'i durdurur ve bağlamı çağıran thread'e geri verir
+    void stop();
+
+    bool isRunning() const { return running; }
+
+    // Yazılacak boş paketi verir; render thread o paketi hâlâ çiziyorsa bekler
+    FramePacket& acquirePacket();
+
+    // acquirePacket() ile alınan paketi render thread'e teslim eder
+    void submitPacket();
+
+private:
+    enum SlotState {
+        SLOT_FREE = 0,
+        SLOT_READY = 1
+    };
+
+    GLFWwindow* window;
+    RenderFunction renderFunction;
+    PresentFunction presentFunction;
+    FramePacket packets[2];
+    std::atomic<int> slotStates[2];
+    int writeIndex;
+    std::atomic<bool> running;
+    std::thread thread;
+
+    void run();
+};
+
+#endif
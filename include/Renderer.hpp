@@ -6,26 +6,65 @@
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtc/type_ptr.hpp>
 #include <vector>
+#include <atomic>
 #include "Statue.hpp"
 #include "Robot.hpp"
+#include "RobotFleet.hpp"
 #include "UIManager.hpp"
+#include "ShaderLibrary.hpp"
+#include "LightingSystem.hpp"
+#include "MuseumWorld.hpp"
 
 class Renderer {
 public:
     Renderer();
     ~Renderer();
 
-    bool initialize(float roomWidth, float roomHeight, float roomLength);
+    // lighting verilirse heykeller ve robot gölgeli spot/yönlü ışıklarla çizilir
+    bool initialize(float roomWidth, float roomHeight, float roomLength, ShaderLibrary* shaderLibrary,
+                    LightingSystem* lighting = nullptr);
 
     void cleanup();
 
-    void renderScene(GLFWwindow* window, const std::vector<Statue*>& statues, Robot* robot, 
-                    UIManager* uiManager, const glm::vec3& cameraPos, const glm::mat4& viewMatrix, 
-                    const glm::mat4& projectionMatrix, int activeStatueIndex, bool showInfoPanel, 
-                    bool isScanning, float scanProgress, float scanDuration);
+    // fleet ve visitors verilirse yüklenmiş rehber robotları ve ziyaretçiler instanced çizimlerle eklenir.
+    // robotPopupVisible karenin paketinden gelir; robotun canlı durumu okunmaz
+    void renderScene(const std::vector<Statue*>& statues, Robot* robot, const glm::vec3& cameraPos,
+                    const glm::mat4& viewMatrix, const glm::mat4& projectionMatrix, bool robotPopupVisible,
+                    const RobotFleet* fleet = nullptr, const MuseumWorld* visitors = nullptr);
+
+    // Sadece ImGui pencerelerini hazırlar; çizim UIManager::render() ile yapılır
+    void renderUI(GLFWwindow* window, const std::vector<Statue*>& statues, UIManager* uiManager,
+                  const glm::mat4& viewMatrix, const glm::mat4& projectionMatrix, int activeStatueIndex,
+                  bool showInfoPanel, bool isScanning, float scanProgress, float scanDuration);
+
+    // Heykel ve robot için kullanılan temel shader özellikleri
+    static const unsigned int SCENE_FEATURES = SHADER_FEATURE_ATTENUATION;
+    
+    // Gölgeler açıksa SHADOWS eklenmiş hali
+    unsigned int getSceneFeatures() const { return sceneFeatures; }
+
+    // Heykeller önce sadece derinlikle, sonra GL_EQUAL ile renkli çizilir.
+    // Render thread açıkken de simülasyon thread'inden çağrılabilir.
+    void setDepthPrepass(bool enabled) { depthPrepass = enabled; }
+    bool isDepthPrepassEnabled() const { return depthPrepass; }
+    void toggleDepthPrepass() { depthPrepass = !depthPrepass; }
+
+    // Heykel geçişinin GPU maliyeti; her mod için ayrı ayrı yumuşatılmış ortalama.
+    // Render thread yazar, arayüz başka thread'den okuyabilir.
+    struct StatuePassStats {
+        std::atomic<double> gpuMilliseconds;
+        std::atomic<double> fragments;
+        int samples;
+    };
+    const StatuePassStats& getStatuePassStats(bool withPrepass) const { return passStats[withPrepass ? 1 : 0]; }
 
 private:
-    unsigned int shaderProgram;
+    ShaderLibrary* shaderLibrary;
+    LightingSystem* lightingSystem;
+    unsigned int sceneFeatures;
+    ShaderHandle colorShader;
+    ShaderHandle texturedShader;
+    ShaderHandle fleetShader;  // ilk filo çiziminde istenir
     
     unsigned int roomVAO, roomVBO;
     
@@ -33,96 +72,33 @@ private:
     
     float roomWidth, roomHeight, roomLength;
     
-    GLint modelLoc, viewLoc, projLoc, objectColorLoc, lightPosLoc, lightColorsLoc, viewPosLoc;
+    glm::vec3 lightPositions[4];
+    glm::vec3 lightColors[4];
+    
+    // Sonuçlar bir sonraki karede okunur, böylece CPU GPU'yu beklemez
+    struct StatuePassQuery {
+        GLuint timeQuery;
+        GLuint fragmentQuery;
+        bool issued;
+        bool withPrepass;
+    };
+    
+    std::atomic<bool> depthPrepass;
+    bool activeDepthPrepass;  // son çizilen karedeki mod
+    StatuePassQuery passQueries[2];
+    int passQueryIndex;
+    StatuePassStats passStats[2];
+    
+    void setupPassQueries();
+    void collectPassQuery(StatuePassQuery& query);
     
     void setupRoom();
-    void setupShaders();
     void setupLights();
-    unsigned int createShaderProgram(const char* vertexShaderSource, const char* fragmentShaderSource);
+    void applySceneUniforms(GLuint program, const glm::mat4& view, const glm::mat4& projection, const glm::vec3& cameraPos);
     unsigned int loadTexture(const char* path);
     
     void renderRoom(const glm::mat4& view, const glm::mat4& projection);
     void renderStatues(const std::vector<Statue*>& statues, const glm::mat4& view, const glm::mat4& projection);
-    void renderRobot(Robot* robot, const glm::mat4& view, const glm::mat4& projection);
-    
-    const char* vertexShaderSource = R"(
-        #version 330 core
-        layout (location = 0) in vec3 aPos;
-        layout (location = 1) in vec3 aNormal;
-        layout (location = 2) in vec2 aTexCoord;
-
-        out vec3 FragPos;
-        out vec3 Normal;
-        out vec2 TexCoord;
-
-        uniform mat4 model;
-        uniform mat4 view;
-        uniform mat4 projection;
-
-        void main() {
-            FragPos = vec3(model * vec4(aPos, 1.0));
-            Normal = mat3(transpose(inverse(model))) * aNormal;
-            TexCoord = aTexCoord;
-            gl_Position = projection * view * vec4(FragPos, 1.0);
-        }
-    )";
-
-    const char* fragmentShaderSource = R"(
-        #version 330 core
-        out vec4 FragColor;
-
-        in vec3 FragPos;
-        in vec3 Normal;
-        in vec2 TexCoord;
-
-        uniform vec3 objectColor;
-        uniform vec3 lightPositions[4];
-        uniform vec3 lightColors[4];
-        uniform vec3 viewPos;
-        uniform sampler2D texture1;
-        uniform sampler2D wallTexture;
-        uniform bool hasTexture;
-        uniform bool useWallTexture;
-
-        void main() {
-            float ambientStrength = 0.3;
-            vec3 ambient = ambientStrength * vec3(1.0, 1.0, 1.0);
-            
-            vec3 result = vec3(0.0, 0.0, 0.0);
-            vec3 norm = normalize(Normal);
-            
-            for(int i = 0; i < 4; i++) {
-                vec3 lightDir = normalize(lightPositions[i] - FragPos);
-                float diff = max(dot(norm, lightDir), 0.0);
-                vec3 diffuse = diff * lightColors[i];
-                
-                float specularStrength = 0.5;
-                vec3 viewDir = normalize(viewPos - FragPos);
-                vec3 reflectDir = reflect(-lightDir, norm);
-                float spec = pow(max(dot(viewDir, reflectDir), 0.0), 32);
-                vec3 specular = specularStrength * spec * lightColors[i];
-                
-                float distance = length(lightPositions[i] - FragPos);
-                float attenuation = 1.0 / (1.0 + 0.09 * distance + 0.032 * (distance * distance));
-                
-                diffuse *= attenuation;
-                specular *= attenuation;
-                
-                result += (diffuse + specular);
-            }
-            
-            result += ambient;
-            
-            vec4 texColor;
-            if(hasTexture) {
-                texColor = texture(texture1, TexCoord);
-            } else if(useWallTexture) {
-                texColor = texture(wallTexture, TexCoord);
-            } else {
-                texColor = vec4(objectColor, 1.0);
-            }
-            
-            FragColor = vec4(result * texColor.rgb, 1.0);
-        }
-    )";
+    void renderStatueDepth(const std::vector<Statue*>& statues, const glm::mat4& view, const glm::mat4& projection);
+    void renderRobot(Robot* robot, const glm::mat4& view, const glm::mat4& projection, GLuint program, bool popupVisible);
 };
@@ -9,6 +9,11 @@
 
 #include "Statue.hpp"
 #include "RobotMesh.hpp"
+#include "TransformSystem.hpp"
+#include "SpatialHash.hpp"
+
+class NavigationSystem;
+class CollisionWorld;
 
 class Robot {
 public:
@@ -18,9 +23,13 @@ public:
     
     bool initialize();
     
-    void render(const glm::mat4& viewMatrix, const glm::mat4& projectionMatrix, GLuint shaderProgram);
+    // popupVisible çağıranın kopyaladığı durumdur; render thread canlı isPopupVisible'ı okumaz
+    void render(const glm::mat4& viewMatrix, const glm::mat4& projectionMatrix, GLuint shaderProgram, bool popupVisible);
+    
+    // Gölge haritası için gövde ve kolu sadece derinlik olarak çizer
+    void renderDepth(const glm::mat4& viewMatrix, const glm::mat4& projectionMatrix, GLuint shaderProgram);
     
-    void update(float deltaTime, const std::vector<std::unique_ptr<Statue>>& statues);
+    void update(float deltaTime, const std::vector<std::unique_ptr<Statue>>& statues, const SpatialHash& statueIndex);
     
     void moveTo(const glm::vec3& targetPosition);
     
@@ -32,6 +41,8 @@ public:
     
     void closeInfoPopup();
     
+    bool isShowingPopup() const { return isPopupVisible; }
+    
     void handleUserInteraction(int key, int action);
 
     void moveForward(float speed);
@@ -46,32 +57,90 @@ public:
     float getRotation() const { return rotation; }
     void setMovementSpeed(float speed) { movementSpeed = speed; }
     void setPosition(const glm::vec3& newPosition);
+    TransformSystem::Handle getBodyTransform() const { return bodyTransform; }
+
+    // Rehber filosu aynı mesh'i salt okunur paylaşır
+    const RobotMesh& getMesh() const { return robotMesh; }
+    bool isScanning() const { return scanning; }
+
+    // Sabit adımlı simülasyon: beginTick() adımdan önceki pozu saklar, applyInterpolation()
+    // gövde transformunu önceki ve son adım arasındaki poza taşır. Simülasyon her zaman
+    // position/rotation'u okur; transform sadece çizim içindir.
+    void beginTick();
+    void applyInterpolation(float alpha);
+    glm::vec3 getRenderPosition() const { return renderPosition; }
+    float getRenderRotation() const { return renderRotation; }
+
+    // Otomatik tur: robot durakları sırayla gezer, her durağa yol haritasından planlanan
+    // rotayla gider ve durakta biraz bekler. Elle hareket turu durdurur. Yol haritası
+    // verilmediyse R turun yerine robotu rastgele bir noktaya düz yürütür.
+    void setNavigation(NavigationSystem* navigation, const std::vector<glm::vec3>& tourStops);
+    void setAutopilot(bool enabled);
+    bool isAutopilotEnabled() const { return autopilot; }
+    void updateAutopilot(float deltaTime);
+
+    // Elle hareket heykellere ve duvarlara çarpıp yüzey boyunca kayar; yoksa sadece sınır kutusu
+    void setCollision(const CollisionWorld* collision) { this->collision = collision; }
+    static constexpr float COLLISION_RADIUS = 0.2f;
+    // Yol haritası engelleri bu yarıçapla büyütür; pay, düzleştirilmiş rotalarda kürenin
+    // heykel yüzeyine sürtünüp yoldan sapmasını önler
+    static constexpr float NAV_RADIUS = COLLISION_RADIUS + 0.1f;
 
 private:
     glm::vec3 position;
     glm::vec3 front;
     float rotation;
+    glm::vec3 previousPosition;
+    float previousRotation;
+    glm::vec3 renderPosition;
+    float renderRotation;
     float movementSpeed;
     float rotationSpeed;
     glm::vec3 targetPosition;
     bool isMoving;
     bool hasReachedTarget;
-    bool isStopped;
     int currentTargetIndex;
-    std::vector<glm::vec3> targetPoints;
+    std::vector<glm::vec3> targetPoints;  // planlanan rotanın ara noktaları
+    
+    NavigationSystem* navigation;
+    std::vector<glm::vec3> tourStops;
+    int currentStop;
+    bool autopilot;
+    float dwellTimer;
+    static constexpr float AUTOPILOT_SPEED = 1.5f;       // m/sn
+    static constexpr float AUTOPILOT_TURN_SPEED = 240.0f; // derece/sn
+    static constexpr float STOP_DWELL = 3.0f;
+    
+    bool planToStop(int stop);
+    void followPath(float budget, float maxTurn);
+    
+    const CollisionWorld* collision;
+    void moveBy(const glm::vec3& motion);
+    void turnTowards(const glm::vec3& direction, float maxAngle);
     
     bool isPopupVisible;
     
+    // Bu robotun tarama oturumu; her örneğin kendi oturumu vardır
+    bool scanning;
+    float scanTimer;
+    static constexpr float SCAN_DURATION = 4.0f;
+    
     GLuint popupVAO, popupVBO; 
     RobotMesh robotMesh;       
     
+    // Gövde transformu; kol bunun çocuğu olduğu için gövdeyle birlikte güncellenir
+    TransformSystem::Handle bodyTransform;
+    TransformSystem::Handle armTransform;
+    
+    void syncTransform();
+    
     bool loadRobotModel();
     
     void createPopupInterface();
     
 
     
-    const Statue* findNearestStatue(const std::vector<std::unique_ptr<Statue>>& statues);
+    const Statue* findNearestStatue(const std::vector<std::unique_ptr<Statue>>& statues, const SpatialHash& statueIndex);
     
     bool isNearStatue(const Statue& statue, float threshold = 2.0f);
 };
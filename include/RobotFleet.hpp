@@ -0,0 +1,111 @@
+#ifndef ROBOT_FLEET_HPP
+#define ROBOT_FLEET_HPP
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <vector>
+#include "Statue.hpp"
+#include "RobotMesh.hpp"
+
+// Çizim için kopyalanan örnek matrisleri. Render thread açıkken pakete konur ve
+// render thread sadece bu kopyayı okur.
+struct FleetInstances {
+    std::vector<glm::mat4> bodies;
+    std::vector<glm::mat4> arms;
+    uint64_t version;
+
+    FleetInstances() : version(0) {}
+};
+
+// Grup turları için çok sayıda rehber robot. Her robotun durumu ayrı dizilerde (SoA)
+// tutulur ve adımlar JobSystem ile paralel işlenir. Her robot heykelleri kendi sırasıyla
+// gezer ve vardığı heykelde kendi tarama oturumunu yürütür. Mesh oyuncu robotundan
+// salt okunur paylaşılır; tüm filo gövde ve kol için birer instanced çizimle çizilir.
+class RobotFleet {
+public:
+    RobotFleet();
+    ~RobotFleet();
+
+    // tourStops heykel konumları (StatueManager sırasıyla); roomHalfSize odanın yarı boyutları
+    // (robotlar zeminde, duvarların içinde kalır)
+    bool initialize(const RobotMesh* mesh, const std::vector<glm::vec3>& tourStops, const glm::vec3& roomHalfSize,
+                    float scanDuration);
+
+    void cleanup();
+
+    // Robotlar giriş bölgesinde sıralanır ve her biri turuna farklı bir heykelden başlar
+    void spawn(int count);
+
+    size_t getCount() const { return positionX.size(); }
+
+    // Sabit adım başında önceki poz saklanır (Robot::beginTick ile aynı)
+    void beginTick();
+
+    // Hareket ve tarama oturumları; robotlar birbirinden bağımsız olduğu için paralel
+    void update(float deltaTime);
+
+    // Önceki ve son adım arasındaki pozdan gövde ve kol matrislerini hazırlar
+    void applyInterpolation(float alpha);
+
+    // Hazırlanan matrisleri pakete kopyalar; versiyon sadece poz değiştiyse artar
+    void captureInstances(FleetInstances& instances) const;
+
+    // GL thread'inde, çizimden önce matrisleri örnek tamponlarına yükler
+    void upload(const FleetInstances& instances);
+
+    // upload() ile yüklenen örnekleri çizer; program INSTANCED varyantı olmalı
+    void render(const glm::mat4& viewMatrix, const glm::mat4& projectionMatrix, GLuint shaderProgram) const;
+    void renderDepth(const glm::mat4& viewMatrix, const glm::mat4& projectionMatrix, GLuint shaderProgram) const;
+
+    // Gölgenin dinamik katmanı bu değişince yeniden çizilir
+    uint64_t getUploadedVersion() const { return uploadedVersion; }
+    size_t getUploadedCount() const { return uploadedCount; }
+
+    // Robotun tarama oturumu: taranan heykel (yoksa -1) ve ilerleme [0, 1]
+    int getScanStatue(size_t robot) const { return scanStatue[robot]; }
+    float getScanProgress(size_t robot) const;
+    glm::vec3 getPosition(size_t robot) const;
+
+    // Şu an tarama yapan robot sayısı ve bugüne kadar tamamlanan taramalar
+    int getScanningCount() const;
+    uint64_t getCompletedScans() const;
+
+private:
+    const RobotMesh* mesh;
+    std::vector<glm::vec3> stops;
+    glm::vec3 minBounds;
+    glm::vec3 maxBounds;
+    float floorHeight;
+    float scanDuration;
+    float movementSpeed;
+
+    // Robot başına durum; i. robotun verisi her dizinin i. elemanıdır
+    std::vector<float> positionX, positionZ, rotation;
+    std::vector<float> previousX, previousZ, previousRotation;
+    std::vector<float> targetX, targetZ;
+    std::vector<int> tourStop;      // sıradaki / bulunulan durak
+    std::vector<int> scanStatue;    // tarama oturumu; yürürken -1
+    std::vector<float> scanElapsed;
+    std::vector<uint32_t> completed;  // robot başına biten tarama sayısı
+
+    // applyInterpolation çıktısı ve SimdKernels girdileri
+    std::vector<float> renderX, renderY, renderZ, renderRotation;
+    std::vector<float> zeros, scales;
+    std::vector<glm::mat4> bodyMatrices, armMatrices, armOffsets;
+    uint64_t poseVersion;
+
+    // GL tarafı; sadece GL thread'i dokunur
+    GLuint instanceBuffers[2];
+    GLuint vaos[2];
+    size_t uploadedCount;
+    size_t bufferCapacity;
+    uint64_t uploadedVersion;
+
+    void chooseViewpoint(size_t robot);
+    void updateRange(size_t first, size_t last, float deltaTime);
+    bool composeRange(size_t first, size_t last, float alpha);
+    void draw(const glm::mat4& viewMatrix, const glm::mat4& projectionMatrix, GLuint shaderProgram, bool textured) const;
+};
+
+#endif
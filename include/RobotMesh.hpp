@@ -22,6 +22,15 @@ public:
     size_t getRobotIndicesCount() const { return robotIndicesCount; }
     size_t getArmIndicesCount() const { return armIndicesCount; }
 
+    enum Part {
+        PART_BODY = 0,
+        PART_ARM = 1
+    };
+
+    // Parçanın vertex/index tamponlarını paylaşan, 3-6. konumlarda instanceBuffer'dan
+    // örnek başına model matrisi (mat4) okuyan yeni bir VAO. Silmek çağıranın işidir.
+    GLuint createInstancedVAO(Part part, GLuint instanceBuffer) const;
+
 private:
     // OpenGL buffer objects
     GLuint robotVAO, robotVBO, robotEBO;
@@ -5,6 +5,9 @@
 #include <glm/glm.hpp>
 #include <vector>
 #include "Statue.hpp"
+#include "ShaderLibrary.hpp"
+
+class LightingSystem;
 
 class Room {
 public:
@@ -14,7 +17,9 @@ public:
     
     bool initialize();
     
-    void render(const glm::mat4& viewMatrix, const glm::mat4& projectionMatrix, GLuint shaderProgram);
+    // lighting verilirse duvarlar ve zemin gölge alan varyantla çizilir
+    void render(const glm::mat4& viewMatrix, const glm::mat4& projectionMatrix, ShaderLibrary& shaderLibrary,
+                const LightingSystem* lighting = nullptr);
     
     void update(float deltaTime);
     
@@ -4,14 +4,18 @@
 #include <glad/glad.h>
 #include <string>
 #include <glm/glm.hpp>
+#include "ShaderLibrary.hpp"
 
 class Shader {
 public:
+    static const unsigned int DEFAULT_VARIANT = SHADER_FEATURE_WALL | (4u << ShaderLibrary::LIGHT_COUNT_SHIFT);
+
     Shader();
     
     ~Shader();
     
-    bool initialize();
+    // Varsayılan olarak duvar dokulu, 4 ışıklı varyant kullanılır
+    bool initialize(unsigned int variantKey = DEFAULT_VARIANT);
     
     void use() const;
     
@@ -33,11 +37,6 @@ public:
 
 private:
     unsigned int ID;
-    
-    static const char* vertexShaderSource;
-    static const char* fragmentShaderSource;
-    
-    unsigned int createShaderProgram(const char* vertexSource, const char* fragmentSource);
 };
 
 #endif
@@ -0,0 +1,131 @@
+#ifndef SHADER_LIBRARY_HPP
+#define SHADER_LIBRARY_HPP
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+// Shader varyantlarını seçen özellik bayrakları. Her bayrak kaynakta bir #define olur.
+enum ShaderFeature : unsigned int {
+    SHADER_FEATURE_TEXTURED    = 1u << 0,  // texture_diffuse1 ile boyama
+    SHADER_FEATURE_WALL        = 1u << 1,  // wallTexture ile boyama
+    SHADER_FEATURE_ATTENUATION = 1u << 2,  // mesafeye bağlı ışık zayıflaması
+    SHADER_FEATURE_COMPRESSED  = 1u << 3,  // sıkıştırılmış (quantize) vertex verisi
+    SHADER_FEATURE_DEPTH_ONLY  = 1u << 4,  // sadece derinlik yazan ön geçiş
+    SHADER_FEATURE_SHADOWS     = 1u << 5,  // gölge atlasından okunan spot/yönlü ışıklar
+    SHADER_FEATURE_INSTANCED   = 1u << 6   // model matrisi uniform yerine örnek başına vertex verisinden
+};
+
+class ShaderLibrary;
+
+// Derlemesi arka planda süren bir programa future benzeri erişim sağlar.
+// isReady() hiçbir zaman beklemez; get() gerekirse bağlamanın bitmesini bekler.
+class ShaderHandle {
+public:
+    ShaderHandle() : library(nullptr), key(0) {}
+
+    bool isValid() const { return library != nullptr; }
+
+    bool isReady() const;
+
+    GLuint get() const;
+
+    unsigned int getKey() const { return key; }
+
+private:
+    friend class ShaderLibrary;
+    ShaderHandle(ShaderLibrary* library, unsigned int key) : library(library), key(key) {}
+
+    ShaderLibrary* library;
+    unsigned int key;
+};
+
+// Tek bir kaynak metinden #define'larla özelleştirilmiş shader programları üretir.
+// Varyantlar özellik maskesi + ışık sayısından oluşan bir anahtarla saklanır ve
+// ilk istendiklerinde derlenir.
+class ShaderLibrary {
+public:
+    static const int MAX_LIGHTS = 8;
+    static const unsigned int FEATURE_MASK = 0xFFu;
+    static const unsigned int LIGHT_COUNT_SHIFT = 8;
+
+    // Kütüphane kaynağından üretilmeyen programların anahtarları bu bitle işaretlenir
+    static const unsigned int CUSTOM_KEY_BIT = 1u << 31;
+
+    ShaderLibrary();
+    ~ShaderLibrary();
+
+    // Özellik bayrakları ve ışık sayısından varyant anahtarı üretir
+    static unsigned int variantKey(unsigned int features, int lightCount = 4);
+
+    static unsigned int featuresOf(unsigned int key);
+
+    static int lightCountOf(unsigned int key);
+
+    // Derlemeyi başlatır ama sonucunu beklemez
+    ShaderHandle request(unsigned int key);
+
+    // Kendi kaynağını getiren program (ışık küpü, keskinleştirme vb.); varyantlar gibi
+    // derlemesi hemen başlar, sonucu ilk get()'te alınır. Her çağrı yeni bir program üretir.
+    ShaderHandle request(const char* vertexSource, const char* fragmentSource);
+
+    // Verilen tüm varyantların derlemesini tek seferde başlatır
+    void precompile(const std::vector<unsigned int>& keys);
+
+    // Programın beklemeden kullanılabilir olup olmadığını söyler
+    bool isReady(unsigned int key);
+
+    // Anahtara ait programı döndürür; derleme sürüyorsa bitmesini bekler, hiç
+    // istenmemişse o an derler. Hata durumunda 0 döner.
+    GLuint getProgram(unsigned int key);
+
+    // Programı aktif eder ve döndürür
+    GLuint use(unsigned int key);
+
+    // Bir varyantın vertex/fragment kaynağını #define başlığıyla birlikte üretir
+    static std::string buildVertexSource(unsigned int key);
+    static std::string buildFragmentSource(unsigned int key);
+
+    // Vertex ve fragment kaynaklarını derleyip bağlar. Hata durumunda 0 döner.
+    static GLuint compileProgram(const char* vertexSource, const char* fragmentSource);
+
+    // Sürücüye paralel derleme için izin verir (destekleniyorsa)
+    static void enableParallelCompile();
+
+    size_t getVariantCount() const { return programs.size(); }
+
+    size_t getPendingCount() const { return pending.size(); }
+
+    // Derleme tamamlanmasını beklerken geçen toplam süre
+    double getBlockedMilliseconds() const { return blockedMilliseconds; }
+
+    void cleanup();
+
+private:
+    // Derleme komutları verilmiş ama sonucu henüz sorgulanmamış program
+    struct PendingBuild {
+        GLuint vertexShader;
+        GLuint fragmentShader;
+        GLuint program;
+        uint64_t cacheKey;
+    };
+
+    std::unordered_map<unsigned int, GLuint> programs;
+    std::unordered_map<unsigned int, PendingBuild> pending;
+    double blockedMilliseconds;
+    unsigned int nextCustomKey;
+
+    static PendingBuild beginBuild(const char* vertexSource, const char* fragmentSource);
+    static bool isBuildComplete(const PendingBuild& build);
+    static GLuint finishBuild(PendingBuild& build);
+
+    static std::string buildDefines(unsigned int key);
+
+    static const char* vertexShaderSource;
+    static const char* fragmentShaderSource;
+};
+
+#endif
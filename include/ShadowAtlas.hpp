@@ -0,0 +1,53 @@
+#ifndef SHADOW_ATLAS_HPP
+#define SHADOW_ATLAS_HPP
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+
+// Tüm gölgeli ışıkların derinlik haritalarını tek bir dokuda karolar halinde tutar.
+// İki katman vardır: statik katman (heykeller) sadece değişince yeniden çizilir,
+// küçük dinamik katman (robot) hareketli nesneler için ayrıca güncellenir.
+// Shader iki katmandan okunan derinliklerin küçüğünü kullanır.
+class ShadowAtlas {
+public:
+    static const int TILE_COLUMNS = 4;
+    static const int TILE_ROWS = 2;
+    static const int MAX_TILES = TILE_COLUMNS * TILE_ROWS;
+
+    enum Layer {
+        STATIC_LAYER = 0,
+        DYNAMIC_LAYER = 1
+    };
+
+    ShadowAtlas();
+    ~ShadowAtlas();
+
+    bool initialize(int staticTileSize = 1024, int dynamicTileSize = 256);
+
+    void cleanup();
+
+    bool isInitialized() const { return framebuffers[STATIC_LAYER] != 0; }
+
+    // Katmanın framebuffer'ını bağlar; önceki viewport end() ile geri yüklenir
+    void begin(Layer layer);
+
+    // Karoyu çizime hazırlar ve sadece o karonun derinliğini temizler
+    void beginTile(int tile);
+
+    void end();
+
+    // Karonun atlas içindeki UV konumu (xy) ve boyutu (zw); iki katmanda aynıdır
+    glm::vec4 getTileRect(int tile) const;
+
+    GLuint getTexture(Layer layer) const { return textures[layer]; }
+
+private:
+    GLuint framebuffers[2];
+    GLuint textures[2];
+    int tileSizes[2];
+    Layer activeLayer;
+    GLint previousViewport[4];
+    GLint previousFramebuffer;
+};
+
+#endif
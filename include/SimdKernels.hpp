@@ -0,0 +1,62 @@
+#ifndef SIMD_KERNELS_HPP
+#define SIMD_KERNELS_HPP
+
+#include <glm/glm.hpp>
+#include <cstddef>
+#include <cstdint>
+
+// Çok sayıda nesne üzerinde aynı matematiği yapan SoA (her bileşen ayrı dizide) çekirdekler.
+// SSE, AVX2 ve AArch64 NEON yolları ile skaler yedek vardır; en iyi yol çalışma anında
+// işlemciye göre seçilir. VM_SIMD=scalar|sse|avx2|neon ortam değişkeni seçimi zorlar.
+class SimdKernels {
+public:
+    enum Path {
+        PATH_SCALAR = 0,
+        PATH_SSE = 1,
+        PATH_AVX2 = 2,
+        PATH_NEON = 3,
+        PATH_COUNT = 4
+    };
+
+    // Başlangıçta bir kez; çağrılmazsa ilk kullanımda yapılır
+    static void initialize();
+
+    static Path getPath();
+    static const char* getPathName(Path path);
+    static bool isSupported(Path path);
+
+    // Desteklenmeyen yol istenirse false döner ve seçim değişmez
+    static bool setPath(Path path);
+
+    // out[i] = |(x[i], y[i], z[i]) - point|
+    static void distances(const float* x, const float* y, const float* z, size_t count,
+                          const glm::vec3& point, float* out);
+
+    // Düzlemler (normal, d) biçiminde, normal içeri bakar; extractFrustumPlanes() ile elde edilir.
+    // visible[i] küre/kutu tamamen bir düzlemin dışında değilse 1'dir.
+    static void spheresInFrustum(const float* x, const float* y, const float* z, const float* radius,
+                                 size_t count, const glm::vec4 planes[6], uint8_t* visible);
+
+    // Kutular merkez ve yarı boyutlarla verilir
+    static void boxesInFrustum(const float* centerX, const float* centerY, const float* centerZ,
+                               const float* extentX, const float* extentY, const float* extentZ,
+                               size_t count, const glm::vec4 planes[6], uint8_t* visible);
+
+    // TransformSystem ile aynı sıra: T * Rx * Ry * Rz * S, dönüşler derece cinsinden
+    static void composeTRS(const float* positionX, const float* positionY, const float* positionZ,
+                           const float* rotationX, const float* rotationY, const float* rotationZ,
+                           const float* scaleX, const float* scaleY, const float* scaleZ,
+                           size_t count, glm::mat4* out);
+
+    // out[i] = a[i] * b[i]; out a veya b ile aynı dizi olabilir
+    static void multiply(const glm::mat4* a, const glm::mat4* b, size_t count, glm::mat4* out);
+
+    // Görüş-izdüşüm matrisinden normalize edilmiş altı düzlem (Gribb-Hartmann)
+    static void extractFrustumPlanes(const glm::mat4& viewProjection, glm::vec4 planes[6]);
+
+    // Her desteklenen yolu glm ile karşılaştırır ve hızlarını yazdırır (--simd-benchmark).
+    // Herhangi bir yol glm'den farklı sonuç verirse false döner
+    static bool runBenchmarks();
+};
+
+#endif
@@ -0,0 +1,86 @@
+#ifndef SPATIAL_HASH_HPP
+#define SPATIAL_HASH_HPP
+
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+// XZ düzleminde sabit boyutlu hücrelere bölünmüş seyrek ızgara. Her öğe konumu ve
+// tetikleme yarıçapıyla, yarıçap dairesinin değdiği tüm hücrelere yazılır; böylece
+// bir noktanın hücresi, o noktayı kapsayabilecek tüm öğeleri doğrudan verir.
+// Sorgu maliyeti koleksiyonun boyutuna değil, hücre başına öğe sayısına bağlıdır.
+// Mesafeler 3B ölçülür; XZ hücreleri sadece adayları daraltır.
+class SpatialHash {
+public:
+    typedef int Handle;
+    static const Handle INVALID_HANDLE = -1;
+
+    // Hücre kenarı tipik sorgu yarıçapı civarında seçilmeli
+    explicit SpatialHash(float cellSize = 2.0f);
+
+    Handle insert(const glm::vec3& position, float radius);
+    void update(Handle handle, const glm::vec3& position);
+    void remove(Handle handle);
+    void clear();
+
+    const glm::vec3& getPosition(Handle handle) const { return positions[handle]; }
+    float getRadius(Handle handle) const { return radii[handle]; }
+    size_t getCount() const { return positions.size() - freeList.size(); }
+
+    // maxDistance'tan yakın en yakın öğe; yoksa INVALID_HANDLE
+    Handle nearestWithin(const glm::vec3& point, float maxDistance) const;
+
+    // En yakın k öğe, yakından uzağa; maxDistance dışındakiler alınmaz
+    void kNearest(const glm::vec3& point, int k, float maxDistance, std::vector<Handle>& result) const;
+
+    // Noktayı tetikleme yarıçapı içinde tutan öğeler
+    void containing(const glm::vec3& point, std::vector<Handle>& result) const;
+
+    // Hareket eden bir gözlemci için giriş/çıkış olayları. Aday listesi sadece gözlemci
+    // hücre değiştirdiğinde yeniden toplanır; hücre içinde sadece bu kısa liste denetlenir.
+    struct Trigger {
+        int64_t cell;
+        uint32_t version;
+        bool valid;
+        std::vector<Handle> candidates;
+        std::vector<Handle> inside;
+        std::vector<Handle> entered;
+        std::vector<Handle> left;
+
+        Trigger() : cell(0), version(0), valid(false) {}
+    };
+
+    void updateTrigger(Trigger& trigger, const glm::vec3& point) const;
+
+private:
+    float cellSize;
+    float inverseCellSize;
+
+    std::vector<glm::vec3> positions;
+    std::vector<float> radii;
+    std::vector<uint8_t> alive;
+    std::vector<Handle> freeList;
+    std::unordered_map<int64_t, std::vector<Handle>> cells;
+
+    // Ekleme/silme/taşımada artar; tetikleyicilerin aday listesi buna göre yenilenir
+    uint32_t version;
+
+    // Dolu hücrelerin sınırları; halka araması bunların dışına taşmaz
+    int minCellX, maxCellX, minCellZ, maxCellZ;
+
+    // Birden çok hücredeki öğenin sorguda bir kez sayılması için
+    mutable std::vector<uint32_t> visitStamps;
+    mutable uint32_t currentStamp;
+
+    int cellCoordinate(float value) const;
+    static int64_t cellKey(int x, int z);
+    void addToCells(Handle handle);
+    void removeFromCells(Handle handle);
+    uint32_t nextStamp() const;
+
+    // Aynı sorguda daha önce görülmediyse true
+    bool visit(Handle handle) const;
+};
+
+#endif
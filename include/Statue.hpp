@@ -10,6 +10,8 @@
 #include <assimp/Importer.hpp>
 #include <assimp/scene.h>
 #include <assimp/postprocess.h>
+#include "ShaderLibrary.hpp"
+#include "TransformSystem.hpp"
 
 class Statue {
 public:
@@ -20,8 +22,6 @@ public:
           
     static std::vector<Statue*> createStatueCollection(float roomWidth, float roomHeight, float roomLength);
     
-    static int checkProximity(const std::vector<Statue*>& statues, const glm::vec3& robotPos, float proximityDistance);
-    
     ~Statue();
     
     bool initialize();
@@ -30,12 +30,28 @@ public:
                const glm::mat4& projectionMatrix, 
                GLuint shaderProgram);
     
+    // Her mesh için dokulu ya da düz renk varyantını kütüphaneden ister
+    void render(const glm::mat4& viewMatrix, 
+               const glm::mat4& projectionMatrix, 
+               ShaderLibrary& shaderLibrary, 
+               unsigned int baseFeatures);
+    
+    // Derinlik ön geçişi: sadece konum akışıyla derinlik tamponunu doldurur
+    void renderDepth(const glm::mat4& viewMatrix, 
+                    const glm::mat4& projectionMatrix, 
+                    ShaderLibrary& shaderLibrary);
+    
     // update fonksiyonu kaldırıldı
     
     glm::vec3 getPosition() const;
     
     glm::vec3 getRotation() const;
     
+    TransformSystem::Handle getTransform() const { return transform; }
+    
+    // Tüm mesh üçgenlerinin dünya uzayındaki köşeleri, üçgen başına üç nokta (yol haritası için)
+    void collectTriangles(std::vector<glm::vec3>& triangles) const;
+    
     
     void setInformation(const std::string& title, 
                        const std::string& description, 
@@ -56,9 +72,8 @@ public:
 
 private:
     std::string modelPath;
-    glm::vec3 position;
-    glm::vec3 scale;
-    glm::vec3 rotation;
+    // Konum/dönüş/ölçek TransformSystem'de tutulur, matris sadece değişince hesaplanır
+    TransformSystem::Handle transform;
     
     std::string title;
     std::string description;
@@ -92,6 +107,7 @@ private:
         std::vector<unsigned int> indices;
         std::vector<Texture> textures;
         GLuint VAO, VBO, EBO;
+        GLuint depthVAO, depthVBO;  // ön geçiş için sıkı paketlenmiş konum tamponu
     };
     
     std::vector<Mesh> meshes;
@@ -102,6 +118,8 @@ private:
     void processNode(aiNode* node, const aiScene* scene);
     Mesh processMesh(aiMesh* mesh, const aiScene* scene);
     void setupMesh(Mesh& mesh);
+    void applyTransformUniforms(GLuint program) const;
+    void drawMesh(const Mesh& mesh) const;
     std::vector<Texture> loadMaterialTextures(aiMaterial* mat, aiTextureType type, std::string typeName);
     GLuint textureFromFile(const std::string& path, const std::string& directory);
     
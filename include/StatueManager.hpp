@@ -5,6 +5,9 @@
 #include <glm/glm.hpp>
 #include "Statue.hpp"
 #include "Robot.hpp"
+#include "SpatialHash.hpp"
+
+class MuseumWorld;
 
 class StatueManager {
 public:
@@ -14,6 +17,9 @@ public:
     
     bool initialize(float roomWidth, float roomHeight, float roomLength);
     
+    // Yakınlık sorguları heykel konumlarını bu dünyadaki varlıklardan okur; indeks burada kurulur
+    void setWorld(MuseumWorld* world);
+    
     void updateStatueProximity(const Robot* robot);
     
     void startScanning();
@@ -37,6 +43,13 @@ public:
     bool shouldShowInfoPanel() const;
     
     void setShowInfoPanel(bool show);
+    
+    // Son updateStatueProximity() çağrısında yakınlık alanına girilen / çıkılan heykeller
+    const std::vector<int>& getEnteredStatues() const { return robotTrigger.entered; }
+    const std::vector<int>& getLeftStatues() const { return robotTrigger.left; }
+    
+    // Yakından uzağa en fazla count heykel
+    void findNearestStatues(const glm::vec3& position, int count, float maxDistance, std::vector<int>& result) const;
 
 private:
     std::vector<Statue*> statues;
@@ -48,6 +61,12 @@ private:
     bool showInfoPanel;
     float infoDisplayTime;
     const float INFO_DISPLAY_DURATION = 5.0f;
+    
+    MuseumWorld* world;
+    
+    // Heykel konumları yakınlık yarıçapıyla; tutamaç heykelin listedeki sırasıdır
+    SpatialHash statueIndex;
+    SpatialHash::Trigger robotTrigger;
 };
 
 #endif
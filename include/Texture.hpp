@@ -7,6 +7,7 @@
 #include <fstream>
 
 #include "../external/stb/stb_image.h"
+#include "GLStateCache.hpp"
 
 class Texture {
 public:
@@ -38,7 +39,7 @@ public:
             }
             
            
-            glBindTexture(GL_TEXTURE_2D, textureID);
+            GLStateCache::bindTexture(GL_TEXTURE_2D, textureID);
             glTexImage2D(GL_TEXTURE_2D, 0, format, width, height, 0, format, GL_UNSIGNED_BYTE, data);
             glGenerateMipmap(GL_TEXTURE_2D);
             
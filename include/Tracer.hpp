@@ -0,0 +1,35 @@
+#ifndef TRACER_HPP
+#define TRACER_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+// Profiler bölgelerini, başlangıç aşamalarını ve sayaçları Chrome trace JSON olarak
+// diske yazar (chrome://tracing veya ui.perfetto.dev ile açılır).
+// Her thread olaylarını kendi parçasına yazar; dolan parçalar kilitsiz bir yığına
+// eklenir ve arka plandaki yazıcı thread tarafından dosyaya aktarılır.
+// Kapalıyken her kayıt çağrısı tek bir atomik okumadan ibarettir.
+class Tracer {
+public:
+    static bool start(const std::string& path);
+    static void stop();
+
+    static bool isActive() { return active.load(std::memory_order_relaxed); }
+
+    // Profiler::now() ile aynı saat (steady_clock, ns)
+    static uint64_t now();
+
+    // name kayıt dosyaya yazılana kadar yaşamalıdır (string literal)
+    static void recordZone(const char* name, uint64_t start, uint64_t end);
+    static void recordGpuZone(const char* name, uint64_t start, uint64_t end);
+    static void recordCounter(const char* name, double value);
+
+    // Çağıran thread'in izleyicide görünecek adı
+    static void setThreadName(const char* name);
+
+private:
+    static std::atomic<bool> active;
+};
+
+#endif
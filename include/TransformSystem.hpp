@@ -0,0 +1,91 @@
+#ifndef TRANSFORM_SYSTEM_HPP
+#define TRANSFORM_SYSTEM_HPP
+
+#include <glm/glm.hpp>
+#include <vector>
+#include <cstdint>
+
+// Sahnedeki nesnelerin konum/dönüş/ölçek bilgisini SoA dizilerde tutar.
+// Dünya ve normal matrisleri sadece ilgili transform (ya da ebeveyni) değiştiğinde
+// yeniden hesaplanır; hareketsiz heykeller için kare başına maliyet neredeyse sıfırdır.
+class TransformSystem {
+public:
+    typedef int Handle;
+    static const Handle INVALID_HANDLE = -1;
+
+    static TransformSystem& instance();
+
+    // Dönüş derece cinsinden Euler açılarıdır, X -> Y -> Z sırasıyla uygulanır.
+    // Çocuk transform her zaman ebeveyninden sonra işlenir.
+    Handle create(const glm::vec3& position,
+                  const glm::vec3& rotation = glm::vec3(0.0f),
+                  const glm::vec3& scale = glm::vec3(1.0f),
+                  Handle parent = INVALID_HANDLE);
+
+    void release(Handle handle);
+
+    void setPosition(Handle handle, const glm::vec3& position);
+    void setRotation(Handle handle, const glm::vec3& rotation);
+    void setScale(Handle handle, const glm::vec3& scale);
+    void setLocal(Handle handle, const glm::vec3& position, const glm::vec3& rotation, const glm::vec3& scale);
+
+    const glm::vec3& getPosition(Handle handle) const { return positions[handle]; }
+    const glm::vec3& getRotation(Handle handle) const { return rotations[handle]; }
+    const glm::vec3& getScale(Handle handle) const { return scales[handle]; }
+
+    // Transform her değiştiğinde artar; önbellek tutan sistemler değişikliği buradan anlar
+    uint32_t getVersion(Handle handle) const {
+        return boundSnapshot ? boundSnapshot->versions[handle] : versions[handle];
+    }
+
+    // Kirli transform varsa önce onları günceller
+    const glm::mat4& getWorldMatrix(Handle handle);
+    const glm::mat3& getNormalMatrix(Handle handle);
+
+    // Kirli transformları ve çocuklarını yeniden hesaplar
+    void update();
+
+    size_t getCount() const { return positions.size(); }
+
+    // Son update() çağrısında yeniden hesaplanan matris sayısı
+    size_t getLastRecomputeCount() const { return lastRecomputeCount; }
+
+    // Render thread'e verilen değişmez matris kopyası
+    struct Snapshot {
+        std::vector<glm::mat4> worldMatrices;
+        std::vector<glm::mat3> normalMatrices;
+        std::vector<uint32_t> versions;
+    };
+
+    // Kirli transformları günceller ve matrisleri kopyaya yazar
+    void captureSnapshot(Snapshot& snapshot);
+
+    // Bağlı kopya varken bu thread'deki matris ve versiyon okumaları kopyadan yapılır;
+    // nullptr canlı verilere döner
+    static void bindSnapshot(const Snapshot* snapshot) { boundSnapshot = snapshot; }
+
+private:
+    TransformSystem();
+
+    std::vector<glm::vec3> positions;
+    std::vector<glm::vec3> rotations;
+    std::vector<glm::vec3> scales;
+    std::vector<Handle> parents;
+    std::vector<uint8_t> dirty;
+    std::vector<uint8_t> alive;
+    std::vector<uint8_t> changed;
+    std::vector<uint32_t> versions;
+    std::vector<glm::mat4> worldMatrices;
+    std::vector<glm::mat3> normalMatrices;
+    std::vector<Handle> freeList;
+
+    bool anyDirty;
+    size_t lastRecomputeCount;
+
+    static thread_local const Snapshot* boundSnapshot;
+
+    void markDirty(Handle handle);
+    glm::mat4 composeLocal(Handle handle) const;
+};
+
+#endif
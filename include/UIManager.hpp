@@ -21,14 +21,25 @@ public:
 
     void newFrame();
     
+    // endFrame() ve renderDrawData() birlikte
     void render();
 
+    // Pencereleri çizim listelerine dönüştürür; GL çağrısı yapmaz
+    ImDrawData* endFrame();
+
+    // Çizim listelerini o an bağlı GL bağlamında çizer
+    void renderDrawData(ImDrawData* drawData);
+
     void renderScanEffect(GLFWwindow* window, const Statue& statue, const glm::mat4& view, const glm::mat4& projection, 
                          float scanProgress, float scanDuration);
     
     void renderInfoPanel(GLFWwindow* window, const Statue& statue, const glm::mat4& view, const glm::mat4& projection);
     
     void renderRobotControlPanel(int screenWidth, int screenHeight, int activeStatueIndex, const std::vector<Statue*>& statues);
+    
+    // Derinlik ön geçişi kapalı/açıkken ölçülen heykel geçişi maliyetini gösterir
+    void renderDepthPrepassPanel(bool enabled, double offMilliseconds, double offFragments,
+                                 double onMilliseconds, double onFragments);
 
 private:
     void setupFonts();
@@ -1,4 +1,6 @@
 #include "../include/Application.hpp"
+#include "../include/TransformSystem.hpp"
+#include "../include/GLStateCache.hpp"
 #include <iostream>
 #include <chrono>
 #include <glm/gtc/matrix_transform.hpp>
@@ -44,9 +46,12 @@ bool Application::initialize() {
     glViewport(0, 0, windowWidth, windowHeight);
     
     
-    glEnable(GL_DEPTH_TEST);
+    GLStateCache::enable(GL_DEPTH_TEST);
     
    
+    // Programlar derlenirken modeller yüklenir; her biri ilk kullanımda sonuçlanır
+    shaderLibrary = std::make_unique<ShaderLibrary>();
+    
     room = std::make_unique<Room>();
     if (!room->initialize()) {
         std::cerr << "Oda başlatılamadı!" << std::endl;
@@ -54,13 +59,13 @@ bool Application::initialize() {
     }
     
     exhibitionArea = std::make_unique<ExhibitionArea>();
-    if (!exhibitionArea->initialize()) {
+    if (!exhibitionArea->initialize(*shaderLibrary)) {
         std::cerr << "Sergi alanı başlatılamadı!" << std::endl;
         return false;
     }
     
     lightingSystem = std::make_unique<LightingSystem>();
-    if (!lightingSystem->initialize()) {
+    if (!lightingSystem->initialize(*shaderLibrary)) {
         std::cerr << "Aydınlatma sistemi başlatılamadı!" << std::endl;
         return false;
     }
@@ -72,16 +77,9 @@ bool Application::initialize() {
     }
     
   
-    glEnable(GL_DEPTH_TEST);
-    glEnable(GL_CULL_FACE);
-    glCullFace(GL_BACK);
-    
-    
-    shader = std::make_unique<Shader>();
-    if (!shader->initialize()) {
-        std::cerr << "Shader programı başlatılamadı!" << std::endl;
-        return false;
-    }
+    GLStateCache::enable(GL_DEPTH_TEST);
+    GLStateCache::enable(GL_CULL_FACE);
+    GLStateCache::cullFace(GL_BACK);
     
     return true;
 }
@@ -103,7 +101,8 @@ void Application::run() {
         room->controlCamera(deltaTime);
         exhibitionArea->update(deltaTime);
         lightingSystem->update(deltaTime);
-        robot->update(deltaTime, exhibitionArea->getStatues());
+        robot->update(deltaTime, exhibitionArea->getStatues(), exhibitionArea->getStatueIndex());
+        TransformSystem::instance().update();
         
        
         render();
@@ -117,6 +116,7 @@ void Application::run() {
 void Application::shutdown() {
     
     robot.reset();
+    shaderLibrary.reset();
     lightingSystem.reset();
     exhibitionArea.reset();
     room.reset();
@@ -163,7 +163,8 @@ void Application::render() {
     );
     
    
-    room->render(viewMatrix, projectionMatrix, shader->getID());
+    room->render(viewMatrix, projectionMatrix, *shaderLibrary);
     exhibitionArea->render(viewMatrix, projectionMatrix);
-    robot->render(viewMatrix, projectionMatrix, shader->getID());
+    robot->render(viewMatrix, projectionMatrix, shaderLibrary->getProgram(ShaderLibrary::variantKey(SHADER_FEATURE_TEXTURED)),
+                  robot->isShowingPopup());
 }
@@ -0,0 +1,231 @@
+#include "../include/Benchmark.hpp"
+#include "../include/Robot.hpp"
+#include "../include/Camera.hpp"
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <cstdio>
+#include <cstring>
+#endif
+
+// Senaryonun bir adımı: kaç kare sürdüğü ve ileri/yan/dönüş girdisi (-1..1)
+struct ScriptStep {
+    int frames;
+    float forward;
+    float strafe;
+    float turn;
+};
+
+// Odanın iki yanındaki heykellerin önünden geçip geri dönen tur; sonsuza kadar tekrarlanır
+static const ScriptStep SCRIPT[] = {
+    { 90, 1.0f, 0.0f, 0.0f },
+    { 30, 0.0f, 0.0f, 1.0f },
+    { 120, 1.0f, 0.0f, 0.0f },
+    { 60, 0.0f, 1.0f, 0.0f },
+    { 30, 0.0f, 0.0f, -1.0f },
+    { 90, -1.0f, 0.0f, 0.0f },
+    { 60, 0.0f, -1.0f, 0.0f },
+    { 20, 0.0f, 0.0f, 0.0f },
+};
+static const int SCRIPT_STEPS = sizeof(SCRIPT) / sizeof(SCRIPT[0]);
+
+// InputManager'daki klavye hızlarıyla aynı
+static const float ROBOT_SPEED = 0.6f;
+static const float ROTATION_SPEED = 3.0f;
+
+Benchmark::Benchmark() : phaseOpen(false), startupResidentBytes(0) {
+}
+
+void Benchmark::beginPhase(const std::string& name) {
+    endPhases();
+    phases.push_back({ name, 0.0 });
+    phaseStart = std::chrono::steady_clock::now();
+    phaseOpen = true;
+}
+
+void Benchmark::endPhases() {
+    if (!phaseOpen) return;
+    phases.back().milliseconds =
+        std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - phaseStart).count();
+    phaseOpen = false;
+    startupResidentBytes = getResidentMemoryBytes();
+}
+
+void Benchmark::driveRobot(int frame, float deltaTime, Robot* robot, Camera* camera) {
+    int cycleLength = 0;
+    for (int i = 0; i < SCRIPT_STEPS; i++) {
+        cycleLength += SCRIPT[i].frames;
+    }
+
+    int position = frame % cycleLength;
+    const ScriptStep* step = &SCRIPT[0];
+    for (int i = 0; i < SCRIPT_STEPS; i++) {
+        if (position < SCRIPT[i].frames) {
+            step = &SCRIPT[i];
+            break;
+        }
+        position -= SCRIPT[i].frames;
+    }
+
+    float speed = deltaTime * ROBOT_SPEED;
+    if (step->forward > 0.0f) robot->moveForward(speed * step->forward);
+    if (step->forward < 0.0f) robot->moveBackward(-speed * step->forward);
+    if (step->strafe > 0.0f) robot->moveRight(speed * step->strafe);
+    if (step->strafe < 0.0f) robot->moveLeft(-speed * step->strafe);
+    if (step->turn != 0.0f) robot->rotate(deltaTime * ROTATION_SPEED * step->turn);
+
+    camera->updateCameraWithRobot(robot->getPosition(), robot->getRotation());
+}
+
+void Benchmark::recordFrame(double milliseconds) {
+    frameMilliseconds.push_back(milliseconds);
+}
+
+void Benchmark::recordRenderStats(const GLStats::Counters& counters) {
+    renderStats.push_back(counters);
+}
+
+// En yakın sıra yöntemi; sıralı dizi bekler
+static double percentile(const std::vector<double>& sorted, double fraction) {
+    if (sorted.empty()) return 0.0;
+    size_t rank = static_cast<size_t>(fraction * sorted.size() + 0.5);
+    rank = std::min(std::max<size_t>(rank, 1), sorted.size());
+    return sorted[rank - 1];
+}
+
+bool Benchmark::writeReport(const std::string& jsonPath) {
+    endPhases();
+
+    std::vector<double> measured;
+    for (size_t i = WARMUP_FRAMES; i < frameMilliseconds.size(); i++) {
+        measured.push_back(frameMilliseconds[i]);
+    }
+    std::sort(measured.begin(), measured.end());
+
+    double mean = 0.0;
+    for (double value : measured) mean += value;
+    if (!measured.empty()) mean /= measured.size();
+
+    // Sayaçlar sahne sabit olduğu için kareden kareye az değişir; ortalaması yazılır
+    double drawCalls = 0.0, stateChanges = 0.0, triangles = 0.0;
+    size_t statFrames = 0;
+    for (size_t i = WARMUP_FRAMES; i < renderStats.size(); i++) {
+        drawCalls += renderStats[i].drawCalls;
+        stateChanges += renderStats[i].stateChanges;
+        triangles += renderStats[i].triangles;
+        statFrames++;
+    }
+    if (statFrames > 0) {
+        drawCalls /= statFrames;
+        stateChanges /= statFrames;
+        triangles /= statFrames;
+    }
+
+    std::ofstream json(jsonPath);
+    if (!json) {
+        std::cerr << "Benchmark raporu yazılamadı: " << jsonPath << std::endl;
+        return false;
+    }
+
+    double startupTotal = 0.0;
+    json << "{\n  \"startup_ms\": {\n";
+    for (size_t i = 0; i < phases.size(); i++) {
+        startupTotal += phases[i].milliseconds;
+        json << "    \"" << phases[i].name << "\": " << phases[i].milliseconds << ",\n";
+    }
+    json << "    \"total\": " << startupTotal << "\n  },\n";
+    json << "  \"frames\": " << frameMilliseconds.size() << ",\n";
+    json << "  \"warmup_frames\": " << WARMUP_FRAMES << ",\n";
+    json << "  \"frame_ms\": {\n"
+         << "    \"mean\": " << mean << ",\n"
+         << "    \"p50\": " << percentile(measured, 0.50) << ",\n"
+         << "    \"p95\": " << percentile(measured, 0.95) << ",\n"
+         << "    \"p99\": " << percentile(measured, 0.99) << ",\n"
+         << "    \"max\": " << (measured.empty() ? 0.0 : measured.back()) << "\n  },\n";
+    json << "  \"per_frame\": {\n"
+         << "    \"draw_calls\": " << drawCalls << ",\n"
+         << "    \"state_changes\": " << stateChanges << ",\n"
+         << "    \"triangles\": " << triangles << "\n  },\n";
+    json << "  \"memory_bytes\": {\n"
+         << "    \"after_startup\": " << startupResidentBytes << ",\n"
+         << "    \"final\": " << getResidentMemoryBytes() << ",\n"
+         << "    \"peak\": " << getPeakMemoryBytes() << "\n  }\n}\n";
+
+    std::string csvPath = jsonPath;
+    size_t extension = csvPath.rfind('.');
+    if (extension != std::string::npos && csvPath.find_first_of("/\\", extension) == std::string::npos) {
+        csvPath.erase(extension);
+    }
+    csvPath += ".csv";
+
+    std::ofstream csv(csvPath);
+    if (!csv) {
+        std::cerr << "Benchmark kare tablosu yazılamadı: " << csvPath << std::endl;
+        return false;
+    }
+    csv << "frame,frame_ms,draw_calls,state_changes,triangles,warmup\n";
+    for (size_t i = 0; i < frameMilliseconds.size(); i++) {
+        csv << i << "," << frameMilliseconds[i];
+        if (i < renderStats.size()) {
+            csv << "," << renderStats[i].drawCalls << "," << renderStats[i].stateChanges << "," << renderStats[i].triangles;
+        } else {
+            csv << ",,,";
+        }
+        csv << "," << (i < static_cast<size_t>(WARMUP_FRAMES) ? 1 : 0) << "\n";
+    }
+
+    std::cout << "Benchmark: p50 " << percentile(measured, 0.50) << " ms, p95 " << percentile(measured, 0.95)
+              << " ms, p99 " << percentile(measured, 0.99) << " ms, " << drawCalls << " çizim çağrısı/kare -> "
+              << jsonPath << std::endl;
+    return true;
+}
+
+#ifndef _WIN32
+// /proc/self/status içindeki "Anahtar:   1234 kB" satırını okur
+static size_t readStatusBytes(const char* key) {
+    size_t kilobytes = 0;
+    size_t keyLength = std::strlen(key);
+    if (FILE* status = std::fopen("/proc/self/status", "r")) {
+        char line[256];
+        while (std::fgets(line, sizeof(line), status)) {
+            if (std::strncmp(line, key, keyLength) == 0) {
+                std::sscanf(line + keyLength, "%zu", &kilobytes);
+                break;
+            }
+        }
+        std::fclose(status);
+    }
+    return kilobytes * 1024;
+}
+#endif
+
+size_t Benchmark::getResidentMemoryBytes() {
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS counters;
+    if (K32GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+        return counters.WorkingSetSize;
+    }
+    return 0;
+#else
+    return readStatusBytes("VmRSS:");
+#endif
+}
+
+size_t Benchmark::getPeakMemoryBytes() {
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS counters;
+    if (K32GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+        return counters.PeakWorkingSetSize;
+    }
+    return 0;
+#else
+    return readStatusBytes("VmHWM:");
+#endif
+}
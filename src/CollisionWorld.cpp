@@ -0,0 +1,602 @@
+#include "../include/CollisionWorld.hpp"
+#include "../include/Statue.hpp"
+#include "../include/JobSystem.hpp"
+#include <glm/gtc/constants.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <random>
+
+namespace {
+
+// Temas sonrası yüzeyden bu kadar geri durulur; bir sonraki süpürme yüzeyin içinden başlamasın
+const float SKIN = 1e-3f;
+const size_t MOVE_GRAIN = 32;
+const int STACK_SIZE = 64;
+
+// a t^2 + b t + c = 0'ın [0, maxTime) aralığındaki en küçük kökü
+bool lowestRoot(float a, float b, float c, float maxTime, float& root) {
+    if (std::fabs(a) < 1e-12f) return false;
+    float discriminant = b * b - 4.0f * a * c;
+    if (discriminant < 0.0f) return false;
+    float sq = std::sqrt(discriminant);
+    float first = (-b - sq) / (2.0f * a);
+    float second = (-b + sq) / (2.0f * a);
+    if (first > second) std::swap(first, second);
+    // Küçük negatif kökler yuvarlama hatasıdır; ikinci kök çıkış anıdır, temas sayılmaz
+    if (first < -1e-5f || first >= maxTime) return false;
+    root = std::max(first, 0.0f);
+    return true;
+}
+
+double elapsedMicroseconds(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+}
+
+}
+
+CollisionWorld::CollisionWorld() : built(false) {
+}
+
+int CollisionWorld::addStatue(const Statue& statue) {
+    std::vector<glm::vec3> points;
+    statue.collectTriangles(points);
+    return addTriangles(points);
+}
+
+int CollisionWorld::addTriangles(const std::vector<glm::vec3>& points) {
+    Piece piece;
+    piece.firstTriangle = static_cast<int>(triangles.size());
+    piece.triangleCount = 0;
+    piece.root = -1;
+    for (size_t i = 0; i + 2 < points.size(); i += 3) {
+        Triangle triangle;
+        triangle.a = points[i];
+        triangle.b = points[i + 1];
+        triangle.c = points[i + 2];
+        glm::vec3 ab = triangle.b - triangle.a;
+        glm::vec3 ac = triangle.c - triangle.a;
+        glm::vec3 normal = glm::cross(ab, ac);
+        float length = glm::length(normal);
+        // İnce (dejenere) üçgenlerin normali güvenilmez; komşuları aynı yüzeyi zaten kapatır
+        if (length <= 1e-6f * (glm::dot(ab, ab) + glm::dot(ac, ac))) continue;
+        triangle.normal = normal / length;
+        triangles.push_back(triangle);
+        piece.triangleCount++;
+    }
+    if (piece.triangleCount == 0) return -1;
+    pieces.push_back(piece);
+    built = false;
+    return static_cast<int>(pieces.size() - 1);
+}
+
+int CollisionWorld::addBox(const glm::vec3& minCorner, const glm::vec3& maxCorner) {
+    glm::vec3 corners[8];
+    for (int i = 0; i < 8; i++) {
+        corners[i] = glm::vec3((i & 1) ? maxCorner.x : minCorner.x,
+                               (i & 2) ? maxCorner.y : minCorner.y,
+                               (i & 4) ? maxCorner.z : minCorner.z);
+    }
+    // Her yüz iki üçgen; yön önemli değil, süpürme iki yüzlüdür
+    static const int FACES[6][4] = {
+        { 0, 2, 6, 4 }, { 1, 3, 7, 5 },  // -x, +x
+        { 0, 1, 5, 4 }, { 2, 3, 7, 6 },  // -y, +y
+        { 0, 1, 3, 2 }, { 4, 5, 7, 6 }   // -z, +z
+    };
+    std::vector<glm::vec3> points;
+    points.reserve(36);
+    for (const auto& face : FACES) {
+        points.push_back(corners[face[0]]);
+        points.push_back(corners[face[1]]);
+        points.push_back(corners[face[2]]);
+        points.push_back(corners[face[0]]);
+        points.push_back(corners[face[2]]);
+        points.push_back(corners[face[3]]);
+    }
+    return addTriangles(points);
+}
+
+void CollisionWorld::clear() {
+    triangles.clear();
+    pieces.clear();
+    meshNodes.clear();
+    pieceNodes.clear();
+    pieceOrder.clear();
+    built = false;
+}
+
+void CollisionWorld::build() {
+    meshNodes.clear();
+    pieceNodes.clear();
+    pieceOrder.clear();
+    for (Piece& piece : pieces) {
+        buildPiece(piece);
+    }
+
+    // Geniş faz: parça kutuları üzerinde aynı BVH
+    std::vector<Bounds> bounds;
+    bounds.reserve(pieces.size());
+    for (size_t i = 0; i < pieces.size(); i++) {
+        bounds.push_back(pieces[i].bounds);
+        pieceOrder.push_back(static_cast<int>(i));
+    }
+    if (!pieces.empty()) {
+        pieceNodes.push_back(Node());
+        buildNode(pieceNodes, 0, pieceOrder, bounds, 0, static_cast<int>(pieces.size()));
+    }
+    built = true;
+}
+
+// Üçgenler BVH sırasına dizilir; yapraklar üçgen dizisinde ardışık aralıklardır
+void CollisionWorld::buildPiece(Piece& piece) {
+    int count = piece.triangleCount;
+    std::vector<Bounds> bounds(count);
+    std::vector<int> items(count);
+    for (int i = 0; i < count; i++) {
+        const Triangle& triangle = triangles[piece.firstTriangle + i];
+        bounds[i].min = glm::min(triangle.a, glm::min(triangle.b, triangle.c));
+        bounds[i].max = glm::max(triangle.a, glm::max(triangle.b, triangle.c));
+        items[i] = i;
+    }
+
+    piece.root = static_cast<int>(meshNodes.size());
+    meshNodes.push_back(Node());
+    buildNode(meshNodes, piece.root, items, bounds, 0, count);
+
+    std::vector<Triangle> ordered(count);
+    for (int i = 0; i < count; i++) {
+        ordered[i] = triangles[piece.firstTriangle + items[i]];
+    }
+    std::copy(ordered.begin(), ordered.end(), triangles.begin() + piece.firstTriangle);
+    for (size_t node = piece.root; node < meshNodes.size(); node++) {
+        if (meshNodes[node].count > 0) meshNodes[node].first += piece.firstTriangle;
+    }
+    piece.bounds = meshNodes[piece.root].bounds;
+}
+
+// Merkezlerin en uzun ekseninde ortadan bölünür; çocuklar yan yana eklenir
+void CollisionWorld::buildNode(std::vector<Node>& nodes, int nodeIndex, std::vector<int>& items,
+                               const std::vector<Bounds>& itemBounds, int first, int count) {
+    const float INF = std::numeric_limits<float>::max();
+    Bounds bounds = { glm::vec3(INF), glm::vec3(-INF) };
+    Bounds centers = bounds;
+    for (int i = first; i < first + count; i++) {
+        const Bounds& item = itemBounds[items[i]];
+        bounds.min = glm::min(bounds.min, item.min);
+        bounds.max = glm::max(bounds.max, item.max);
+        glm::vec3 center = (item.min + item.max) * 0.5f;
+        centers.min = glm::min(centers.min, center);
+        centers.max = glm::max(centers.max, center);
+    }
+    nodes[nodeIndex].bounds = bounds;
+
+    glm::vec3 extent = centers.max - centers.min;
+    int axis = extent.x > extent.y ? (extent.x > extent.z ? 0 : 2) : (extent.y > extent.z ? 1 : 2);
+    if (count <= LEAF_SIZE || extent[axis] <= 0.0f) {
+        nodes[nodeIndex].first = first;
+        nodes[nodeIndex].count = count;
+        return;
+    }
+
+    int middle = first + count / 2;
+    std::nth_element(items.begin() + first, items.begin() + middle, items.begin() + first + count,
+                     [&itemBounds, axis](int left, int right) {
+                         return itemBounds[left].min[axis] + itemBounds[left].max[axis] <
+                                itemBounds[right].min[axis] + itemBounds[right].max[axis];
+                     });
+
+    int child = static_cast<int>(nodes.size());
+    nodes.push_back(Node());
+    nodes.push_back(Node());
+    nodes[nodeIndex].first = child;
+    nodes[nodeIndex].count = 0;
+    buildNode(nodes, child, items, itemBounds, first, middle - first);
+    buildNode(nodes, child + 1, items, itemBounds, middle, first + count - middle);
+}
+
+CollisionWorld::Bounds CollisionWorld::sweptBounds(const glm::vec3& center, const glm::vec3& motion, float radius,
+                                                   float time) {
+    glm::vec3 end = center + motion * time;
+    Bounds bounds = { glm::min(center, end) - glm::vec3(radius), glm::max(center, end) + glm::vec3(radius) };
+    return bounds;
+}
+
+// Taranan kutu her temasta kısalır; daha uzaktaki parçalar ve düğümler elenir
+bool CollisionWorld::sweepSphere(const glm::vec3& center, const glm::vec3& motion, float radius, Hit& hit) const {
+    hit.time = 1.0f;
+    hit.normal = glm::vec3(0.0f);
+    hit.piece = -1;
+    if (!built || pieceNodes.empty()) return false;
+
+    Bounds swept = sweptBounds(center, motion, radius, 1.0f);
+    bool found = false;
+    int stack[STACK_SIZE];
+    int top = 0;
+    stack[top++] = 0;
+    while (top > 0) {
+        const Node& node = pieceNodes[stack[--top]];
+        if (!overlaps(node.bounds, swept)) continue;
+        if (node.count == 0) {
+            stack[top++] = node.first;
+            stack[top++] = node.first + 1;
+            continue;
+        }
+        for (int i = node.first; i < node.first + node.count; i++) {
+            int piece = pieceOrder[i];
+            if (overlaps(pieces[piece].bounds, swept) &&
+                sweepPiece(pieces[piece], center, motion, radius, swept, hit)) {
+                hit.piece = piece;
+                found = true;
+            }
+        }
+    }
+    return found;
+}
+
+bool CollisionWorld::sweepPiece(const Piece& piece, const glm::vec3& center, const glm::vec3& motion, float radius,
+                                Bounds& swept, Hit& hit) const {
+    bool found = false;
+    int stack[STACK_SIZE];
+    int top = 0;
+    stack[top++] = piece.root;
+    while (top > 0) {
+        const Node& node = meshNodes[stack[--top]];
+        if (!overlaps(node.bounds, swept)) continue;
+        if (node.count == 0) {
+            stack[top++] = node.first;
+            stack[top++] = node.first + 1;
+            continue;
+        }
+        for (int i = node.first; i < node.first + node.count; i++) {
+            if (sweepTriangle(triangles[i], center, motion, radius, hit)) {
+                swept = sweptBounds(center, motion, radius, hit.time);
+                found = true;
+            }
+        }
+    }
+    return found;
+}
+
+// Önce yüzün içine temas, olmazsa kenarlar (silindir) ve köşeler (küre); hit.time'dan erken
+// bir temas bulunursa hit güncellenir. Üçgen iki yüzlüdür.
+bool CollisionWorld::sweepTriangle(const Triangle& triangle, const glm::vec3& center, const glm::vec3& motion,
+                                   float radius, Hit& hit) {
+    glm::vec3 normal = triangle.normal;
+    float distance = glm::dot(center - triangle.a, normal);
+    if (distance < 0.0f) {
+        normal = -normal;
+        distance = -distance;
+    }
+
+    if (distance < radius) {
+        // Küre üçgene zaten değiyorsa sadece içeri doğru hareket engellenir
+        glm::vec3 offset = center - closestPoint(triangle, center);
+        float lengthSquared = glm::dot(offset, offset);
+        if (lengthSquared < radius * radius) {
+            glm::vec3 away = lengthSquared > 1e-12f ? offset / std::sqrt(lengthSquared) : normal;
+            if (glm::dot(motion, away) >= 0.0f) return false;
+            hit.time = 0.0f;
+            hit.normal = away;
+            return true;
+        }
+    } else {
+        float approach = glm::dot(motion, normal);
+        if (approach >= 0.0f) return false;
+        // Düzleme değme anı her temastan öncedir; o bile geç kalıyorsa kenarlara bakmaya gerek yok
+        float time = (distance - radius) / -approach;
+        if (time >= hit.time) return false;
+        glm::vec3 contact = center + motion * time - normal * radius;
+
+        glm::vec3 edge0 = triangle.b - triangle.a;
+        glm::vec3 edge1 = triangle.c - triangle.a;
+        glm::vec3 toContact = contact - triangle.a;
+        float d00 = glm::dot(edge0, edge0);
+        float d01 = glm::dot(edge0, edge1);
+        float d11 = glm::dot(edge1, edge1);
+        float d20 = glm::dot(toContact, edge0);
+        float d21 = glm::dot(toContact, edge1);
+        float denominator = d00 * d11 - d01 * d01;
+        float v = (d11 * d20 - d01 * d21) / denominator;
+        float w = (d00 * d21 - d01 * d20) / denominator;
+        if (v >= 0.0f && w >= 0.0f && v + w <= 1.0f) {
+            hit.time = time;
+            hit.normal = normal;
+            return true;
+        }
+    }
+
+    float best = hit.time;
+    glm::vec3 bestPoint(0.0f);
+    bool found = false;
+    float motionSquared = glm::dot(motion, motion);
+    const glm::vec3* vertices[3] = { &triangle.a, &triangle.b, &triangle.c };
+
+    for (int i = 0; i < 3; i++) {
+        const glm::vec3& vertex = *vertices[i];
+        glm::vec3 toCenter = center - vertex;
+        float root;
+        if (lowestRoot(motionSquared, 2.0f * glm::dot(motion, toCenter),
+                       glm::dot(toCenter, toCenter) - radius * radius, best, root)) {
+            best = root;
+            bestPoint = vertex;
+            found = true;
+        }
+    }
+
+    for (int i = 0; i < 3; i++) {
+        const glm::vec3& start = *vertices[i];
+        glm::vec3 edge = *vertices[(i + 1) % 3] - start;
+        glm::vec3 base = start - center;
+        float edgeSquared = glm::dot(edge, edge);
+        float edgeMotion = glm::dot(edge, motion);
+        float edgeBase = glm::dot(edge, base);
+        float a = edgeSquared * -motionSquared + edgeMotion * edgeMotion;
+        float b = edgeSquared * 2.0f * glm::dot(motion, base) - 2.0f * edgeMotion * edgeBase;
+        float c = edgeSquared * (radius * radius - glm::dot(base, base)) + edgeBase * edgeBase;
+        float root;
+        if (lowestRoot(a, b, c, best, root)) {
+            // Temas kenar parçasının üzerinde mi
+            float along = (edgeMotion * root - edgeBase) / edgeSquared;
+            if (along >= 0.0f && along <= 1.0f) {
+                best = root;
+                bestPoint = start + edge * along;
+                found = true;
+            }
+        }
+    }
+
+    if (!found) return false;
+    glm::vec3 offset = center + motion * best - bestPoint;
+    float length = glm::length(offset);
+    hit.time = best;
+    hit.normal = length > 1e-12f ? offset / length : normal;
+    return true;
+}
+
+// Üçgen üzerindeki en yakın nokta (köşe, kenar ya da yüz bölgesi)
+glm::vec3 CollisionWorld::closestPoint(const Triangle& triangle, const glm::vec3& point) {
+    const glm::vec3& a = triangle.a;
+    const glm::vec3& b = triangle.b;
+    const glm::vec3& c = triangle.c;
+    glm::vec3 ab = b - a;
+    glm::vec3 ac = c - a;
+    glm::vec3 ap = point - a;
+    float d1 = glm::dot(ab, ap);
+    float d2 = glm::dot(ac, ap);
+    if (d1 <= 0.0f && d2 <= 0.0f) return a;
+
+    glm::vec3 bp = point - b;
+    float d3 = glm::dot(ab, bp);
+    float d4 = glm::dot(ac, bp);
+    if (d3 >= 0.0f && d4 <= d3) return b;
+
+    float vc = d1 * d4 - d3 * d2;
+    if (vc <= 0.0f && d1 >= 0.0f && d3 <= 0.0f) return a + ab * (d1 / (d1 - d3));
+
+    glm::vec3 cp = point - c;
+    float d5 = glm::dot(ab, cp);
+    float d6 = glm::dot(ac, cp);
+    if (d6 >= 0.0f && d5 <= d6) return c;
+
+    float vb = d5 * d2 - d1 * d6;
+    if (vb <= 0.0f && d2 >= 0.0f && d6 <= 0.0f) return a + ac * (d2 / (d2 - d6));
+
+    float va = d3 * d6 - d5 * d4;
+    if (va <= 0.0f && (d4 - d3) >= 0.0f && (d5 - d6) >= 0.0f) {
+        return b + (c - b) * ((d4 - d3) / ((d4 - d3) + (d5 - d6)));
+    }
+
+    float denominator = 1.0f / (va + vb + vc);
+    return a + ab * (vb * denominator) + ac * (vc * denominator);
+}
+
+glm::vec3 CollisionWorld::moveSphere(const glm::vec3& center, const glm::vec3& motion, float radius) const {
+    glm::vec3 position = center;
+    glm::vec3 remaining = motion;
+    for (int slide = 0; slide < MAX_SLIDES; slide++) {
+        if (glm::dot(remaining, remaining) < 1e-12f) break;
+        Hit hit;
+        if (!sweepSphere(position, remaining, radius, hit)) {
+            position += remaining;
+            break;
+        }
+        position += remaining * hit.time + hit.normal * SKIN;
+        remaining *= 1.0f - hit.time;
+        remaining -= hit.normal * glm::dot(remaining, hit.normal);
+    }
+    return position;
+}
+
+void CollisionWorld::moveSpheres(glm::vec3* centers, const glm::vec3* motions, size_t count, float radius) const {
+    JobSystem::instance().parallelFor(0, count, MOVE_GRAIN, [this, centers, motions, radius](size_t first, size_t last) {
+        for (size_t i = first; i < last; i++) {
+            centers[i] = moveSphere(centers[i], motions[i], radius);
+        }
+    });
+}
+
+bool CollisionWorld::overlapsSphere(const glm::vec3& center, float radius) const {
+    if (!built || pieceNodes.empty()) return false;
+    Bounds sphere = sweptBounds(center, glm::vec3(0.0f), radius, 0.0f);
+    int pieceStack[STACK_SIZE];
+    int pieceTop = 0;
+    pieceStack[pieceTop++] = 0;
+    while (pieceTop > 0) {
+        const Node& node = pieceNodes[pieceStack[--pieceTop]];
+        if (!overlaps(node.bounds, sphere)) continue;
+        if (node.count == 0) {
+            pieceStack[pieceTop++] = node.first;
+            pieceStack[pieceTop++] = node.first + 1;
+            continue;
+        }
+        for (int i = node.first; i < node.first + node.count; i++) {
+            int stack[STACK_SIZE];
+            int top = 0;
+            stack[top++] = pieces[pieceOrder[i]].root;
+            while (top > 0) {
+                const Node& meshNode = meshNodes[stack[--top]];
+                if (!overlaps(meshNode.bounds, sphere)) continue;
+                if (meshNode.count == 0) {
+                    stack[top++] = meshNode.first;
+                    stack[top++] = meshNode.first + 1;
+                    continue;
+                }
+                for (int t = meshNode.first; t < meshNode.first + meshNode.count; t++) {
+                    glm::vec3 offset = center - closestPoint(triangles[t], center);
+                    if (glm::dot(offset, offset) < radius * radius) return true;
+                }
+            }
+        }
+    }
+    return false;
+}
+
+bool CollisionWorld::runBenchmarks() {
+    std::mt19937 random(5150);
+    bool valid = true;
+    const float HALL = 120.0f;
+    const float RADIUS = 0.3f;
+    const float HEIGHT = 0.5f;  // ajan merkezinin yüksekliği
+    const float SPEED = 1.5f;
+    const float STEP = 1.0f / 60.0f;
+    const int PIECES = 3000;
+
+    JobSystem::instance().initialize();
+
+    // Salon: dış duvarlar, kaideler (kutu) ve heykel vekilleri (düşük çözünürlüklü küre mesh'leri)
+    CollisionWorld world;
+    world.addBox(glm::vec3(-0.5f, 0.0f, 0.0f), glm::vec3(0.0f, 3.0f, HALL));
+    world.addBox(glm::vec3(HALL, 0.0f, 0.0f), glm::vec3(HALL + 0.5f, 3.0f, HALL));
+    world.addBox(glm::vec3(0.0f, 0.0f, -0.5f), glm::vec3(HALL, 3.0f, 0.0f));
+    world.addBox(glm::vec3(0.0f, 0.0f, HALL), glm::vec3(HALL, 3.0f, HALL + 0.5f));
+    std::uniform_real_distribution<float> coordinate(1.0f, HALL - 1.0f);
+    std::uniform_real_distribution<float> size(0.2f, 0.8f);
+    const int RINGS = 8;
+    const int SEGMENTS = 12;
+    while (static_cast<int>(world.getPieceCount()) < PIECES) {
+        glm::vec3 center(coordinate(random), 0.0f, coordinate(random));
+        float extent = size(random);
+        if (world.getPieceCount() % 3 == 0) {
+            world.addBox(center - glm::vec3(extent, 0.0f, extent), center + glm::vec3(extent, 1.0f, extent));
+            continue;
+        }
+        std::vector<glm::vec3> points;
+        center.y = extent + 0.2f;
+        for (int ring = 0; ring < RINGS; ring++) {
+            float phi0 = glm::pi<float>() * ring / RINGS;
+            float phi1 = glm::pi<float>() * (ring + 1) / RINGS;
+            for (int segment = 0; segment < SEGMENTS; segment++) {
+                float theta0 = glm::two_pi<float>() * segment / SEGMENTS;
+                float theta1 = glm::two_pi<float>() * (segment + 1) / SEGMENTS;
+                auto vertex = [&](float phi, float theta) {
+                    return center + extent * glm::vec3(std::sin(phi) * std::cos(theta), std::cos(phi),
+                                                       std::sin(phi) * std::sin(theta));
+                };
+                points.push_back(vertex(phi0, theta0));
+                points.push_back(vertex(phi1, theta0));
+                points.push_back(vertex(phi1, theta1));
+                points.push_back(vertex(phi0, theta0));
+                points.push_back(vertex(phi1, theta1));
+                points.push_back(vertex(phi0, theta1));
+            }
+        }
+        world.addTriangles(points);
+    }
+    auto start = std::chrono::steady_clock::now();
+    world.build();
+    std::cout << "Çarpışma dünyası: " << world.getPieceCount() << " parça, " << world.getTriangleCount()
+              << " üçgen, kurulum " << elapsedMicroseconds(start) / 1000.0 << " ms, "
+              << JobSystem::instance().getWorkerCount() << " çalışan" << std::endl;
+
+    // 1) Geniş faz ve BVH'ler hiçbir teması kaçırmamalı: tüm üçgenlere kaba kuvvetle karşılaştır
+    {
+        const int SWEEPS = 300;
+        std::uniform_real_distribution<float> reach(-3.0f, 3.0f);
+        int mismatches = 0, hits = 0;
+        double treeTime = 0.0, bruteTime = 0.0;
+        for (int i = 0; i < SWEEPS; i++) {
+            glm::vec3 origin(coordinate(random), HEIGHT, coordinate(random));
+            if (world.overlapsSphere(origin, RADIUS)) continue;
+            glm::vec3 motion(reach(random), 0.0f, reach(random));
+
+            start = std::chrono::steady_clock::now();
+            Hit tree;
+            bool treeHit = world.sweepSphere(origin, motion, RADIUS, tree);
+            treeTime += elapsedMicroseconds(start);
+
+            start = std::chrono::steady_clock::now();
+            Hit brute;
+            brute.time = 1.0f;
+            bool bruteHit = false;
+            for (const Triangle& triangle : world.triangles) {
+                bruteHit |= sweepTriangle(triangle, origin, motion, RADIUS, brute);
+            }
+            bruteTime += elapsedMicroseconds(start);
+
+            hits += treeHit;
+            if (treeHit != bruteHit || (treeHit && std::fabs(tree.time - brute.time) > 1e-4f)) mismatches++;
+        }
+        valid = valid && mismatches == 0;
+        std::cout << "  süpürme doğruluğu: " << (mismatches == 0 ? "TAMAM" : "HATA") << " (" << mismatches
+                  << " fark, " << hits << " temas), BVH " << treeTime / SWEEPS << " us, kaba kuvvet "
+                  << bruteTime / SWEEPS << " us/süpürme" << std::endl;
+    }
+
+    // 2) Ajanlar: her adımda çarp ve kay; engele takılan yön değiştirir
+    const size_t AGENT_COUNTS[3] = { 100, 500, 1000 };
+    const int TICKS = 300;
+    for (size_t agentCount : AGENT_COUNTS) {
+        std::vector<glm::vec3> centers;
+        std::vector<glm::vec3> velocities(agentCount);
+        std::vector<glm::vec3> motions(agentCount);
+        std::uniform_real_distribution<float> angle(0.0f, glm::two_pi<float>());
+        while (centers.size() < agentCount) {
+            glm::vec3 center(coordinate(random), HEIGHT, coordinate(random));
+            if (!world.overlapsSphere(center, RADIUS + SKIN)) centers.push_back(center);
+        }
+        for (glm::vec3& velocity : velocities) {
+            float heading = angle(random);
+            velocity = glm::vec3(std::cos(heading), 0.0f, std::sin(heading)) * SPEED;
+        }
+
+        std::vector<glm::vec3> serial = centers;
+        double serialTime = 0.0, parallelTime = 0.0;
+        int diverged = 0;
+        for (int tick = 0; tick < TICKS; tick++) {
+            for (size_t i = 0; i < agentCount; i++) motions[i] = velocities[i] * STEP;
+
+            start = std::chrono::steady_clock::now();
+            for (size_t i = 0; i < agentCount; i++) {
+                serial[i] = world.moveSphere(serial[i], motions[i], RADIUS);
+            }
+            serialTime += elapsedMicroseconds(start);
+
+            std::vector<glm::vec3> before = centers;
+            start = std::chrono::steady_clock::now();
+            world.moveSpheres(centers.data(), motions.data(), agentCount, RADIUS);
+            parallelTime += elapsedMicroseconds(start);
+
+            for (size_t i = 0; i < agentCount; i++) {
+                if (glm::length(serial[i] - centers[i]) > 1e-5f) diverged++;
+                // Yarı hızdan yavaş ilerleyen ajan engele takılmıştır
+                if (glm::length(centers[i] - before[i]) < SPEED * STEP * 0.5f) {
+                    float heading = angle(random);
+                    velocities[i] = glm::vec3(std::cos(heading), 0.0f, std::sin(heading)) * SPEED;
+                }
+            }
+        }
+
+        int penetrating = 0;
+        for (const glm::vec3& center : centers) {
+            penetrating += world.overlapsSphere(center, RADIUS - 2.0f * SKIN);
+        }
+        bool agentsValid = penetrating == 0 && diverged == 0;
+        valid = valid && agentsValid;
+        std::cout << "  " << agentCount << " ajan: tek çalışan " << serialTime / TICKS << " us/adım, paralel "
+                  << parallelTime / TICKS << " us/adım; doğruluk " << (agentsValid ? "TAMAM" : "HATA")
+                  << " (engele giren " << penetrating << ", sıra farkı " << diverged << ")" << std::endl;
+    }
+    return valid;
+}
@@ -0,0 +1,250 @@
+#include "../include/DynamicResolution.hpp"
+#include "../include/ShaderLibrary.hpp"
+#include "../include/GLStateCache.hpp"
+#include <iostream>
+#include <algorithm>
+#include <cmath>
+
+const float DynamicResolution::MIN_SCALE = 0.5f;
+
+// Ölçek her seferinde bu kadar kare ölçüm biriktikten sonra değiştirilir
+static const int ADJUST_INTERVAL = 10;
+
+DynamicResolution::DynamicResolution()
+    : framebuffer(0), colorTexture(0), depthRenderbuffer(0), emptyVAO(0),
+      outputFramebuffer(0), queryIndex(0), targetWidth(0), targetHeight(0), sceneWidth(0), sceneHeight(0),
+      windowWidth(0), windowHeight(0), enabled(true), scale(1.0f), targetMilliseconds(12.0f),
+      sceneMilliseconds(0.0f), framesSinceAdjust(0) {
+    for (int i = 0; i < 2; i++) {
+        timestampQueries[i][0] = 0;
+        timestampQueries[i][1] = 0;
+        queryIssued[i] = false;
+    }
+}
+
+DynamicResolution::~DynamicResolution() {
+    cleanup();
+}
+
+bool DynamicResolution::initialize(int width, int height, ShaderLibrary& shaderLibrary) {
+    createSharpenShader(shaderLibrary);
+
+    // Tam ekran üçgen gl_VertexID ile üretilir ama core profilde yine de VAO gerekir
+    glGenVertexArrays(1, &emptyVAO);
+
+    for (int i = 0; i < 2; i++) {
+        glGenQueries(2, timestampQueries[i]);
+    }
+
+    windowWidth = width;
+    windowHeight = height;
+    return createTarget(width, height);
+}
+
+void DynamicResolution::cleanup() {
+    destroyTarget();
+    if (emptyVAO != 0) GLStateCache::deleteVertexArrays(1, &emptyVAO);
+    for (int i = 0; i < 2; i++) {
+        if (timestampQueries[i][0] != 0) glDeleteQueries(2, timestampQueries[i]);
+        timestampQueries[i][0] = timestampQueries[i][1] = 0;
+        queryIssued[i] = false;
+    }
+    emptyVAO = 0;
+    sharpenShader = ShaderHandle();
+}
+
+// Doku pencere boyutunda ayrılır; ölçek değişince sadece kullanılan kısım değişir,
+// böylece ölçek ayarlanırken yeniden bellek ayırmak gerekmez
+bool DynamicResolution::createTarget(int width, int height) {
+    destroyTarget();
+    targetWidth = std::max(width, 1);
+    targetHeight = std::max(height, 1);
+
+    glGenTextures(1, &colorTexture);
+    GLStateCache::bindTexture(GL_TEXTURE_2D, colorTexture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, targetWidth, targetHeight, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    GLStateCache::bindTexture(GL_TEXTURE_2D, 0);
+
+    glGenRenderbuffers(1, &depthRenderbuffer);
+    glBindRenderbuffer(GL_RENDERBUFFER, depthRenderbuffer);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, targetWidth, targetHeight);
+    glBindRenderbuffer(GL_RENDERBUFFER, 0);
+
+    glGenFramebuffers(1, &framebuffer);
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, colorTexture, 0);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, depthRenderbuffer);
+    bool complete = glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE;
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+    if (!complete) {
+        std::cerr << "Sahne framebuffer'ı oluşturulamadı!" << std::endl;
+        destroyTarget();
+        return false;
+    }
+    return true;
+}
+
+void DynamicResolution::destroyTarget() {
+    if (framebuffer != 0) glDeleteFramebuffers(1, &framebuffer);
+    if (colorTexture != 0) GLStateCache::deleteTextures(1, &colorTexture);
+    if (depthRenderbuffer != 0) glDeleteRenderbuffers(1, &depthRenderbuffer);
+    framebuffer = 0;
+    colorTexture = 0;
+    depthRenderbuffer = 0;
+}
+
+void DynamicResolution::setEnabled(bool value) {
+    enabled = value;
+    if (!enabled) {
+        scale = 1.0f;
+    }
+    framesSinceAdjust = 0;
+}
+
+void DynamicResolution::beginScene(int width, int height) {
+    windowWidth = width;
+    windowHeight = height;
+    if (width != targetWidth || height != targetHeight) {
+        createTarget(width, height);
+    }
+
+    collectTiming();
+    if (enabled) {
+        adjustScale();
+    }
+
+    sceneWidth = std::max(1, static_cast<int>(std::lround(targetWidth * scale)));
+    sceneHeight = std::max(1, static_cast<int>(std::lround(targetHeight * scale)));
+
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+    glViewport(0, 0, sceneWidth, sceneHeight);
+    glQueryCounter(timestampQueries[queryIndex][0], GL_TIMESTAMP);
+}
+
+void DynamicResolution::endScene() {
+    glQueryCounter(timestampQueries[queryIndex][1], GL_TIMESTAMP);
+    queryIssued[queryIndex] = true;
+    queryIndex = (queryIndex + 1) % 2;
+
+    glBindFramebuffer(GL_FRAMEBUFFER, outputFramebuffer);
+    glViewport(0, 0, windowWidth, windowHeight);
+}
+
+// Bu kare yeniden kullanılacak sorgu çiftinin sonucu hazırsa okunur, değilse atlanır
+void DynamicResolution::collectTiming() {
+    if (!queryIssued[queryIndex]) return;
+    queryIssued[queryIndex] = false;
+
+    GLint available = 0;
+    glGetQueryObjectiv(timestampQueries[queryIndex][1], GL_QUERY_RESULT_AVAILABLE, &available);
+    if (!available) return;
+
+    GLuint64 start = 0, end = 0;
+    glGetQueryObjectui64v(timestampQueries[queryIndex][0], GL_QUERY_RESULT, &start);
+    glGetQueryObjectui64v(timestampQueries[queryIndex][1], GL_QUERY_RESULT, &end);
+    float milliseconds = (end - start) / 1000000.0f;
+
+    sceneMilliseconds = sceneMilliseconds == 0.0f ? milliseconds : sceneMilliseconds * 0.8f + milliseconds * 0.2f;
+    framesSinceAdjust++;
+}
+
+// Piksel sayısı süreyle orantılı kabul edilir; bu yüzden kenar ölçeği sürenin
+// karekökü oranında değişir. Ani sıçramaları önlemek için adım sınırlandırılır.
+void DynamicResolution::adjustScale() {
+    if (framesSinceAdjust < ADJUST_INTERVAL || sceneMilliseconds <= 0.0f) return;
+    framesSinceAdjust = 0;
+
+    float ratio = std::sqrt(targetMilliseconds / sceneMilliseconds);
+    if (sceneMilliseconds > targetMilliseconds) {
+        scale *= std::max(ratio, 0.9f);
+    } else if (sceneMilliseconds < targetMilliseconds * 0.8f) {
+        scale *= std::min(ratio, 1.05f);
+    }
+    scale = std::clamp(scale, MIN_SCALE, 1.0f);
+}
+
+void DynamicResolution::present() {
+    // Derleme ilk karede sonuçlanır; başarısızsa sahne keskinleştirmeden büyütülür
+    GLuint sharpenProgram = sharpenShader.get();
+    if (sharpenProgram == 0) {
+        glBindFramebuffer(GL_READ_FRAMEBUFFER, framebuffer);
+        glBlitFramebuffer(0, 0, sceneWidth, sceneHeight, 0, 0, windowWidth, windowHeight, GL_COLOR_BUFFER_BIT, GL_LINEAR);
+        glBindFramebuffer(GL_READ_FRAMEBUFFER, outputFramebuffer);
+        return;
+    }
+
+    GLStateCache::disable(GL_DEPTH_TEST);
+    GLStateCache::useProgram(sharpenProgram);
+
+    GLStateCache::activeTexture(GL_TEXTURE0);
+    GLStateCache::bindTexture(GL_TEXTURE_2D, colorTexture);
+    GLStateCache::uniform1i(glGetUniformLocation(sharpenProgram, "sceneTexture"), 0);
+
+    // Sadece dokunun kullanılan kısmı örneklenir
+    GLStateCache::uniform2f(glGetUniformLocation(sharpenProgram, "uvScale"),
+                static_cast<float>(sceneWidth) / targetWidth, static_cast<float>(sceneHeight) / targetHeight);
+    GLStateCache::uniform2f(glGetUniformLocation(sharpenProgram, "texelSize"), 1.0f / targetWidth, 1.0f / targetHeight);
+
+    // Tam çözünürlükte keskinleştirmeye gerek yok; ölçek düştükçe artar
+    float sharpness = (1.0f - scale) / (1.0f - MIN_SCALE) * 0.6f;
+    GLStateCache::uniform1f(glGetUniformLocation(sharpenProgram, "sharpness"), sharpness);
+
+    GLStateCache::bindVertexArray(emptyVAO);
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+    GLStateCache::bindVertexArray(0);
+
+    GLStateCache::enable(GL_DEPTH_TEST);
+}
+
+void DynamicResolution::createSharpenShader(ShaderLibrary& shaderLibrary) {
+    const char* vertexShaderSource = R"(
+        #version 330 core
+        out vec2 TexCoords;
+
+        void main() {
+            vec2 position = vec2((gl_VertexID << 1) & 2, gl_VertexID & 2);
+            TexCoords = position;
+            gl_Position = vec4(position * 2.0 - 1.0, 0.0, 1.0);
+        }
+    )";
+
+    // Komşu ortalamasına göre keskinleştirir, sonucu komşuların aralığına
+    // sıkıştırarak kenarlarda hale oluşmasını engeller
+    const char* fragmentShaderSource = R"(
+        #version 330 core
+        out vec4 FragColor;
+        in vec2 TexCoords;
+
+        uniform sampler2D sceneTexture;
+        uniform vec2 uvScale;
+        uniform vec2 texelSize;
+        uniform float sharpness;
+
+        vec3 fetch(vec2 uv) {
+            return texture(sceneTexture, clamp(uv, texelSize * 0.5, uvScale - texelSize * 0.5)).rgb;
+        }
+
+        void main() {
+            vec2 uv = TexCoords * uvScale;
+            vec3 center = fetch(uv);
+            vec3 north = fetch(uv + vec2(0.0, texelSize.y));
+            vec3 south = fetch(uv - vec2(0.0, texelSize.y));
+            vec3 east = fetch(uv + vec2(texelSize.x, 0.0));
+            vec3 west = fetch(uv - vec2(texelSize.x, 0.0));
+
+            vec3 blurred = (north + south + east + west) * 0.25;
+            vec3 sharpened = center + (center - blurred) * sharpness;
+
+            vec3 lowest = min(center, min(min(north, south), min(east, west)));
+            vec3 highest = max(center, max(max(north, south), max(east, west)));
+            FragColor = vec4(clamp(sharpened, lowest, highest), 1.0);
+        }
+    )";
+
+    sharpenShader = shaderLibrary.request(vertexShaderSource, fragmentShaderSource);
+}
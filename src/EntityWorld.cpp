@@ -0,0 +1,237 @@
+#include "../include/EntityWorld.hpp"
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+
+// Parçalar önbellek satırına hizalı ayrılır
+const size_t CHUNK_ALIGNMENT = 64;
+
+static size_t alignUp(size_t value, size_t alignment) {
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+EntityWorld::EntityWorld() : entityCount(0) {
+}
+
+EntityWorld::~EntityWorld() {
+    clear();
+}
+
+std::vector<EntityWorld::ComponentInfo>& EntityWorld::componentInfos() {
+    static std::vector<ComponentInfo> infos;
+    return infos;
+}
+
+ComponentId EntityWorld::registerComponent(size_t size, size_t alignment) {
+    // Bileşenler ilk kez ana thread'de kullanılmalı; kayıt tablosu kilitsizdir
+    std::vector<ComponentInfo>& infos = componentInfos();
+    if (infos.size() >= static_cast<size_t>(MAX_COMPONENTS)) {
+        std::cerr << "Bileşen türü sınırı aşıldı: en fazla " << MAX_COMPONENTS << std::endl;
+        std::abort();
+    }
+    ComponentInfo info;
+    info.size = size;
+    info.alignment = alignment;
+    infos.push_back(info);
+    return static_cast<ComponentId>(infos.size() - 1);
+}
+
+EntityWorld::Archetype* EntityWorld::findArchetype(ComponentMask mask) {
+    for (Archetype* archetype : archetypes) {
+        if (archetype->mask == mask) return archetype;
+    }
+
+    const std::vector<ComponentInfo>& infos = componentInfos();
+    Archetype* archetype = new Archetype();
+    archetype->mask = mask;
+    std::fill(archetype->offsets, archetype->offsets + MAX_COMPONENTS, 0);
+
+    // Varlık başına bayt; hizalama payı için kapasite sığana kadar küçültülür
+    size_t bytesPerEntity = sizeof(Entity);
+    for (int id = 0; id < MAX_COMPONENTS; id++) {
+        if (mask & (1u << id)) bytesPerEntity += infos[id].size;
+    }
+    size_t capacity = CHUNK_SIZE / bytesPerEntity;
+    while (capacity > 1) {
+        size_t offset = sizeof(Entity) * capacity;
+        for (int id = 0; id < MAX_COMPONENTS; id++) {
+            if (!(mask & (1u << id))) continue;
+            offset = alignUp(offset, infos[id].alignment);
+            archetype->offsets[id] = offset;
+            offset += infos[id].size * capacity;
+        }
+        if (offset <= CHUNK_SIZE) break;
+        capacity--;
+    }
+    archetype->capacity = static_cast<uint32_t>(capacity);
+
+    archetypes.push_back(archetype);
+    return archetype;
+}
+
+Entity EntityWorld::allocateEntity(Archetype* archetype) {
+    uint32_t index;
+    if (!freeIndices.empty()) {
+        index = freeIndices.back();
+        freeIndices.pop_back();
+    } else {
+        index = static_cast<uint32_t>(records.size());
+        Record record;
+        record.archetype = nullptr;
+        record.chunk = 0;
+        record.row = 0;
+        record.generation = 0;
+        records.push_back(record);
+    }
+
+    Record& record = records[index];
+    record.archetype = archetype;
+    allocateRow(archetype, record.chunk, record.row);
+
+    Entity entity(index, record.generation);
+    entitiesOf(archetype->chunks[record.chunk])[record.row] = entity;
+    entityCount++;
+    return entity;
+}
+
+void EntityWorld::allocateRow(Archetype* archetype, uint32_t& chunk, uint32_t& row) {
+    if (archetype->chunks.empty() || archetype->chunks.back().count == archetype->capacity) {
+        Chunk newChunk;
+        newChunk.data = static_cast<unsigned char*>(::operator new(CHUNK_SIZE, std::align_val_t(CHUNK_ALIGNMENT)));
+        newChunk.count = 0;
+        archetype->chunks.push_back(newChunk);
+    }
+    chunk = static_cast<uint32_t>(archetype->chunks.size() - 1);
+    row = archetype->chunks.back().count++;
+}
+
+void EntityWorld::releaseRow(Archetype* archetype, uint32_t chunk, uint32_t row) {
+    const std::vector<ComponentInfo>& infos = componentInfos();
+    uint32_t lastChunk = static_cast<uint32_t>(archetype->chunks.size() - 1);
+    Chunk& last = archetype->chunks[lastChunk];
+    uint32_t lastRow = last.count - 1;
+
+    // Delik son satırla kapatılır; böylece parçalar boşluksuz kalır
+    if (chunk != lastChunk || row != lastRow) {
+        Chunk& target = archetype->chunks[chunk];
+        Entity moved = entitiesOf(last)[lastRow];
+        entitiesOf(target)[row] = moved;
+        for (int id = 0; id < MAX_COMPONENTS; id++) {
+            if (!(archetype->mask & (1u << id))) continue;
+            std::memcpy(componentAt(archetype, target, id, row), componentAt(archetype, last, id, lastRow), infos[id].size);
+        }
+        records[moved.index].chunk = chunk;
+        records[moved.index].row = row;
+    }
+
+    last.count--;
+    if (last.count == 0) {
+        ::operator delete(last.data, std::align_val_t(CHUNK_ALIGNMENT));
+        archetype->chunks.pop_back();
+    }
+}
+
+void EntityWorld::moveEntity(Entity entity, ComponentMask newMask) {
+    const std::vector<ComponentInfo>& infos = componentInfos();
+    Record& record = records[entity.index];
+    Archetype* source = record.archetype;
+    Archetype* target = findArchetype(newMask);
+
+    uint32_t chunk, row;
+    allocateRow(target, chunk, row);
+    Chunk& to = target->chunks[chunk];
+    const Chunk& from = source->chunks[record.chunk];
+    entitiesOf(to)[row] = entity;
+
+    // İki arketipte ortak olan bileşenler kopyalanır; yeni eklenen bileşeni çağıran yazar
+    ComponentMask shared = source->mask & newMask;
+    for (int id = 0; id < MAX_COMPONENTS; id++) {
+        if (!(shared & (1u << id))) continue;
+        std::memcpy(componentAt(target, to, id, row), componentAt(source, from, id, record.row), infos[id].size);
+    }
+
+    releaseRow(source, record.chunk, record.row);
+    record.archetype = target;
+    record.chunk = chunk;
+    record.row = row;
+}
+
+void EntityWorld::destroy(Entity entity) {
+    if (!recordOf(entity)) return;
+    Record& record = records[entity.index];
+    releaseRow(record.archetype, record.chunk, record.row);
+    record.archetype = nullptr;
+    record.generation++;
+    freeIndices.push_back(entity.index);
+    entityCount--;
+}
+
+bool EntityWorld::isAlive(Entity entity) const {
+    return recordOf(entity) != nullptr;
+}
+
+void EntityWorld::clear() {
+    for (Archetype* archetype : archetypes) {
+        for (const Chunk& chunk : archetype->chunks) {
+            ::operator delete(chunk.data, std::align_val_t(CHUNK_ALIGNMENT));
+        }
+        delete archetype;
+    }
+    archetypes.clear();
+    queryChunks.clear();
+
+    // Eski tutamaçlar geçersiz kalsın diye kayıtlar silinmez, nesilleri artırılır
+    freeIndices.clear();
+    for (size_t i = records.size(); i-- > 0;) {
+        if (records[i].archetype) {
+            records[i].archetype = nullptr;
+            records[i].generation++;
+        }
+        freeIndices.push_back(static_cast<uint32_t>(i));
+    }
+    entityCount = 0;
+}
+
+size_t EntityWorld::getChunkCount() const {
+    size_t chunks = 0;
+    for (const Archetype* archetype : archetypes) {
+        chunks += archetype->chunks.size();
+    }
+    return chunks;
+}
+
+size_t EntityWorld::count(ComponentMask mask) const {
+    size_t total = 0;
+    for (const Archetype* archetype : archetypes) {
+        if ((archetype->mask & mask) != mask) continue;
+        for (const Chunk& chunk : archetype->chunks) {
+            total += chunk.count;
+        }
+    }
+    return total;
+}
+
+void* EntityWorld::componentAt(const Archetype* archetype, const Chunk& chunk, ComponentId id, uint32_t row) const {
+    return chunk.data + archetype->offsets[id] + componentInfos()[id].size * row;
+}
+
+const EntityWorld::Record* EntityWorld::recordOf(Entity entity) const {
+    if (entity.index >= records.size()) return nullptr;
+    const Record& record = records[entity.index];
+    if (!record.archetype || record.generation != entity.generation) return nullptr;
+    return &record;
+}
+
+void EntityWorld::collectChunks(ComponentMask mask) {
+    queryChunks.clear();
+    for (Archetype* archetype : archetypes) {
+        if ((archetype->mask & mask) != mask) continue;
+        for (size_t i = 0; i < archetype->chunks.size(); i++) {
+            ChunkRef ref;
+            ref.archetype = archetype;
+            ref.chunk = static_cast<uint32_t>(i);
+            queryChunks.push_back(ref);
+        }
+    }
+}
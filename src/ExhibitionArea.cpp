@@ -1,20 +1,21 @@
 #include "../include/ExhibitionArea.hpp"
+#include "../include/ShaderLibrary.hpp"
+#include "../include/GLStateCache.hpp"
 #include <iostream>
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtc/type_ptr.hpp>
 
 // Sergi alanını kurma
-ExhibitionArea::ExhibitionArea() : shaderProgram(0) {
+ExhibitionArea::ExhibitionArea() {
 }
 
-// Shader'ları silme
+// Program ShaderLibrary'ye ait, onunla silinir
 ExhibitionArea::~ExhibitionArea() {
-    glDeleteProgram(shaderProgram);
 }
 
 // Sergi alanını başlatma
-bool ExhibitionArea::initialize() {
-    createShaders();
+bool ExhibitionArea::initialize(ShaderLibrary& shaderLibrary) {
+    createShaders(shaderLibrary);
     
     placeObjects();
     
@@ -23,13 +24,15 @@ bool ExhibitionArea::initialize() {
 
 // Sergi alanını ekrana çizer
 void ExhibitionArea::render(const glm::mat4& viewMatrix, const glm::mat4& projectionMatrix) {
-    glUseProgram(shaderProgram);
+    // Derleme ilk çizimde sonuçlanır
+    GLuint shaderProgram = shader.get();
+    GLStateCache::useProgram(shaderProgram);
     
     GLint viewLoc = glGetUniformLocation(shaderProgram, "view");
     GLint projLoc = glGetUniformLocation(shaderProgram, "projection");
     
-    glUniformMatrix4fv(viewLoc, 1, GL_FALSE, glm::value_ptr(viewMatrix));
-    glUniformMatrix4fv(projLoc, 1, GL_FALSE, glm::value_ptr(projectionMatrix));
+    GLStateCache::uniformMatrix4fv(viewLoc, 1, GL_FALSE, glm::value_ptr(viewMatrix));
+    GLStateCache::uniformMatrix4fv(projLoc, 1, GL_FALSE, glm::value_ptr(projectionMatrix));
     
     for (const auto& statue : statues) {
         statue->render(viewMatrix, projectionMatrix, shaderProgram);
@@ -52,6 +55,7 @@ Statue& ExhibitionArea::loadModel(const std::string& filePath,
         std::cerr << "Heykel başlatılamadı: " << filePath << std::endl;
     }
     
+    statueIndex.insert(statue->getPosition(), 0.0f);
     statues.push_back(std::move(statue));
     return *statues.back();
 }
@@ -61,7 +65,7 @@ const std::vector<std::unique_ptr<Statue>>& ExhibitionArea::getStatues() const {
 }
 
 // Işık ve gölge efektlerini  oluşturur
-void ExhibitionArea::createShaders() {
+void ExhibitionArea::createShaders(ShaderLibrary& shaderLibrary) {
     const char* vertexShaderSource = R"(
         #version 330 core
         layout (location = 0) in vec3 aPos;
@@ -75,10 +79,11 @@ void ExhibitionArea::createShaders() {
         uniform mat4 model;
         uniform mat4 view;
         uniform mat4 projection;
+        uniform mat3 normalMatrix;
         
         void main() {
             FragPos = vec3(model * vec4(aPos, 1.0));
-            Normal = mat3(transpose(inverse(model))) * aNormal;
+            Normal = normalMatrix * aNormal;
             TexCoord = aTexCoord;
             
             gl_Position = projection * view * model * vec4(aPos, 1.0);
@@ -120,41 +125,7 @@ void ExhibitionArea::createShaders() {
         }
     )";
     
-    GLuint vertexShader = glCreateShader(GL_VERTEX_SHADER);
-    glShaderSource(vertexShader, 1, &vertexShaderSource, NULL);
-    glCompileShader(vertexShader);
-    
-    int success;
-    char infoLog[512];
-    glGetShaderiv(vertexShader, GL_COMPILE_STATUS, &success);
-    if (!success) {
-        glGetShaderInfoLog(vertexShader, 512, NULL, infoLog);
-        std::cerr << "ERROR::SHADER::VERTEX::COMPILATION_FAILED\n" << infoLog << std::endl;
-    }
-    
-    GLuint fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
-    glShaderSource(fragmentShader, 1, &fragmentShaderSource, NULL);
-    glCompileShader(fragmentShader);
-    
-    glGetShaderiv(fragmentShader, GL_COMPILE_STATUS, &success);
-    if (!success) {
-        glGetShaderInfoLog(fragmentShader, 512, NULL, infoLog);
-        std::cerr << "ERROR::SHADER::FRAGMENT::COMPILATION_FAILED\n" << infoLog << std::endl;
-    }
-    
-    shaderProgram = glCreateProgram();
-    glAttachShader(shaderProgram, vertexShader);
-    glAttachShader(shaderProgram, fragmentShader);
-    glLinkProgram(shaderProgram);
-    
-    glGetProgramiv(shaderProgram, GL_LINK_STATUS, &success);
-    if (!success) {
-        glGetProgramInfoLog(shaderProgram, 512, NULL, infoLog);
-        std::cerr << "ERROR::SHADER::PROGRAM::LINKING_FAILED\n" << infoLog << std::endl;
-    }
-    
-    glDeleteShader(vertexShader);
-    glDeleteShader(fragmentShader);
+    shader = shaderLibrary.request(vertexShaderSource, fragmentShaderSource);
 }
 
 // Heykelleri sahneye yerleştirir.bilgiler hazir
@@ -0,0 +1,47 @@
+#include "../include/FixedTimestep.hpp"
+#include <cmath>
+
+static const double DEFAULT_TICK_RATE = 60.0;
+
+// Duraklatma ya da hata ayıklayıcıda beklemeden sonra tek karede gelen dev süreler kırpılır
+static const double MAX_FRAME_SECONDS = 0.25;
+
+FixedTimestep::FixedTimestep(double tickRate, int maxSteps)
+    : step(1.0 / DEFAULT_TICK_RATE), accumulator(0.0), maxSteps(1), tickCount(0), droppedSeconds(0.0) {
+    setTickRate(tickRate);
+    setMaxSteps(maxSteps);
+}
+
+void FixedTimestep::setTickRate(double tickRate) {
+    if (!(tickRate > 0.0) || !std::isfinite(tickRate)) {
+        tickRate = DEFAULT_TICK_RATE;
+    }
+    step = 1.0 / tickRate;
+}
+
+int FixedTimestep::advance(double frameSeconds) {
+    if (!(frameSeconds > 0.0)) {
+        frameSeconds = 0.0;
+    }
+    if (frameSeconds > MAX_FRAME_SECONDS) {
+        droppedSeconds += frameSeconds - MAX_FRAME_SECONDS;
+        frameSeconds = MAX_FRAME_SECONDS;
+    }
+    accumulator += frameSeconds;
+
+    int steps = 0;
+    while (accumulator >= step && steps < maxSteps) {
+        accumulator -= step;
+        steps++;
+    }
+
+    // Sınıra takıldıysa tam adımlar atılır, kesirli kısım interpolasyon için kalır
+    if (accumulator >= step) {
+        double excess = std::floor(accumulator / step) * step;
+        droppedSeconds += excess;
+        accumulator -= excess;
+    }
+
+    tickCount += steps;
+    return steps;
+}
@@ -0,0 +1,217 @@
+#include "../include/FlightRecorder.hpp"
+#include "../include/Tracer.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <ctime>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+
+const double FlightRecorder::WINDOW_SECONDS = 5.0;
+const double FlightRecorder::DUMP_COOLDOWN_SECONDS = 30.0;
+const double FlightRecorder::WARMUP_SECONDS = 5.0;
+
+// Kare satırı izleyicide profiler thread'lerinden ayrı görünsün
+static const int FRAME_THREAD_ID = 998;
+
+FlightRecorder::FlightRecorder()
+    : frameCount(0), frameStart(0), firstFrameStart(0), recordPending(false), drawCalls(0), stateChanges(0), triangles(0),
+      thresholdMilliseconds(0.0), lastDumpTime(0), dumpCount(0), pendingHitchFrame(0), dumpPending(false),
+      stopping(false) {
+}
+
+FlightRecorder::~FlightRecorder() {
+    shutdown();
+}
+
+// Tamponlar baştan ayrılır; kare döngüsünde bellek ayrımı yapılmaz
+bool FlightRecorder::initialize(const std::string& directory, double thresholdMilliseconds) {
+    this->directory = directory;
+    this->thresholdMilliseconds = thresholdMilliseconds;
+    frames.resize(CAPACITY);
+    pendingFrames.reserve(CAPACITY);
+
+    try {
+        writer = std::thread(&FlightRecorder::writerLoop, this);
+    } catch (const std::exception& e) {
+        std::cerr << "Uçuş kaydedicisi başlatılamadı: " << e.what() << std::endl;
+        return false;
+    }
+    return true;
+}
+
+void FlightRecorder::shutdown() {
+    if (!writer.joinable()) return;
+    {
+        std::lock_guard<std::mutex> lock(writerMutex);
+        stopping = true;
+    }
+    writerWake.notify_one();
+    writer.join();
+}
+
+void FlightRecorder::beginFrame() {
+    uint64_t now = Tracer::now();
+
+    // Bölgeler Profiler'da bir kare gecikmeyle toplanır; bu yüzden takılma kontrolü burada
+    if (recordPending) {
+        FrameRecord& record = frames[(frameCount - 1) % CAPACITY];
+        const std::vector<Profiler::Event>& events = Profiler::instance().getLastFrameEvents();
+        record.zoneCount = static_cast<int>(std::min<size_t>(events.size(), MAX_ZONES));
+        std::copy(events.begin(), events.begin() + record.zoneCount, record.zones);
+        recordPending = false;
+
+        bool warmedUp = (record.start - firstFrameStart) / 1e9 >= WARMUP_SECONDS;
+        if (warmedUp && record.milliseconds > thresholdMilliseconds) {
+            requestDump(record);
+        }
+    }
+
+    if (frameCount == 0) {
+        firstFrameStart = now;
+    }
+    frameStart = now;
+}
+
+void FlightRecorder::endFrame(const FrameSample& sample) {
+    FrameRecord& record = frames[frameCount % CAPACITY];
+    record.frameIndex = frameCount;
+    record.start = frameStart;
+    record.milliseconds = sample.milliseconds;
+    record.deltaTime = sample.deltaTime;
+    record.robotPosition = sample.robotPosition;
+    record.activeStatue = sample.activeStatue;
+    record.scanning = sample.scanning;
+    std::snprintf(record.heldKeys, sizeof(record.heldKeys), "%s", sample.heldKeys ? sample.heldKeys : "");
+    record.inputEvents = sample.inputEvents;
+    record.drawCalls = drawCalls.load(std::memory_order_relaxed);
+    record.stateChanges = stateChanges.load(std::memory_order_relaxed);
+    record.triangles = triangles.load(std::memory_order_relaxed);
+    record.zoneCount = 0;
+
+    frameCount++;
+    recordPending = true;
+}
+
+// Render thread açıksa sayaçlar bir önceki çizilen kareye aittir
+void FlightRecorder::recordRenderStats(const GLStats::Counters& counters) {
+    drawCalls.store(counters.drawCalls, std::memory_order_relaxed);
+    stateChanges.store(counters.stateChanges, std::memory_order_relaxed);
+    triangles.store(counters.triangles, std::memory_order_relaxed);
+}
+
+// Yazıcı meşgulse ya da bekleme süresi dolmadıysa kare döngüsü hiç beklemeden devam eder
+void FlightRecorder::requestDump(const FrameRecord& hitch) {
+    if (dumpCount >= MAX_DUMPS) return;
+    if (lastDumpTime != 0 && (hitch.start - lastDumpTime) / 1e9 < DUMP_COOLDOWN_SECONDS) return;
+
+    std::unique_lock<std::mutex> lock(writerMutex, std::try_to_lock);
+    if (!lock.owns_lock() || dumpPending) return;
+
+    uint64_t windowStart = hitch.start - std::min<uint64_t>(hitch.start, static_cast<uint64_t>(WINDOW_SECONDS * 1e9));
+    pendingFrames.clear();
+    uint64_t oldest = frameCount > CAPACITY ? frameCount - CAPACITY : 0;
+    for (uint64_t i = oldest; i < frameCount; i++) {
+        const FrameRecord& record = frames[i % CAPACITY];
+        if (record.start >= windowStart) {
+            pendingFrames.push_back(record);
+        }
+    }
+    pendingHitchFrame = hitch.frameIndex;
+    dumpPending = true;
+    lastDumpTime = hitch.start;
+    dumpCount++;
+
+    lock.unlock();
+    writerWake.notify_one();
+}
+
+void FlightRecorder::writerLoop() {
+    std::vector<FrameRecord> window;
+    window.reserve(CAPACITY);
+
+    std::unique_lock<std::mutex> lock(writerMutex);
+    while (true) {
+        writerWake.wait(lock, [this] { return dumpPending || stopping; });
+        if (!dumpPending) break;
+
+        window.swap(pendingFrames);
+        uint64_t hitchFrame = pendingHitchFrame;
+        lock.unlock();
+        writeDump(window, hitchFrame);
+        window.clear();
+        lock.lock();
+        dumpPending = false;
+    }
+}
+
+static void writeTime(std::ofstream& out, const char* key, uint64_t nanoseconds) {
+    char text[32];
+    std::snprintf(text, sizeof(text), "%.3f", nanoseconds / 1000.0);
+    out << ",\"" << key << "\":" << text;
+}
+
+bool FlightRecorder::writeDump(const std::vector<FrameRecord>& window, uint64_t hitchFrame) {
+    if (window.empty()) return false;
+
+    std::error_code error;
+    std::filesystem::create_directories(directory, error);
+
+    char stamp[32];
+    std::time_t wallClock = std::time(nullptr);
+    std::strftime(stamp, sizeof(stamp), "%Y%m%d_%H%M%S", std::localtime(&wallClock));
+    char fileName[96];
+    std::snprintf(fileName, sizeof(fileName), "/hitch_%s_frame%llu.json", stamp,
+                  static_cast<unsigned long long>(hitchFrame));
+    std::string path = directory + fileName;
+
+    std::ofstream out(path);
+    if (!out) {
+        std::cerr << "Takılma kaydı yazılamadı: " << path << std::endl;
+        return false;
+    }
+
+    uint64_t origin = window.front().start;
+    out << "{\"otherData\":{\"threshold_ms\":" << thresholdMilliseconds << ",\"hitch_frame\":" << hitchFrame << "},\n";
+    out << "\"traceEvents\":[\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << FRAME_THREAD_ID
+        << ",\"args\":{\"name\":\"frames\"}}";
+
+    for (const FrameRecord& frame : window) {
+        uint64_t start = frame.start - origin;
+        out << ",\n{\"name\":\"frame\",\"ph\":\"X\",\"pid\":1,\"tid\":" << FRAME_THREAD_ID;
+        writeTime(out, "ts", start);
+        writeTime(out, "dur", static_cast<uint64_t>(frame.milliseconds * 1e6));
+        out << ",\"args\":{\"frame\":" << frame.frameIndex << ",\"ms\":" << frame.milliseconds
+            << ",\"dt\":" << frame.deltaTime << ",\"keys\":\"" << frame.heldKeys << "\""
+            << ",\"input_events\":" << frame.inputEvents << ",\"draw_calls\":" << frame.drawCalls
+            << ",\"state_changes\":" << frame.stateChanges << ",\"triangles\":" << frame.triangles
+            << ",\"robot\":[" << frame.robotPosition.x << "," << frame.robotPosition.y << ","
+            << frame.robotPosition.z << "],\"statue\":" << frame.activeStatue
+            << ",\"scanning\":" << (frame.scanning ? "true" : "false") << "}}";
+
+        out << ",\n{\"name\":\"frame_ms\",\"ph\":\"C\",\"pid\":1";
+        writeTime(out, "ts", start);
+        out << ",\"args\":{\"value\":" << frame.milliseconds << "}}";
+
+        if (frame.frameIndex == hitchFrame) {
+            out << ",\n{\"name\":\"hitch\",\"ph\":\"i\",\"s\":\"g\",\"pid\":1,\"tid\":" << FRAME_THREAD_ID;
+            writeTime(out, "ts", start);
+            out << "}";
+        }
+
+        // Bölge adları kaynaktaki sabit metinlerdir, kaçış gerektirmez
+        for (int i = 0; i < frame.zoneCount; i++) {
+            const Profiler::Event& zone = frame.zones[i];
+            if (zone.start < origin) continue;
+            out << ",\n{\"name\":\"" << zone.name << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << zone.threadIndex;
+            writeTime(out, "ts", zone.start - origin);
+            writeTime(out, "dur", zone.end - zone.start);
+            out << "}";
+        }
+    }
+    out << "\n]}\n";
+
+    std::cout << "Takılma kaydedildi (" << window.size() << " kare): " << path << std::endl;
+    return true;
+}
@@ -0,0 +1,170 @@
+#include "../include/FrameCapture.hpp"
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+FrameCapture::FrameCapture() : framebuffer(0), colorRenderbuffer(0), width(0), height(0) {
+}
+
+FrameCapture::~FrameCapture() {
+    cleanup();
+}
+
+// Derinlik gerekmez; sahne derinliği DynamicResolution'ın kendi hedefinde kalır
+bool FrameCapture::initialize(int targetWidth, int targetHeight) {
+    cleanup();
+    width = targetWidth;
+    height = targetHeight;
+
+    glGenRenderbuffers(1, &colorRenderbuffer);
+    glBindRenderbuffer(GL_RENDERBUFFER, colorRenderbuffer);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, width, height);
+    glBindRenderbuffer(GL_RENDERBUFFER, 0);
+
+    glGenFramebuffers(1, &framebuffer);
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, colorRenderbuffer);
+    bool complete = glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE;
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+    if (!complete) {
+        std::cerr << "Görüntü yakalama framebuffer'ı oluşturulamadı!" << std::endl;
+        cleanup();
+        return false;
+    }
+    return true;
+}
+
+void FrameCapture::cleanup() {
+    if (framebuffer != 0) glDeleteFramebuffers(1, &framebuffer);
+    if (colorRenderbuffer != 0) glDeleteRenderbuffers(1, &colorRenderbuffer);
+    framebuffer = 0;
+    colorRenderbuffer = 0;
+}
+
+bool FrameCapture::capture(const std::string& path) {
+    pixels.resize(static_cast<size_t>(width) * height * 4);
+
+    GLint previous = 0;
+    glGetIntegerv(GL_READ_FRAMEBUFFER_BINDING, &previous);
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, framebuffer);
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, previous);
+
+    // OpenGL satırları alttan başlar, PNG üstten
+    size_t rowSize = static_cast<size_t>(width) * 4;
+    std::vector<unsigned char> row(rowSize);
+    for (int y = 0; y < height / 2; y++) {
+        unsigned char* top = pixels.data() + y * rowSize;
+        unsigned char* bottom = pixels.data() + (height - 1 - y) * rowSize;
+        std::memcpy(row.data(), top, rowSize);
+        std::memcpy(top, bottom, rowSize);
+        std::memcpy(bottom, row.data(), rowSize);
+    }
+
+    if (!writePNG(path, width, height, pixels.data())) {
+        std::cerr << "Kare kaydedilemedi: " << path << std::endl;
+        return false;
+    }
+    return true;
+}
+
+static uint32_t crc32(const unsigned char* data, size_t length, uint32_t crc = 0) {
+    static uint32_t table[256];
+    static bool tableReady = false;
+    if (!tableReady) {
+        for (uint32_t i = 0; i < 256; i++) {
+            uint32_t value = i;
+            for (int bit = 0; bit < 8; bit++) {
+                value = (value & 1) ? 0xEDB88320u ^ (value >> 1) : value >> 1;
+            }
+            table[i] = value;
+        }
+        tableReady = true;
+    }
+
+    crc = ~crc;
+    for (size_t i = 0; i < length; i++) {
+        crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+    }
+    return ~crc;
+}
+
+static void appendBigEndian(std::vector<unsigned char>& out, uint32_t value) {
+    out.push_back(static_cast<unsigned char>(value >> 24));
+    out.push_back(static_cast<unsigned char>(value >> 16));
+    out.push_back(static_cast<unsigned char>(value >> 8));
+    out.push_back(static_cast<unsigned char>(value));
+}
+
+// Parça: uzunluk, tür, veri, tür+veri üzerinden CRC
+static void writeChunk(std::ofstream& file, const char* type, const std::vector<unsigned char>& data) {
+    std::vector<unsigned char> chunk;
+    chunk.reserve(data.size() + 12);
+    appendBigEndian(chunk, static_cast<uint32_t>(data.size()));
+    chunk.insert(chunk.end(), type, type + 4);
+    chunk.insert(chunk.end(), data.begin(), data.end());
+    appendBigEndian(chunk, crc32(chunk.data() + 4, data.size() + 4));
+    file.write(reinterpret_cast<const char*>(chunk.data()), chunk.size());
+}
+
+// zlib sarmalı içinde sıkıştırmasız deflate blokları; zlib bağımlılığı gerektirmez
+bool FrameCapture::writePNG(const std::string& path, int width, int height, const unsigned char* rgba) {
+    std::ofstream file(path, std::ios::binary);
+    if (!file) {
+        return false;
+    }
+
+    static const unsigned char signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+    file.write(reinterpret_cast<const char*>(signature), sizeof(signature));
+
+    std::vector<unsigned char> header;
+    appendBigEndian(header, static_cast<uint32_t>(width));
+    appendBigEndian(header, static_cast<uint32_t>(height));
+    header.push_back(8);  // kanal başına bit
+    header.push_back(6);  // RGBA
+    header.push_back(0);  // sıkıştırma
+    header.push_back(0);  // filtre
+    header.push_back(0);  // interlace yok
+    writeChunk(file, "IHDR", header);
+
+    // Her satırın başına filtre türü 0 (yok) eklenir
+    size_t rowSize = static_cast<size_t>(width) * 4;
+    std::vector<unsigned char> raw;
+    raw.reserve((rowSize + 1) * height);
+    for (int y = 0; y < height; y++) {
+        raw.push_back(0);
+        raw.insert(raw.end(), rgba + y * rowSize, rgba + (y + 1) * rowSize);
+    }
+
+    std::vector<unsigned char> compressed;
+    compressed.reserve(raw.size() + raw.size() / 65535 * 5 + 16);
+    compressed.push_back(0x78);
+    compressed.push_back(0x01);
+
+    uint32_t adlerA = 1, adlerB = 0;
+    size_t offset = 0;
+    do {
+        size_t blockSize = raw.size() - offset < 65535 ? raw.size() - offset : 65535;
+        bool last = offset + blockSize == raw.size();
+        compressed.push_back(last ? 1 : 0);
+        compressed.push_back(static_cast<unsigned char>(blockSize & 0xFF));
+        compressed.push_back(static_cast<unsigned char>(blockSize >> 8));
+        compressed.push_back(static_cast<unsigned char>(~blockSize & 0xFF));
+        compressed.push_back(static_cast<unsigned char>((~blockSize >> 8) & 0xFF));
+        for (size_t i = 0; i < blockSize; i++) {
+            unsigned char value = raw[offset + i];
+            compressed.push_back(value);
+            adlerA = (adlerA + value) % 65521;
+            adlerB = (adlerB + adlerA) % 65521;
+        }
+        offset += blockSize;
+    } while (offset < raw.size());
+    appendBigEndian(compressed, (adlerB << 16) | adlerA);
+    writeChunk(file, "IDAT", compressed);
+
+    writeChunk(file, "IEND", std::vector<unsigned char>());
+    return static_cast<bool>(file);
+}
@@ -0,0 +1,203 @@
+#include "../include/FramePacer.hpp"
+#include <GLFW/glfw3.h>
+#include "imgui.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <thread>
+
+// İşletim sistemi uykusu kaba olabilir (Windows'ta 1 ms ve üstü); son kısım dönerek beklenir
+static const double SPIN_SECONDS = 0.002;
+
+// Tam zamanında modda tahmini işin üstüne bırakılan pay
+static const double JUST_IN_TIME_MARGIN = 0.001;
+
+// İş tahmini son bu kadar karenin en kötüsüdür
+static const int WORK_WINDOW = 30;
+
+FramePacer::FramePacer()
+    : mode(MODE_UNLIMITED), targetRate(0.0), refreshRate(60.0), panelVisible(false),
+      requestedVsync(VSYNC_ON), appliedVsync(VSYNC_ON), appliedOnce(false), nextDeadline(0.0),
+      submittedWork(0.0), historyCount(0), historyIndex(0), lastPresent(0.0), wakeCount(0), wakeIndex(0) {
+    std::fill(presentIntervals, presentIntervals + HISTORY, 0.0f);
+    std::fill(workTimes, workTimes + HISTORY, 0.0f);
+    std::fill(latencies, latencies + HISTORY, 0.0f);
+    std::fill(wakeErrors, wakeErrors + HISTORY, 0.0f);
+}
+
+double FramePacer::now() {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static void sleepUntil(double target) {
+    double remaining = target - FramePacer::now();
+    if (remaining > SPIN_SECONDS) {
+        std::this_thread::sleep_for(std::chrono::duration<double>(remaining - SPIN_SECONDS));
+    }
+    while (FramePacer::now() < target) {
+        std::this_thread::yield();
+    }
+}
+
+double FramePacer::periodSeconds() const {
+    return 1.0 / (targetRate > 0.0 ? targetRate : refreshRate);
+}
+
+// statsMutex tutulurken çağrılır
+double FramePacer::estimateWork() const {
+    int count = std::min(historyCount, WORK_WINDOW);
+    float worst = 0.0f;
+    for (int i = 1; i <= count; i++) {
+        worst = std::max(worst, workTimes[(historyIndex - i + HISTORY) % HISTORY]);
+    }
+    return worst / 1000.0;
+}
+
+void FramePacer::waitForFrame() {
+    double current = now();
+    double wake = current;
+    double period = periodSeconds();
+
+    if (mode == MODE_LIMIT) {
+        // Çok geride kalındıysa kaçan kareleri telafi etmek yerine yeniden hizalanır
+        if (nextDeadline < current - period) {
+            nextDeadline = current;
+        }
+        wake = nextDeadline;
+        nextDeadline += period;
+    } else if (mode == MODE_JUST_IN_TIME) {
+        std::lock_guard<std::mutex> lock(statsMutex);
+        double work = estimateWork() + JUST_IN_TIME_MARGIN;
+
+        // İş bir periyottan uzunsa (örn. render thread ile) beklemek sadece kare kaçırır
+        if (lastPresent > 0.0 && work < period) {
+            double nextPresent = lastPresent + period;
+            while (nextPresent - work < current) {
+                nextPresent += period;
+            }
+            wake = nextPresent - work;
+        }
+    }
+
+    if (wake <= current) {
+        return;
+    }
+
+    sleepUntil(wake);
+    double sampled = now();
+    wakeErrors[wakeIndex] = static_cast<float>((sampled - wake) * 1000.0);
+    wakeIndex = (wakeIndex + 1) % HISTORY;
+    wakeCount = std::min(wakeCount + 1, HISTORY);
+}
+
+void FramePacer::applySwapInterval() {
+    Vsync vsync = requestedVsync.load();
+    if (appliedOnce && vsync == appliedVsync) return;
+
+    int interval = vsync == VSYNC_OFF ? 0 : 1;
+    if (vsync == VSYNC_ADAPTIVE) {
+        if (glfwExtensionSupported("WGL_EXT_swap_control_tear") || glfwExtensionSupported("GLX_EXT_swap_control_tear")) {
+            interval = -1;
+        } else {
+            std::cerr << "Uyarlamalı vsync desteklenmiyor, normal vsync kullanılıyor" << std::endl;
+        }
+    }
+    glfwSwapInterval(interval);
+    appliedVsync = vsync;
+    appliedOnce = true;
+}
+
+void FramePacer::frameSubmitted(double inputTime) {
+    double submitted = now();
+    std::lock_guard<std::mutex> lock(statsMutex);
+    submittedWork = submitted - inputTime;
+}
+
+void FramePacer::framePresented(double inputTime) {
+    double presented = now();
+    std::lock_guard<std::mutex> lock(statsMutex);
+    if (lastPresent > 0.0) {
+        presentIntervals[historyIndex] = static_cast<float>((presented - lastPresent) * 1000.0);
+        workTimes[historyIndex] = static_cast<float>(submittedWork * 1000.0);
+        latencies[historyIndex] = static_cast<float>((presented - inputTime) * 1000.0);
+        historyIndex = (historyIndex + 1) % HISTORY;
+        historyCount = std::min(historyCount + 1, HISTORY);
+    }
+    lastPresent = presented;
+}
+
+static void meanAndDeviation(const float* values, int count, float& mean, float& deviation) {
+    mean = 0.0f;
+    deviation = 0.0f;
+    if (count == 0) return;
+    for (int i = 0; i < count; i++) mean += values[i];
+    mean /= count;
+    for (int i = 0; i < count; i++) deviation += (values[i] - mean) * (values[i] - mean);
+    deviation = std::sqrt(deviation / count);
+}
+
+void FramePacer::renderPanel() {
+    if (!panelVisible) return;
+
+    ImGui::SetNextWindowPos(ImVec2(480.0f, 10.0f), ImGuiCond_FirstUseEver);
+    ImGui::SetNextWindowSize(ImVec2(360.0f, 330.0f), ImGuiCond_FirstUseEver);
+    if (!ImGui::Begin("Kare Zamanlama (F4)", &panelVisible)) {
+        ImGui::End();
+        return;
+    }
+
+    static const char* MODE_NAMES[] = { "Sınırsız", "Sınırla", "Tam zamanında" };
+    static const char* VSYNC_NAMES[] = { "Kapalı", "Açık", "Uyarlamalı" };
+    int modeIndex = mode;
+    if (ImGui::Combo("Mod", &modeIndex, MODE_NAMES, 3)) {
+        mode = static_cast<Mode>(modeIndex);
+        nextDeadline = 0.0;
+    }
+    int vsyncIndex = requestedVsync.load();
+    if (ImGui::Combo("Vsync", &vsyncIndex, VSYNC_NAMES, 3)) {
+        requestedVsync = static_cast<Vsync>(vsyncIndex);
+    }
+    float rate = static_cast<float>(targetRate);
+    if (ImGui::SliderFloat("Hedef Hz", &rate, 0.0f, 240.0f, rate > 0.0f ? "%.0f" : "ekran")) {
+        setTargetRate(rate);
+    }
+    ImGui::Text("Periyot: %.2f ms (ekran %.0f Hz)", periodSeconds() * 1000.0, refreshRate);
+    ImGui::Separator();
+
+    float intervals[HISTORY];
+    float intervalMean, intervalDeviation, workMean, workDeviation, latencyMean, latencyDeviation;
+    int count;
+    {
+        std::lock_guard<std::mutex> lock(statsMutex);
+        count = historyCount;
+        meanAndDeviation(presentIntervals, count, intervalMean, intervalDeviation);
+        meanAndDeviation(workTimes, count, workMean, workDeviation);
+        meanAndDeviation(latencies, count, latencyMean, latencyDeviation);
+        for (int i = 0; i < HISTORY; i++) {
+            intervals[i] = presentIntervals[(historyIndex + i) % HISTORY];
+        }
+    }
+
+    float worst = 0.0f;
+    for (int i = 0; i < HISTORY; i++) {
+        if (intervals[i] > 0.0f) worst = std::max(worst, std::fabs(intervals[i] - intervalMean));
+    }
+    ImGui::Text("Sunum aralığı: ort %.2f ms", intervalMean);
+    ImGui::Text("Jitter: std %.2f ms, en kötü %.2f ms", intervalDeviation, worst);
+    ImGui::PlotLines("##intervals", intervals, HISTORY, 0, nullptr, 0.0f, std::max(intervalMean * 2.0f, 1.0f),
+                     ImVec2(-1.0f, 60.0f));
+
+    float wakeMean, wakeDeviation;
+    meanAndDeviation(wakeErrors, wakeCount, wakeMean, wakeDeviation);
+    ImGui::Text("Uyanma gecikmesi: ort %.3f ms", wakeMean);
+
+    // Ekran görüntüyü yukarıdan aşağı tarar; ortalama olarak yarım yenileme süresi eklenir
+    float scanout = static_cast<float>(500.0 / refreshRate);
+    ImGui::Text("Kare işi (input -> swap): ort %.2f ms (std %.2f)", workMean, workDeviation);
+    ImGui::Text("Input -> sunum: ort %.2f ms (std %.2f)", latencyMean, latencyDeviation);
+    ImGui::Text("Tahmini input -> ekran: %.2f ms", latencyMean + scanout);
+    ImGui::TextDisabled("%d kare örneği", count);
+
+    ImGui::End();
+}
@@ -0,0 +1,290 @@
+#include "../include/GLDebugLayer.hpp"
+#include "../include/GLExtensions.hpp"
+#include "../include/GLStateCache.hpp"
+#include "imgui.h"
+#include <algorithm>
+#include <cstring>
+#include <deque>
+#include <iostream>
+#include <mutex>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+bool GLDebugLayer::installed = false;
+
+// Son argümanı nesne numarası olan bağlama fonksiyonları; 0'a bağlamalar ayrıca sayılır
+#define VM_GL_BIND_FUNCTIONS(X) \
+    X(UseProgram) X(BindVertexArray) X(BindBuffer) X(BindTexture) X(BindFramebuffer)
+
+// Sadece sayılan fonksiyonlar
+#define VM_GL_COUNTED_FUNCTIONS(X) \
+    X(ActiveTexture) X(Enable) X(Disable) X(DepthFunc) X(DepthMask) X(CullFace) X(Viewport) \
+    X(Uniform1i) X(Uniform1f) X(Uniform2f) X(Uniform3f) X(Uniform2fv) X(Uniform3fv) X(Uniform4fv) \
+    X(UniformMatrix3fv) X(UniformMatrix4fv) \
+    X(LinkProgram) X(DeleteProgram) X(DeleteVertexArrays) X(DeleteBuffers) X(DeleteTextures) X(DeleteFramebuffers) \
+    X(DrawArrays) X(DrawElements) X(DrawArraysInstanced) X(DrawElementsInstanced) \
+    X(GetUniformLocation) X(GetIntegerv) X(GetQueryObjectiv) X(GetQueryObjectui64v) \
+    X(TexParameteri) X(TexImage2D) X(GenerateMipmap) X(VertexAttribPointer) X(EnableVertexAttribArray) \
+    X(BufferData) X(BufferSubData) X(Clear) X(ClearColor) X(ColorMask) X(BlendFunc) X(Scissor) \
+    X(QueryCounter) X(BeginQuery) X(EndQuery) X(BindRenderbuffer) X(ReadPixels) X(Finish) X(Flush)
+
+enum GLFunction {
+#define VM_GL_ENUM(name) FN_##name,
+    VM_GL_BIND_FUNCTIONS(VM_GL_ENUM)
+    VM_GL_COUNTED_FUNCTIONS(VM_GL_ENUM)
+#undef VM_GL_ENUM
+    FUNCTION_COUNT
+};
+
+static const char* FUNCTION_NAMES[FUNCTION_COUNT] = {
+#define VM_GL_NAME(name) "gl" #name,
+    VM_GL_BIND_FUNCTIONS(VM_GL_NAME)
+    VM_GL_COUNTED_FUNCTIONS(VM_GL_NAME)
+#undef VM_GL_NAME
+};
+
+// calls sürücüye giden, redundant GLStateCache'in atladığı çağrılardır
+struct FunctionCounts {
+    uint64_t calls[FUNCTION_COUNT];
+    uint64_t redundant[FUNCTION_COUNT];
+    uint64_t unbinds[FUNCTION_COUNT];  // 0'a bağlama (örn. her çizimden sonra glBindVertexArray(0))
+};
+
+// frameCounts sadece GL thread'inde yazılır; diğerleri reportMutex ile korunur
+static FunctionCounts frameCounts;
+static FunctionCounts lastFrameCounts;
+static FunctionCounts totalCounts;
+static uint64_t totalFrames = 0;
+static std::mutex reportMutex;
+
+// GLStateCache çağrısının bu tablodaki fonksiyonu; install() adlardan eşler
+static int skippedFunction[GLStateCache::CALL_COUNT];
+
+// KHR_debug mesajları
+static std::unordered_map<GLenum, uint64_t> messageCounts;
+static std::set<GLuint> seenMessages;
+static std::deque<std::string> recentMessages;
+static const size_t RECENT_MESSAGES = 16;
+
+// Genel sarmalayıcı; her fonksiyon kendi Id'siyle örneklenir
+template <int Id, typename Pointer>
+struct CountedCall;
+
+template <int Id, typename R, typename... Args>
+struct CountedCall<Id, R (APIENTRYP)(Args...)> {
+    static R (APIENTRYP real)(Args...);
+
+    static R APIENTRY call(Args... args) {
+        frameCounts.calls[Id]++;
+        return real(args...);
+    }
+
+    static R APIENTRY bind(Args... args) {
+        const GLuint values[] = { static_cast<GLuint>(args)... };
+        frameCounts.calls[Id]++;
+        if (values[sizeof...(Args) - 1] == 0) {
+            frameCounts.unbinds[Id]++;
+        }
+        return real(args...);
+    }
+};
+
+template <int Id, typename R, typename... Args>
+R (APIENTRYP CountedCall<Id, R (APIENTRYP)(Args...)>::real)(Args...) = nullptr;
+
+template <int Id, typename R, typename... Args>
+static void hookCounted(R (APIENTRYP& pointer)(Args...)) {
+    if (!pointer) return;
+    CountedCall<Id, R (APIENTRYP)(Args...)>::real = pointer;
+    pointer = &CountedCall<Id, R (APIENTRYP)(Args...)>::call;
+}
+
+template <int Id, typename R, typename... Args>
+static void hookBind(R (APIENTRYP& pointer)(Args...)) {
+    if (!pointer) return;
+    CountedCall<Id, R (APIENTRYP)(Args...)>::real = pointer;
+    pointer = &CountedCall<Id, R (APIENTRYP)(Args...)>::bind;
+}
+
+static const char* messageTypeName(GLenum type) {
+    switch (type) {
+        case GL_DEBUG_TYPE_ERROR: return "hata";
+        case GL_DEBUG_TYPE_DEPRECATED_BEHAVIOR: return "eskimiş";
+        case GL_DEBUG_TYPE_UNDEFINED_BEHAVIOR: return "tanımsız";
+        case GL_DEBUG_TYPE_PORTABILITY: return "taşınabilirlik";
+        case GL_DEBUG_TYPE_PERFORMANCE: return "performans";
+        default: return "diğer";
+    }
+}
+
+// Senkron çıktı açık olduğu için GL thread'inde, hatalı çağrının içinden gelir.
+// Aynı mesaj her karede tekrar edebildiği için konsola sadece ilk kez yazılır.
+static void APIENTRY debugMessage(GLenum /*source*/, GLenum type, GLuint id, GLenum /*severity*/, GLsizei /*length*/,
+                                  const GLchar* message, const void* /*userParam*/) {
+    std::string text = std::string("[") + messageTypeName(type) + "] " + message;
+
+    std::lock_guard<std::mutex> lock(reportMutex);
+    messageCounts[type]++;
+    if (seenMessages.insert(id).second) {
+        std::cerr << "GL " << text << std::endl;
+    }
+    recentMessages.push_back(text);
+    if (recentMessages.size() > RECENT_MESSAGES) {
+        recentMessages.pop_front();
+    }
+}
+
+void GLDebugLayer::install() {
+    if (installed) return;
+    installed = true;
+
+#define VM_GL_HOOK_BIND(name) hookBind<FN_##name>(glad_gl##name);
+    VM_GL_BIND_FUNCTIONS(VM_GL_HOOK_BIND)
+#undef VM_GL_HOOK_BIND
+
+#define VM_GL_HOOK_COUNTED(name) hookCounted<FN_##name>(glad_gl##name);
+    VM_GL_COUNTED_FUNCTIONS(VM_GL_HOOK_COUNTED)
+#undef VM_GL_HOOK_COUNTED
+
+    // Gereksiz çağrılar GLStateCache'in atladıklarıdır; kurulumdan öncekiler sayılmaz
+    for (int call = 0; call < GLStateCache::CALL_COUNT; call++) {
+        const char* name = GLStateCache::getCallName(static_cast<GLStateCache::Call>(call));
+        skippedFunction[call] = -1;
+        for (int function = 0; function < FUNCTION_COUNT; function++) {
+            if (std::strcmp(FUNCTION_NAMES[function], name) == 0) {
+                skippedFunction[call] = function;
+                break;
+            }
+        }
+    }
+    uint64_t skipped[GLStateCache::CALL_COUNT];
+    GLStateCache::takeSkipCounts(skipped);
+
+    if (!GLExtensions::debugOutput) {
+        std::cerr << "KHR_debug desteklenmiyor, sürücü uyarıları toplanamayacak." << std::endl;
+        return;
+    }
+
+    // Bilgi seviyesindeki mesajlar (tampon yerleşimi vb.) her karede gelir, kapatılır
+    glEnable(GL_DEBUG_OUTPUT);
+    glEnable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
+    GLExtensions::DebugMessageCallback(debugMessage, nullptr);
+    GLExtensions::DebugMessageControl(GL_DONT_CARE, GL_DONT_CARE, GL_DONT_CARE, 0, nullptr, GL_TRUE);
+    GLExtensions::DebugMessageControl(GL_DONT_CARE, GL_DONT_CARE, GL_DEBUG_SEVERITY_NOTIFICATION, 0, nullptr, GL_FALSE);
+}
+
+void GLDebugLayer::endFrame() {
+    if (!installed) return;
+
+    uint64_t skipped[GLStateCache::CALL_COUNT];
+    GLStateCache::takeSkipCounts(skipped);
+    for (int call = 0; call < GLStateCache::CALL_COUNT; call++) {
+        if (skippedFunction[call] >= 0) {
+            frameCounts.redundant[skippedFunction[call]] += skipped[call];
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(reportMutex);
+    lastFrameCounts = frameCounts;
+    for (int i = 0; i < FUNCTION_COUNT; i++) {
+        totalCounts.calls[i] += frameCounts.calls[i];
+        totalCounts.redundant[i] += frameCounts.redundant[i];
+        totalCounts.unbinds[i] += frameCounts.unbinds[i];
+    }
+    totalFrames++;
+    frameCounts = FunctionCounts();
+}
+
+// İstenen (sürücüye giden + atlanan) çağrı sayısına göre azalan sırada, hiç istenmeyenler hariç
+static std::vector<int> sortedFunctions(const FunctionCounts& counts) {
+    std::vector<int> order;
+    for (int i = 0; i < FUNCTION_COUNT; i++) {
+        if (counts.calls[i] + counts.redundant[i] > 0) order.push_back(i);
+    }
+    std::sort(order.begin(), order.end(), [&](int a, int b) {
+        return counts.calls[a] + counts.redundant[a] > counts.calls[b] + counts.redundant[b];
+    });
+    return order;
+}
+
+void GLDebugLayer::renderPanel() {
+    if (!installed) return;
+
+    ImGui::SetNextWindowPos(ImVec2(10.0f, 300.0f), ImGuiCond_FirstUseEver);
+    ImGui::SetNextWindowSize(ImVec2(460.0f, 380.0f), ImGuiCond_FirstUseEver);
+    if (!ImGui::Begin("GL Debug")) {
+        ImGui::End();
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(reportMutex);
+    uint64_t calls = 0, redundant = 0;
+    for (int i = 0; i < FUNCTION_COUNT; i++) {
+        calls += lastFrameCounts.calls[i];
+        redundant += lastFrameCounts.redundant[i];
+    }
+    uint64_t requested = calls + redundant;
+    ImGui::Text("Son kare: %llu GL çağrısı, %llu gereksiz (%%%.1f)", static_cast<unsigned long long>(calls),
+                static_cast<unsigned long long>(redundant), requested > 0 ? 100.0 * redundant / requested : 0.0);
+    ImGui::TextDisabled("Gereksiz: GLStateCache'in sürücüye göndermediği çağrılar");
+    ImGui::TextDisabled("ImGui kendi yükleyicisini kullandığı için sayılmaz");
+
+    if (ImGui::BeginTable("glCalls", 4, ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingStretchProp |
+                                            ImGuiTableFlags_ScrollY, ImVec2(0.0f, 220.0f))) {
+        ImGui::TableSetupScrollFreeze(0, 1);
+        ImGui::TableSetupColumn("Fonksiyon");
+        ImGui::TableSetupColumn("Çağrı");
+        ImGui::TableSetupColumn("Gereksiz");
+        ImGui::TableSetupColumn("0'a bağlama");
+        ImGui::TableHeadersRow();
+        for (int function : sortedFunctions(lastFrameCounts)) {
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn();
+            ImGui::TextUnformatted(FUNCTION_NAMES[function]);
+            ImGui::TableNextColumn();
+            ImGui::Text("%llu", static_cast<unsigned long long>(lastFrameCounts.calls[function]));
+            ImGui::TableNextColumn();
+            ImGui::Text("%llu", static_cast<unsigned long long>(lastFrameCounts.redundant[function]));
+            ImGui::TableNextColumn();
+            ImGui::Text("%llu", static_cast<unsigned long long>(lastFrameCounts.unbinds[function]));
+        }
+        ImGui::EndTable();
+    }
+
+    ImGui::Text("KHR_debug: %llu performans, %llu hata",
+                static_cast<unsigned long long>(messageCounts[GL_DEBUG_TYPE_PERFORMANCE]),
+                static_cast<unsigned long long>(messageCounts[GL_DEBUG_TYPE_ERROR]));
+    for (const std::string& message : recentMessages) {
+        ImGui::TextWrapped("%s", message.c_str());
+    }
+
+    ImGui::End();
+}
+
+void GLDebugLayer::logReport() {
+    if (!installed) return;
+
+    std::lock_guard<std::mutex> lock(reportMutex);
+    if (totalFrames == 0) return;
+
+    std::cout << "GL debug raporu (" << totalFrames << " kare, kare başına ortalama):" << std::endl;
+    for (int function : sortedFunctions(totalCounts)) {
+        double calls = static_cast<double>(totalCounts.calls[function]) / totalFrames;
+        double redundant = static_cast<double>(totalCounts.redundant[function]) / totalFrames;
+        double unbinds = static_cast<double>(totalCounts.unbinds[function]) / totalFrames;
+        std::cout << "  " << FUNCTION_NAMES[function] << ": " << calls << " çağrı";
+        if (redundant > 0.0) {
+            std::cout << ", " << redundant << " gereksiz, önbellekte atlandı (%" << 100.0 * redundant / (calls + redundant)
+                      << ")";
+        }
+        if (unbinds > 0.0) {
+            std::cout << ", " << unbinds << " kez 0'a bağlama";
+        }
+        std::cout << std::endl;
+    }
+    for (const auto& count : messageCounts) {
+        std::cout << "  KHR_debug " << messageTypeName(count.first) << ": " << count.second << " mesaj" << std::endl;
+    }
+}
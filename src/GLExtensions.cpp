@@ -0,0 +1,60 @@
+#include "../include/GLExtensions.hpp"
+
+bool GLExtensions::programBinary = false;
+PFNVMGETPROGRAMBINARYPROC GLExtensions::GetProgramBinary = nullptr;
+PFNVMPROGRAMBINARYPROC GLExtensions::ProgramBinary = nullptr;
+PFNVMPROGRAMPARAMETERIPROC GLExtensions::ProgramParameteri = nullptr;
+bool GLExtensions::parallelShaderCompile = false;
+PFNVMMAXSHADERCOMPILERTHREADSPROC GLExtensions::MaxShaderCompilerThreads = nullptr;
+bool GLExtensions::debugOutput = false;
+PFNVMDEBUGMESSAGECALLBACKPROC GLExtensions::DebugMessageCallback = nullptr;
+PFNVMDEBUGMESSAGECONTROLPROC GLExtensions::DebugMessageControl = nullptr;
+std::string GLExtensions::extensionList;
+
+void GLExtensions::load(GLADloadproc loader) {
+    // Eklentileri " ad " biçiminde tek bir metinde tutuyoruz, arama kolay olsun
+    extensionList = " ";
+    GLint count = 0;
+    glGetIntegerv(GL_NUM_EXTENSIONS, &count);
+    for (GLint i = 0; i < count; i++) {
+        const char* name = reinterpret_cast<const char*>(glGetStringi(GL_EXTENSIONS, i));
+        if (name) {
+            extensionList += name;
+            extensionList += ' ';
+        }
+    }
+
+    GetProgramBinary = reinterpret_cast<PFNVMGETPROGRAMBINARYPROC>(loader("glGetProgramBinary"));
+    ProgramBinary = reinterpret_cast<PFNVMPROGRAMBINARYPROC>(loader("glProgramBinary"));
+    ProgramParameteri = reinterpret_cast<PFNVMPROGRAMPARAMETERIPROC>(loader("glProgramParameteri"));
+
+    GLint formats = 0;
+    if (has("GL_ARB_get_program_binary")) {
+        glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+    }
+    programBinary = GetProgramBinary && ProgramBinary && ProgramParameteri && formats > 0;
+
+    // KHR ve ARB sürümleri aynı enum değerini kullanır, hangisi varsa onu alıyoruz
+    if (has("GL_KHR_parallel_shader_compile")) {
+        MaxShaderCompilerThreads = reinterpret_cast<PFNVMMAXSHADERCOMPILERTHREADSPROC>(loader("glMaxShaderCompilerThreadsKHR"));
+        parallelShaderCompile = true;
+    } else if (has("GL_ARB_parallel_shader_compile")) {
+        MaxShaderCompilerThreads = reinterpret_cast<PFNVMMAXSHADERCOMPILERTHREADSPROC>(loader("glMaxShaderCompilerThreadsARB"));
+        parallelShaderCompile = true;
+    }
+
+    // KHR sürümünde fonksiyonlar son eksiz, ARB sürümünde ARB ekiyle gelir
+    if (has("GL_KHR_debug")) {
+        DebugMessageCallback = reinterpret_cast<PFNVMDEBUGMESSAGECALLBACKPROC>(loader("glDebugMessageCallback"));
+        DebugMessageControl = reinterpret_cast<PFNVMDEBUGMESSAGECONTROLPROC>(loader("glDebugMessageControl"));
+    } else if (has("GL_ARB_debug_output")) {
+        DebugMessageCallback = reinterpret_cast<PFNVMDEBUGMESSAGECALLBACKPROC>(loader("glDebugMessageCallbackARB"));
+        DebugMessageControl = reinterpret_cast<PFNVMDEBUGMESSAGECONTROLPROC>(loader("glDebugMessageControlARB"));
+    }
+    debugOutput = DebugMessageCallback && DebugMessageControl;
+}
+
+bool GLExtensions::has(const char* extension) {
+    std::string token = std::string(" ") + extension + " ";
+    return extensionList.find(token) != std::string::npos;
+}
@@ -0,0 +1,372 @@
+#include "../include/GLStateCache.hpp"
+#include <cstring>
+#include <iostream>
+#include <unordered_map>
+#include <vector>
+
+bool GLStateCache::validation = false;
+uint64_t GLStateCache::skipCounts[CALL_COUNT] = {};
+
+static const char* CALL_NAMES[GLStateCache::CALL_COUNT] = {
+    "glUseProgram", "glBindVertexArray", "glBindBuffer", "glActiveTexture", "glBindTexture",
+    "glEnable", "glDisable", "glDepthFunc", "glDepthMask", "glCullFace", "glBlendFunc",
+    "glColorMask", "glUniform1i", "glUniform1f", "glUniform2f", "glUniform3f", "glUniform2fv",
+    "glUniform3fv", "glUniform4fv", "glUniformMatrix3fv", "glUniformMatrix4fv"
+};
+
+static const GLuint UNKNOWN = 0xFFFFFFFFu;
+
+struct UniformValue {
+    std::vector<uint32_t> words;
+    GLsizei count;
+    bool integer;
+};
+
+struct CachedState {
+    GLuint program;
+    GLuint vertexArray;
+    std::unordered_map<GLenum, GLuint> buffers;         // GL_ELEMENT_ARRAY_BUFFER hariç
+    std::unordered_map<GLuint, GLuint> elementBuffers;  // VAO'nun durumudur
+    GLuint activeTexture;
+    std::unordered_map<uint64_t, GLuint> textures;      // (birim << 32) | hedef
+    std::unordered_map<GLenum, bool> capabilities;
+    GLuint depthFunc;
+    GLuint depthMask;
+    GLuint cullFace;
+    GLuint blendSource;
+    GLuint blendDestination;
+    GLuint colorMask;                                   // 4 bit, bilinmiyorsa UNKNOWN
+    std::unordered_map<uint64_t, UniformValue> uniforms;  // (program << 32) | konum
+};
+
+static CachedState state = {
+    UNKNOWN, UNKNOWN, {}, {}, UNKNOWN, {}, {}, UNKNOWN, UNKNOWN, UNKNOWN, UNKNOWN, UNKNOWN, UNKNOWN, {}
+};
+
+// Değer değiştiyse günceller ve true döner
+static bool update(GLuint& current, GLuint value) {
+    if (current == value) return false;
+    current = value;
+    return true;
+}
+
+void GLStateCache::useProgram(GLuint program) {
+    if (update(state.program, program)) glUseProgram(program);
+    else skipCounts[CALL_USE_PROGRAM]++;
+}
+
+void GLStateCache::bindVertexArray(GLuint array) {
+    if (update(state.vertexArray, array)) glBindVertexArray(array);
+    else skipCounts[CALL_BIND_VERTEX_ARRAY]++;
+}
+
+// Element tamponu VAO'ya aittir; VAO bilinmiyorsa kaydedilmeden gönderilir
+void GLStateCache::bindBuffer(GLenum target, GLuint buffer) {
+    if (target == GL_ELEMENT_ARRAY_BUFFER) {
+        if (state.vertexArray == UNKNOWN) {
+            glBindBuffer(target, buffer);
+            return;
+        }
+        GLuint& current = state.elementBuffers.emplace(state.vertexArray, UNKNOWN).first->second;
+        if (update(current, buffer)) glBindBuffer(target, buffer);
+        else skipCounts[CALL_BIND_BUFFER]++;
+        return;
+    }
+
+    GLuint& current = state.buffers.emplace(target, UNKNOWN).first->second;
+    if (update(current, buffer)) glBindBuffer(target, buffer);
+    else skipCounts[CALL_BIND_BUFFER]++;
+}
+
+void GLStateCache::activeTexture(GLenum texture) {
+    if (update(state.activeTexture, texture)) glActiveTexture(texture);
+    else skipCounts[CALL_ACTIVE_TEXTURE]++;
+}
+
+void GLStateCache::bindTexture(GLenum target, GLuint texture) {
+    if (state.activeTexture == UNKNOWN) {
+        glBindTexture(target, texture);
+        return;
+    }
+    uint64_t key = (static_cast<uint64_t>(state.activeTexture) << 32) | target;
+    GLuint& current = state.textures.emplace(key, UNKNOWN).first->second;
+    if (update(current, texture)) glBindTexture(target, texture);
+    else skipCounts[CALL_BIND_TEXTURE]++;
+}
+
+void GLStateCache::enable(GLenum capability) {
+    auto it = state.capabilities.find(capability);
+    if (it != state.capabilities.end() && it->second) {
+        skipCounts[CALL_ENABLE]++;
+        return;
+    }
+    state.capabilities[capability] = true;
+    glEnable(capability);
+}
+
+void GLStateCache::disable(GLenum capability) {
+    auto it = state.capabilities.find(capability);
+    if (it != state.capabilities.end() && !it->second) {
+        skipCounts[CALL_DISABLE]++;
+        return;
+    }
+    state.capabilities[capability] = false;
+    glDisable(capability);
+}
+
+void GLStateCache::depthFunc(GLenum function) {
+    if (update(state.depthFunc, function)) glDepthFunc(function);
+    else skipCounts[CALL_DEPTH_FUNC]++;
+}
+
+void GLStateCache::depthMask(GLboolean flag) {
+    if (update(state.depthMask, flag)) glDepthMask(flag);
+    else skipCounts[CALL_DEPTH_MASK]++;
+}
+
+void GLStateCache::cullFace(GLenum mode) {
+    if (update(state.cullFace, mode)) glCullFace(mode);
+    else skipCounts[CALL_CULL_FACE]++;
+}
+
+void GLStateCache::blendFunc(GLenum source, GLenum destination) {
+    if (state.blendSource == source && state.blendDestination == destination) {
+        skipCounts[CALL_BLEND_FUNC]++;
+        return;
+    }
+    state.blendSource = source;
+    state.blendDestination = destination;
+    glBlendFunc(source, destination);
+}
+
+void GLStateCache::colorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha) {
+    GLuint mask = (red ? 1u : 0u) | (green ? 2u : 0u) | (blue ? 4u : 0u) | (alpha ? 8u : 0u);
+    if (update(state.colorMask, mask)) glColorMask(red, green, blue, alpha);
+    else skipCounts[CALL_COLOR_MASK]++;
+}
+
+// Değer aynıysa false döner. -1 konumu GL'de yok sayıldığı için hiç gönderilmez.
+static bool updateUniform(GLint location, const void* data, size_t words, GLsizei count, bool integer) {
+    if (location < 0) return false;
+    if (state.program == UNKNOWN || state.program == 0) return true;
+
+    uint64_t key = (static_cast<uint64_t>(state.program) << 32) | static_cast<uint32_t>(location);
+    UniformValue& value = state.uniforms[key];
+    if (value.words.size() == words && std::memcmp(value.words.data(), data, words * sizeof(uint32_t)) == 0) {
+        return false;
+    }
+    const uint32_t* source = static_cast<const uint32_t*>(data);
+    value.words.assign(source, source + words);
+    value.count = count;
+    value.integer = integer;
+    return true;
+}
+
+void GLStateCache::uniform1i(GLint location, GLint v0) {
+    if (updateUniform(location, &v0, 1, 1, true)) glUniform1i(location, v0);
+    else skipCounts[CALL_UNIFORM_1I]++;
+}
+
+void GLStateCache::uniform1f(GLint location, GLfloat v0) {
+    if (updateUniform(location, &v0, 1, 1, false)) glUniform1f(location, v0);
+    else skipCounts[CALL_UNIFORM_1F]++;
+}
+
+void GLStateCache::uniform2f(GLint location, GLfloat v0, GLfloat v1) {
+    GLfloat value[2] = { v0, v1 };
+    if (updateUniform(location, value, 2, 1, false)) glUniform2f(location, v0, v1);
+    else skipCounts[CALL_UNIFORM_2F]++;
+}
+
+void GLStateCache::uniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2) {
+    GLfloat value[3] = { v0, v1, v2 };
+    if (updateUniform(location, value, 3, 1, false)) glUniform3f(location, v0, v1, v2);
+    else skipCounts[CALL_UNIFORM_3F]++;
+}
+
+void GLStateCache::uniform2fv(GLint location, GLsizei count, const GLfloat* value) {
+    if (updateUniform(location, value, 2 * count, count, false)) glUniform2fv(location, count, value);
+    else skipCounts[CALL_UNIFORM_2FV]++;
+}
+
+void GLStateCache::uniform3fv(GLint location, GLsizei count, const GLfloat* value) {
+    if (updateUniform(location, value, 3 * count, count, false)) glUniform3fv(location, count, value);
+    else skipCounts[CALL_UNIFORM_3FV]++;
+}
+
+void GLStateCache::uniform4fv(GLint location, GLsizei count, const GLfloat* value) {
+    if (updateUniform(location, value, 4 * count, count, false)) glUniform4fv(location, count, value);
+    else skipCounts[CALL_UNIFORM_4FV]++;
+}
+
+// transpose değere dahil değil; uygulamada her zaman GL_FALSE
+void GLStateCache::uniformMatrix3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat* value) {
+    if (updateUniform(location, value, 9 * count, count, false)) glUniformMatrix3fv(location, count, transpose, value);
+    else skipCounts[CALL_UNIFORM_MATRIX_3FV]++;
+}
+
+void GLStateCache::uniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat* value) {
+    if (updateUniform(location, value, 16 * count, count, false)) glUniformMatrix4fv(location, count, transpose, value);
+    else skipCounts[CALL_UNIFORM_MATRIX_4FV]++;
+}
+
+static void forgetUniforms(GLuint program) {
+    for (auto it = state.uniforms.begin(); it != state.uniforms.end();) {
+        if ((it->first >> 32) == program) {
+            it = state.uniforms.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+// Bağlama uniform'ları varsayılan değerlerine döndürür
+void GLStateCache::linkProgram(GLuint program) {
+    forgetUniforms(program);
+    glLinkProgram(program);
+}
+
+// Silinen bağlı nesnelerin yerine GL 0 bağlar; aynı numara sonra başka nesneye verilebilir
+void GLStateCache::deleteProgram(GLuint program) {
+    forgetUniforms(program);
+    if (state.program == program) state.program = UNKNOWN;
+    glDeleteProgram(program);
+}
+
+void GLStateCache::deleteVertexArrays(GLsizei count, const GLuint* arrays) {
+    for (GLsizei i = 0; i < count; i++) {
+        if (state.vertexArray == arrays[i]) state.vertexArray = 0;
+        state.elementBuffers.erase(arrays[i]);
+    }
+    glDeleteVertexArrays(count, arrays);
+}
+
+void GLStateCache::deleteBuffers(GLsizei count, const GLuint* buffers) {
+    for (GLsizei i = 0; i < count; i++) {
+        for (auto& binding : state.buffers) {
+            if (binding.second == buffers[i]) binding.second = 0;
+        }
+        for (auto& binding : state.elementBuffers) {
+            if (binding.second == buffers[i]) binding.second = 0;
+        }
+    }
+    glDeleteBuffers(count, buffers);
+}
+
+void GLStateCache::deleteTextures(GLsizei count, const GLuint* textures) {
+    for (GLsizei i = 0; i < count; i++) {
+        for (auto& binding : state.textures) {
+            if (binding.second == textures[i]) binding.second = 0;
+        }
+    }
+    glDeleteTextures(count, textures);
+}
+
+const char* GLStateCache::getCallName(Call call) {
+    return CALL_NAMES[call];
+}
+
+void GLStateCache::takeSkipCounts(uint64_t counts[CALL_COUNT]) {
+    for (int i = 0; i < CALL_COUNT; i++) {
+        counts[i] = skipCounts[i];
+        skipCounts[i] = 0;
+    }
+}
+
+void GLStateCache::invalidate() {
+    state.program = UNKNOWN;
+    state.vertexArray = UNKNOWN;
+    state.buffers.clear();
+    state.elementBuffers.clear();
+    state.activeTexture = UNKNOWN;
+    state.textures.clear();
+    state.capabilities.clear();
+    state.depthFunc = UNKNOWN;
+    state.depthMask = UNKNOWN;
+    state.cullFace = UNKNOWN;
+    state.blendSource = UNKNOWN;
+    state.blendDestination = UNKNOWN;
+    state.colorMask = UNKNOWN;
+    state.uniforms.clear();
+}
+
+static bool checkValue(const char* where, const char* name, GLuint cached, GLint actual) {
+    if (cached == UNKNOWN || cached == static_cast<GLuint>(actual)) return true;
+    std::cerr << "GL durum önbelleği tutarsız (" << where << "): " << name << " önbellekte " << cached
+              << ", gerçekte " << actual << std::endl;
+    return false;
+}
+
+static GLint getInteger(GLenum name) {
+    GLint value = 0;
+    glGetIntegerv(name, &value);
+    return value;
+}
+
+// Sadece hata ayıklama içindir; her glGet sürücüyü senkronize edebilir
+bool GLStateCache::validate(const char* where) {
+    if (!validation) return true;
+
+    bool valid = true;
+    valid &= checkValue(where, "program", state.program, getInteger(GL_CURRENT_PROGRAM));
+    valid &= checkValue(where, "VAO", state.vertexArray, getInteger(GL_VERTEX_ARRAY_BINDING));
+    valid &= checkValue(where, "aktif doku birimi", state.activeTexture, getInteger(GL_ACTIVE_TEXTURE));
+    valid &= checkValue(where, "derinlik fonksiyonu", state.depthFunc, getInteger(GL_DEPTH_FUNC));
+    valid &= checkValue(where, "derinlik yazımı", state.depthMask, getInteger(GL_DEPTH_WRITEMASK));
+    valid &= checkValue(where, "cull yüzü", state.cullFace, getInteger(GL_CULL_FACE_MODE));
+    valid &= checkValue(where, "blend kaynağı", state.blendSource, getInteger(GL_BLEND_SRC_RGB));
+    valid &= checkValue(where, "blend hedefi", state.blendDestination, getInteger(GL_BLEND_DST_RGB));
+
+    GLboolean writeMask[4];
+    glGetBooleanv(GL_COLOR_WRITEMASK, writeMask);
+    GLint mask = (writeMask[0] ? 1 : 0) | (writeMask[1] ? 2 : 0) | (writeMask[2] ? 4 : 0) | (writeMask[3] ? 8 : 0);
+    valid &= checkValue(where, "renk maskesi", state.colorMask, mask);
+
+    if (state.buffers.count(GL_ARRAY_BUFFER)) {
+        valid &= checkValue(where, "GL_ARRAY_BUFFER", state.buffers[GL_ARRAY_BUFFER], getInteger(GL_ARRAY_BUFFER_BINDING));
+    }
+    auto element = state.elementBuffers.find(state.vertexArray);
+    if (state.vertexArray != UNKNOWN && element != state.elementBuffers.end()) {
+        valid &= checkValue(where, "GL_ELEMENT_ARRAY_BUFFER", element->second, getInteger(GL_ELEMENT_ARRAY_BUFFER_BINDING));
+    }
+
+    for (const auto& capability : state.capabilities) {
+        valid &= checkValue(where, "glIsEnabled", capability.second ? 1 : 0, glIsEnabled(capability.first) ? 1 : 0);
+    }
+
+    // Birim başına doku bağlamaları; aktif birim okunduktan sonra geri kurulur
+    GLint activeUnit = getInteger(GL_ACTIVE_TEXTURE);
+    for (const auto& binding : state.textures) {
+        GLenum unit = static_cast<GLenum>(binding.first >> 32);
+        GLenum target = static_cast<GLenum>(binding.first & 0xFFFFFFFFu);
+        GLenum query = target == GL_TEXTURE_CUBE_MAP ? GL_TEXTURE_BINDING_CUBE_MAP : GL_TEXTURE_BINDING_2D;
+        if (target != GL_TEXTURE_2D && target != GL_TEXTURE_CUBE_MAP) continue;
+        glActiveTexture(unit);
+        valid &= checkValue(where, "doku bağlaması", binding.second, getInteger(query));
+    }
+    glActiveTexture(activeUnit);
+
+    // Aktif programın tek elemanlı uniform'ları
+    if (state.program != UNKNOWN && state.program != 0) {
+        for (const auto& uniform : state.uniforms) {
+            if ((uniform.first >> 32) != state.program || uniform.second.count != 1) continue;
+            GLint location = static_cast<GLint>(uniform.first & 0xFFFFFFFFu);
+            uint32_t actual[16] = {};
+            if (uniform.second.integer) {
+                glGetUniformiv(state.program, location, reinterpret_cast<GLint*>(actual));
+            } else {
+                glGetUniformfv(state.program, location, reinterpret_cast<GLfloat*>(actual));
+            }
+            if (std::memcmp(actual, uniform.second.words.data(), uniform.second.words.size() * sizeof(uint32_t)) != 0) {
+                std::cerr << "GL durum önbelleği tutarsız (" << where << "): program " << state.program
+                          << " uniform konumu " << location << std::endl;
+                valid = false;
+            }
+        }
+    }
+
+    if (!valid) {
+        invalidate();
+    }
+    return valid;
+}
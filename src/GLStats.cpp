@@ -0,0 +1,177 @@
+#include "../include/GLStats.hpp"
+
+bool GLStats::installed = false;
+
+static GLStats::Counters counters = { 0, 0, 0 };
+
+// Sarmalayıcıların çağırdığı gerçek sürücü fonksiyonları
+static PFNGLDRAWARRAYSPROC realDrawArrays = nullptr;
+static PFNGLDRAWELEMENTSPROC realDrawElements = nullptr;
+static PFNGLDRAWARRAYSINSTANCEDPROC realDrawArraysInstanced = nullptr;
+static PFNGLDRAWELEMENTSINSTANCEDPROC realDrawElementsInstanced = nullptr;
+static PFNGLUSEPROGRAMPROC realUseProgram = nullptr;
+static PFNGLBINDTEXTUREPROC realBindTexture = nullptr;
+static PFNGLACTIVETEXTUREPROC realActiveTexture = nullptr;
+static PFNGLBINDVERTEXARRAYPROC realBindVertexArray = nullptr;
+static PFNGLBINDBUFFERPROC realBindBuffer = nullptr;
+static PFNGLBINDFRAMEBUFFERPROC realBindFramebuffer = nullptr;
+static PFNGLENABLEPROC realEnable = nullptr;
+static PFNGLDISABLEPROC realDisable = nullptr;
+static PFNGLDEPTHFUNCPROC realDepthFunc = nullptr;
+static PFNGLDEPTHMASKPROC realDepthMask = nullptr;
+static PFNGLCOLORMASKPROC realColorMask = nullptr;
+static PFNGLBLENDFUNCPROC realBlendFunc = nullptr;
+static PFNGLVIEWPORTPROC realViewport = nullptr;
+
+// Çizilen üçgen sayısı; çizgi ve nokta çizimleri sayılmaz
+static uint64_t triangleCount(GLenum mode, GLsizei count) {
+    switch (mode) {
+        case GL_TRIANGLES: return count / 3;
+        case GL_TRIANGLE_STRIP:
+        case GL_TRIANGLE_FAN: return count > 2 ? count - 2 : 0;
+        default: return 0;
+    }
+}
+
+static void APIENTRY countedDrawArrays(GLenum mode, GLint first, GLsizei count) {
+    counters.drawCalls++;
+    counters.triangles += triangleCount(mode, count);
+    realDrawArrays(mode, first, count);
+}
+
+static void APIENTRY countedDrawElements(GLenum mode, GLsizei count, GLenum type, const void* indices) {
+    counters.drawCalls++;
+    counters.triangles += triangleCount(mode, count);
+    realDrawElements(mode, count, type, indices);
+}
+
+static void APIENTRY countedDrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instances) {
+    counters.drawCalls++;
+    counters.triangles += triangleCount(mode, count) * instances;
+    realDrawArraysInstanced(mode, first, count, instances);
+}
+
+static void APIENTRY countedDrawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const void* indices,
+                                                  GLsizei instances) {
+    counters.drawCalls++;
+    counters.triangles += triangleCount(mode, count) * instances;
+    realDrawElementsInstanced(mode, count, type, indices, instances);
+}
+
+static void countStateChange() {
+    counters.stateChanges++;
+}
+
+static void APIENTRY countedUseProgram(GLuint program) {
+    countStateChange();
+    realUseProgram(program);
+}
+
+static void APIENTRY countedBindTexture(GLenum target, GLuint texture) {
+    countStateChange();
+    realBindTexture(target, texture);
+}
+
+static void APIENTRY countedActiveTexture(GLenum texture) {
+    countStateChange();
+    realActiveTexture(texture);
+}
+
+static void APIENTRY countedBindVertexArray(GLuint array) {
+    countStateChange();
+    realBindVertexArray(array);
+}
+
+static void APIENTRY countedBindBuffer(GLenum target, GLuint buffer) {
+    countStateChange();
+    realBindBuffer(target, buffer);
+}
+
+static void APIENTRY countedBindFramebuffer(GLenum target, GLuint framebuffer) {
+    countStateChange();
+    realBindFramebuffer(target, framebuffer);
+}
+
+static void APIENTRY countedEnable(GLenum capability) {
+    countStateChange();
+    realEnable(capability);
+}
+
+static void APIENTRY countedDisable(GLenum capability) {
+    countStateChange();
+    realDisable(capability);
+}
+
+static void APIENTRY countedDepthFunc(GLenum function) {
+    countStateChange();
+    realDepthFunc(function);
+}
+
+static void APIENTRY countedDepthMask(GLboolean flag) {
+    countStateChange();
+    realDepthMask(flag);
+}
+
+static void APIENTRY countedColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha) {
+    countStateChange();
+    realColorMask(red, green, blue, alpha);
+}
+
+static void APIENTRY countedBlendFunc(GLenum source, GLenum destination) {
+    countStateChange();
+    realBlendFunc(source, destination);
+}
+
+static void APIENTRY countedViewport(GLint x, GLint y, GLsizei width, GLsizei height) {
+    countStateChange();
+    realViewport(x, y, width, height);
+}
+
+void GLStats::install() {
+    if (installed) return;
+    installed = true;
+
+    realDrawArrays = glad_glDrawArrays;
+    realDrawElements = glad_glDrawElements;
+    realDrawArraysInstanced = glad_glDrawArraysInstanced;
+    realDrawElementsInstanced = glad_glDrawElementsInstanced;
+    realUseProgram = glad_glUseProgram;
+    realBindTexture = glad_glBindTexture;
+    realActiveTexture = glad_glActiveTexture;
+    realBindVertexArray = glad_glBindVertexArray;
+    realBindBuffer = glad_glBindBuffer;
+    realBindFramebuffer = glad_glBindFramebuffer;
+    realEnable = glad_glEnable;
+    realDisable = glad_glDisable;
+    realDepthFunc = glad_glDepthFunc;
+    realDepthMask = glad_glDepthMask;
+    realColorMask = glad_glColorMask;
+    realBlendFunc = glad_glBlendFunc;
+    realViewport = glad_glViewport;
+
+    glad_glDrawArrays = countedDrawArrays;
+    glad_glDrawElements = countedDrawElements;
+    glad_glDrawArraysInstanced = countedDrawArraysInstanced;
+    glad_glDrawElementsInstanced = countedDrawElementsInstanced;
+    glad_glUseProgram = countedUseProgram;
+    glad_glBindTexture = countedBindTexture;
+    glad_glActiveTexture = countedActiveTexture;
+    glad_glBindVertexArray = countedBindVertexArray;
+    glad_glBindBuffer = countedBindBuffer;
+    glad_glBindFramebuffer = countedBindFramebuffer;
+    glad_glEnable = countedEnable;
+    glad_glDisable = countedDisable;
+    glad_glDepthFunc = countedDepthFunc;
+    glad_glDepthMask = countedDepthMask;
+    glad_glColorMask = countedColorMask;
+    glad_glBlendFunc = countedBlendFunc;
+    glad_glViewport = countedViewport;
+}
+
+void GLStats::reset() {
+    counters = { 0, 0, 0 };
+}
+
+const GLStats::Counters& GLStats::get() {
+    return counters;
+}
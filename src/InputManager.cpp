@@ -1,5 +1,9 @@
 #include "../include/InputManager.hpp"
+#include "../include/Renderer.hpp"
+#include "../include/Profiler.hpp"
+#include "../include/FramePacer.hpp"
 #include <iostream>
+#include <cstdio>
 
 static InputManager* g_inputManager = nullptr;
 
@@ -17,7 +21,9 @@ void scroll_callback_wrapper(GLFWwindow* window, double xoffset, double yoffset)
 }
 
 InputManager::InputManager(GLFWwindow* window, Robot* robot, Camera* camera, StatueManager* statueManager)
-    : window(window), robot(robot), camera(camera), statueManager(statueManager) {
+    : window(window), robot(robot), camera(camera), statueManager(statueManager), renderer(nullptr), framePacer(nullptr), eventCount(0),
+      movementEnabled(true), tickIndex(0), replayPosition(0), replaying(false) {
+    heldKeys[0] = '\0';
   
     int width, height;
     glfwGetWindowSize(window, &width, &height);
@@ -27,6 +33,31 @@ InputManager::InputManager(GLFWwindow* window, Robot* robot, Camera* camera, Sta
     robotSpeed = 0.6f;
     rotationSpeed = 3.0f; 
     
+    for (int key = 0; key <= GLFW_KEY_LAST; key++) {
+        keyActions[key] = ACTION_NONE;
+        keyDown[key] = false;
+    }
+    for (int action = 0; action < ACTION_COUNT; action++) {
+        actionHeld[action] = false;
+        actionPressed[action] = false;
+    }
+    
+    // Varsayılan tuşlar eski davranışla aynı
+    bindKey(GLFW_KEY_S, ACTION_MOVE_FORWARD);
+    bindKey(GLFW_KEY_W, ACTION_MOVE_BACKWARD);
+    bindKey(GLFW_KEY_D, ACTION_MOVE_LEFT);
+    bindKey(GLFW_KEY_A, ACTION_MOVE_RIGHT);
+    bindKey(GLFW_KEY_C, ACTION_MOVE_UP);
+    bindKey(GLFW_KEY_Z, ACTION_MOVE_DOWN);
+    bindKey(GLFW_KEY_R, ACTION_ROTATE_LEFT);
+    bindKey(GLFW_KEY_Q, ACTION_ROTATE_RIGHT);
+    bindKey(GLFW_KEY_E, ACTION_SCAN);
+    bindKey(GLFW_KEY_F, ACTION_CLOSE_PANEL);
+    bindKey(GLFW_KEY_P, ACTION_TOGGLE_PREPASS);
+    bindKey(GLFW_KEY_F3, ACTION_TOGGLE_PROFILER);
+    bindKey(GLFW_KEY_F4, ACTION_TOGGLE_PACER);
+    bindKey(GLFW_KEY_T, ACTION_TOGGLE_AUTOPILOT);
+    bindKey(GLFW_KEY_ESCAPE, ACTION_BACK);
     
     g_inputManager = this;
 }
@@ -41,30 +72,118 @@ void InputManager::setupCallbacks() {
     glfwSetScrollCallback(window, scroll_callback_wrapper);
 }
 
-void InputManager::processInput(float deltaTime) {
+void InputManager::bindKey(int key, Action action) {
+    if (key < 0 || key > GLFW_KEY_LAST) return;
+    keyActions[key] = action;
+}
+
+bool InputManager::startRecording(const std::string& path) {
+    recordFile.open(path);
+    if (!recordFile) {
+        std::cerr << "Input kaydı açılamadı: " << path << std::endl;
+        return false;
+    }
+    recordFile << "# VirtualMuseum input kaydi v1: adim tip tus eylem mods x y" << std::endl;
+    return true;
+}
+
+bool InputManager::startReplay(const std::string& path) {
+    std::ifstream file(path);
+    if (!file) {
+        std::cerr << "Input kaydı okunamadı: " << path << std::endl;
+        return false;
+    }
+    
+    replayEvents.clear();
+    std::string line;
+    while (std::getline(file, line)) {
+        if (line.empty() || line[0] == '#') continue;
+        RecordedEvent recorded = {};
+        if (std::sscanf(line.c_str(), "%llu %d %d %d %d %f %f", reinterpret_cast<unsigned long long*>(&recorded.tick),
+                        &recorded.event.type, &recorded.event.key, &recorded.event.action, &recorded.event.mods,
+                        &recorded.event.x, &recorded.event.y) == 7) {
+            replayEvents.push_back(recorded);
+        }
+    }
+    replayPosition = 0;
+    replaying = true;
+    std::cout << "Input kaydı oynatılıyor: " << replayEvents.size() << " olay" << std::endl;
+    return true;
+}
+
+void InputManager::processTick(float deltaTime, double tickTime) {
+    
+    for (int action = 0; action < ACTION_COUNT; action++) {
+        actionPressed[action] = false;
+    }
+    
+    // Bu adıma düşen olaylar geliş sırasıyla uygulanır
+    if (replaying) {
+        while (replayPosition < replayEvents.size() && replayEvents[replayPosition].tick <= tickIndex) {
+            handleEvent(replayEvents[replayPosition++].event);
+        }
+        if (replayPosition == replayEvents.size()) {
+            replaying = false;
+            std::cout << "Input kaydı bitti, canlı girişe dönülüyor" << std::endl;
+        }
+    } else {
+        InputEvent event;
+        while (queue.popUntil(tickTime, event)) {
+            if (recordFile.is_open()) {
+                recordFile << tickIndex << ' ' << event.type << ' ' << event.key << ' ' << event.action << ' '
+                           << event.mods << ' ' << event.x << ' ' << event.y << '\n';
+            }
+            handleEvent(event);
+        }
+    }
+    tickIndex++;
+    
+    // Basılı tuşlar uçuş kaydedicisi için not edilir
+    static const int TRACKED_KEYS[] = { GLFW_KEY_W, GLFW_KEY_A, GLFW_KEY_S, GLFW_KEY_D,
+                                        GLFW_KEY_C, GLFW_KEY_Z, GLFW_KEY_Q, GLFW_KEY_R };
+    int held = 0;
+    for (int key : TRACKED_KEYS) {
+        if (keyDown[key]) {
+            heldKeys[held++] = static_cast<char>(key);
+        }
+    }
+    heldKeys[held] = '\0';
+    
+    if (!movementEnabled) {
+        return;
+    }
     
     float speed = deltaTime * robotSpeed;
     
+    // Elle sürüş otomatik turu durdurur
+    if (robot->isAutopilotEnabled()) {
+        for (int action = ACTION_MOVE_FORWARD; action <= ACTION_ROTATE_RIGHT; action++) {
+            if (isActive(static_cast<Action>(action))) {
+                robot->setAutopilot(false);
+                break;
+            }
+        }
+    }
     
-    if (glfwGetKey(window, GLFW_KEY_S) == GLFW_PRESS)
+    if (isActive(ACTION_MOVE_FORWARD))
         robot->moveForward(speed);
-    if (glfwGetKey(window, GLFW_KEY_W) == GLFW_PRESS)
+    if (isActive(ACTION_MOVE_BACKWARD))
         robot->moveBackward(speed);
-    if (glfwGetKey(window, GLFW_KEY_D) == GLFW_PRESS)
+    if (isActive(ACTION_MOVE_LEFT))
         robot->moveLeft(speed);
-    if (glfwGetKey(window, GLFW_KEY_A) == GLFW_PRESS)
+    if (isActive(ACTION_MOVE_RIGHT))
         robot->moveRight(speed);
     
    
-    if (glfwGetKey(window, GLFW_KEY_C) == GLFW_PRESS)
+    if (isActive(ACTION_MOVE_UP))
         robot->moveUp(speed);
-    if (glfwGetKey(window, GLFW_KEY_Z) == GLFW_PRESS)
+    if (isActive(ACTION_MOVE_DOWN))
         robot->moveDown(speed);
     
    
-    if (glfwGetKey(window, GLFW_KEY_R) == GLFW_PRESS)
+    if (isActive(ACTION_ROTATE_LEFT))
         robot->rotate(-deltaTime * rotationSpeed);
-    if (glfwGetKey(window, GLFW_KEY_Q) == GLFW_PRESS)
+    if (isActive(ACTION_ROTATE_RIGHT))
         robot->rotate(deltaTime * rotationSpeed);
     
     
@@ -73,10 +192,36 @@ void InputManager::processInput(float deltaTime) {
     }
 }
 
-void InputManager::processKeyPress(int key, int scancode, int action, int mods) {
+void InputManager::handleEvent(const InputEvent& event) {
+    if (event.type == InputEvent::TYPE_SCROLL) {
+        if (camera) {
+            camera->handleMouseScroll(window, event.x, event.y);
+        }
+        return;
+    }
+    
+    if (event.key < 0 || event.key > GLFW_KEY_LAST) return;
+    int action = keyActions[event.key];
     
-    if (key == GLFW_KEY_ESCAPE && action == GLFW_PRESS) {
-        
+    if (event.action == GLFW_PRESS) {
+        keyDown[event.key] = true;
+        if (action != ACTION_NONE) {
+            actionHeld[action] = true;
+            actionPressed[action] = true;
+            triggerAction(static_cast<Action>(action));
+        }
+    } else if (event.action == GLFW_RELEASE) {
+        keyDown[event.key] = false;
+        if (action != ACTION_NONE) {
+            actionHeld[action] = false;
+        }
+    }
+}
+
+// Tek seferlik eylemler basıldıkları adımda çalışır
+void InputManager::triggerAction(Action action) {
+    switch (action) {
+    case ACTION_BACK:
         if (statueManager) {
             if (statueManager->shouldShowInfoPanel()) {
                 statueManager->setShowInfoPanel(false);
@@ -87,26 +232,61 @@ void InputManager::processKeyPress(int key, int scancode, int action, int mods)
                 return;
             }
         }
-        
         glfwSetWindowShouldClose(window, true);
-    }
-    
-    
-    if (action == GLFW_PRESS) {
-        
-        if (key == GLFW_KEY_E && statueManager) {
+        break;
+    case ACTION_SCAN:
+        if (statueManager) {
             statueManager->startScanning();
         }
-        
-        
-        if (key == GLFW_KEY_F && statueManager && statueManager->shouldShowInfoPanel()) {
+        break;
+    case ACTION_CLOSE_PANEL:
+        if (statueManager && statueManager->shouldShowInfoPanel()) {
             statueManager->setShowInfoPanel(false);
         }
+        break;
+    case ACTION_TOGGLE_PREPASS:
+        if (renderer) {
+            renderer->toggleDepthPrepass();
+        }
+        break;
+    case ACTION_TOGGLE_PROFILER:
+        Profiler::instance().toggleOverlay();
+        break;
+    case ACTION_TOGGLE_PACER:
+        if (framePacer) {
+            framePacer->togglePanel();
+        }
+        break;
+    case ACTION_TOGGLE_AUTOPILOT:
+        if (robot) {
+            robot->setAutopilot(!robot->isAutopilotEnabled());
+        }
+        break;
+    default:
+        break;
     }
 }
 
-void InputManager::processMouseScroll(double xoffset, double yoffset) {
-    if (camera) {
-        camera->handleMouseScroll(window, xoffset, yoffset);
+void InputManager::processKeyPress(int key, int scancode, int action, int mods) {
+    eventCount++;
+    
+    // Oynatma sırasında klavye kayda karışmaz; sadece ESC ile çıkılabilir
+    if (replaying) {
+        if (key == GLFW_KEY_ESCAPE && action == GLFW_PRESS) {
+            glfwSetWindowShouldClose(window, true);
+        }
+        return;
     }
+    
+    InputEvent event = { FramePacer::now(), InputEvent::TYPE_KEY, key, action, mods, 0.0f, 0.0f };
+    queue.push(event);
+}
+
+void InputManager::processMouseScroll(double xoffset, double yoffset) {
+    eventCount++;
+    if (replaying) return;
+    
+    InputEvent event = { FramePacer::now(), InputEvent::TYPE_SCROLL, -1, 0, 0,
+                         static_cast<float>(xoffset), static_cast<float>(yoffset) };
+    queue.push(event);
 }
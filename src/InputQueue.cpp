@@ -0,0 +1,30 @@
+#include "../include/InputQueue.hpp"
+
+InputQueue::InputQueue() : writeIndex(0), readIndex(0), dropped(0) {
+}
+
+// İndeksler sürekli artar; kapasite ikinin kuvveti olduğu için taşma sorun olmaz
+bool InputQueue::push(const InputEvent& event) {
+    uint32_t write = writeIndex.load(std::memory_order_relaxed);
+    if (write - readIndex.load(std::memory_order_acquire) >= CAPACITY) {
+        dropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    events[write % CAPACITY] = event;
+    writeIndex.store(write + 1, std::memory_order_release);
+    return true;
+}
+
+bool InputQueue::popUntil(double limit, InputEvent& event) {
+    uint32_t read = readIndex.load(std::memory_order_relaxed);
+    if (read == writeIndex.load(std::memory_order_acquire)) {
+        return false;
+    }
+    const InputEvent& next = events[read % CAPACITY];
+    if (next.time > limit) {
+        return false;
+    }
+    event = next;
+    readIndex.store(read + 1, std::memory_order_release);
+    return true;
+}
@@ -0,0 +1,385 @@
+#include "../include/JobSystem.hpp"
+#include "../include/Tracer.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <memory>
+
+static thread_local int currentThreadIndex = -1;
+
+// Her thread kendi halkasal havuzundan iş alır; kilit ya da bellek ayırma gerekmez
+static thread_local std::unique_ptr<Job[]> jobPool;
+static thread_local size_t jobPoolIndex = 0;
+
+WorkStealingQueue::WorkStealingQueue() : top(0), bottom(0) {
+    for (int64_t i = 0; i < CAPACITY; i++) {
+        jobs[i].store(nullptr, std::memory_order_relaxed);
+    }
+}
+
+bool WorkStealingQueue::push(Job* job) {
+    int64_t b = bottom.load(std::memory_order_relaxed);
+    int64_t t = top.load(std::memory_order_acquire);
+    if (b - t >= CAPACITY) {
+        return false;
+    }
+    jobs[b & (CAPACITY - 1)].store(job, std::memory_order_relaxed);
+    bottom.store(b + 1, std::memory_order_release);
+    return true;
+}
+
+Job* WorkStealingQueue::pop() {
+    int64_t b = bottom.load(std::memory_order_relaxed) - 1;
+    bottom.store(b, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t t = top.load(std::memory_order_relaxed);
+
+    if (t > b) {
+        // Kuyruk boştu
+        bottom.store(b + 1, std::memory_order_relaxed);
+        return nullptr;
+    }
+
+    Job* job = jobs[b & (CAPACITY - 1)].load(std::memory_order_relaxed);
+    if (t != b) {
+        return job;
+    }
+
+    // Son eleman için çalan thread'lerle yarışılır
+    if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+        job = nullptr;
+    }
+    bottom.store(b + 1, std::memory_order_relaxed);
+    return job;
+}
+
+Job* WorkStealingQueue::steal() {
+    int64_t t = top.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t b = bottom.load(std::memory_order_acquire);
+
+    if (t >= b) {
+        return nullptr;
+    }
+
+    Job* job = jobs[t & (CAPACITY - 1)].load(std::memory_order_relaxed);
+    if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+        return nullptr;
+    }
+    return job;
+}
+
+bool WorkStealingQueue::isEmpty() const {
+    return top.load(std::memory_order_acquire) >= bottom.load(std::memory_order_acquire);
+}
+
+JobSystem& JobSystem::instance() {
+    static JobSystem system;
+    return system;
+}
+
+JobSystem::JobSystem() : running(false), sleepingWorkers(0), queuedJobs(0) {
+}
+
+JobSystem::~JobSystem() {
+    shutdown();
+}
+
+// Çağıran thread çalışan 0 olur; geri kalanlar için ayrı thread açılır
+bool JobSystem::initialize(unsigned int workerCount) {
+    if (isInitialized()) return true;
+
+    if (workerCount == 0) {
+        workerCount = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    for (unsigned int i = 0; i < workerCount; i++) {
+        queues.push_back(new WorkStealingQueue());
+    }
+    currentThreadIndex = 0;
+    running = true;
+
+    for (unsigned int i = 1; i < workerCount; i++) {
+        try {
+            workers.emplace_back(&JobSystem::workerLoop, this, static_cast<int>(i));
+        } catch (const std::exception& e) {
+            std::cerr << "İş sistemi çalışanı başlatılamadı: " << e.what() << std::endl;
+            shutdown();
+            return false;
+        }
+    }
+    return true;
+}
+
+// Kuyrukta kalan işler çalıştırılmaz; kapatmadan önce tüm sayaçlar beklenmelidir
+void JobSystem::shutdown() {
+    if (!isInitialized()) return;
+
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        running = false;
+    }
+    wakeCondition.notify_all();
+
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+    workers.clear();
+
+    for (WorkStealingQueue* queue : queues) {
+        delete queue;
+    }
+    queues.clear();
+    queuedJobs = 0;
+    currentThreadIndex = -1;
+}
+
+int JobSystem::getThreadIndex() {
+    return currentThreadIndex;
+}
+
+// Halka dönüp hâlâ kuyrukta ya da çalışmakta olan bir işe gelindiyse onun üzerine
+// yazılmaz; yeni iş heap'ten ayrılır ve finish() içinde silinir
+Job* JobSystem::allocateJob() {
+    if (!jobPool) {
+        jobPool.reset(new Job[JOB_POOL_SIZE]);
+        for (size_t i = 0; i < JOB_POOL_SIZE; i++) {
+            jobPool[i].unfinished.store(0, std::memory_order_relaxed);
+            jobPool[i].heapAllocated = false;
+        }
+    }
+    Job* job = &jobPool[jobPoolIndex & (JOB_POOL_SIZE - 1)];
+    if (job->unfinished.load(std::memory_order_acquire) != 0) {
+        job = new Job;
+        job->heapAllocated = true;
+    } else {
+        jobPoolIndex++;
+    }
+    job->unfinished.store(1, std::memory_order_relaxed);
+    return job;
+}
+
+void JobSystem::run(Job* job, Counter* counter) {
+    if (counter) {
+        int chained = 0;
+        for (Job* link = job; link; link = link->continuation) {
+            link->counter = counter;
+            chained++;
+        }
+        counter->fetch_add(chained, std::memory_order_relaxed);
+    }
+
+    enqueue(job);
+}
+
+// İş sistemine ait olmayan thread'ler ve dolu kuyruk için iş hemen çalıştırılır
+void JobSystem::enqueue(Job* job) {
+    int threadIndex = currentThreadIndex;
+    if (threadIndex < 0 || !running || !queues[threadIndex]->push(job)) {
+        execute(job);
+        return;
+    }
+
+    queuedJobs.fetch_add(1, std::memory_order_seq_cst);
+    if (sleepingWorkers.load(std::memory_order_seq_cst) > 0) {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        wakeCondition.notify_one();
+    }
+}
+
+// Önce kendi kuyruğuna bakar, sonra diğerlerinden sırayla çalar
+Job* JobSystem::findJob(int threadIndex) {
+    Job* job = queues[threadIndex]->pop();
+    if (!job) {
+        int count = static_cast<int>(queues.size());
+        for (int i = 1; i < count && !job; i++) {
+            job = queues[(threadIndex + i) % count]->steal();
+        }
+    }
+    if (job) {
+        queuedJobs.fetch_sub(1, std::memory_order_relaxed);
+    }
+    return job;
+}
+
+void JobSystem::execute(Job* job) {
+    job->function(job);
+    finish(job);
+}
+
+// Devam işi sayaç azaltılmadan önce kuyruğa girer, böylece bekleyen zincirin sonunu görür
+void JobSystem::finish(Job* job) {
+    Counter* counter = job->counter;
+    Job* continuation = job->continuation;
+
+    // Bundan sonra iş yuvası sahibi tarafından yeniden kullanılabilir; işe dokunulmaz
+    if (job->heapAllocated) {
+        delete job;
+    } else {
+        job->unfinished.store(0, std::memory_order_release);
+    }
+
+    if (continuation) {
+        enqueue(continuation);
+    }
+
+    if (counter) {
+        counter->fetch_sub(1, std::memory_order_release);
+    }
+}
+
+void JobSystem::wait(Counter& counter) {
+    int threadIndex = currentThreadIndex;
+    while (counter.load(std::memory_order_acquire) > 0) {
+        Job* job = threadIndex >= 0 ? findJob(threadIndex) : nullptr;
+        if (job) {
+            execute(job);
+        } else {
+            std::this_thread::yield();
+        }
+    }
+}
+
+// İş bulamayan çalışan kısa bir süre döner, sonra yeni iş gelene kadar uyur
+void JobSystem::workerLoop(int threadIndex) {
+    currentThreadIndex = threadIndex;
+    Tracer::setThreadName("job worker");
+    int idleSpins = 0;
+
+    while (running) {
+        Job* job = findJob(threadIndex);
+        if (job) {
+            execute(job);
+            idleSpins = 0;
+            continue;
+        }
+
+        if (++idleSpins < 64) {
+            std::this_thread::yield();
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(sleepMutex);
+        sleepingWorkers.fetch_add(1, std::memory_order_seq_cst);
+        if (running && queuedJobs.load(std::memory_order_seq_cst) <= 0) {
+            wakeCondition.wait_for(lock, std::chrono::milliseconds(10));
+        }
+        sleepingWorkers.fetch_sub(1, std::memory_order_seq_cst);
+        idleSpins = 0;
+    }
+}
+
+// Saniye cinsinden geçen süre
+static double elapsedSeconds(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Ölçeklenme testinde kullanılan, optimize edilip atılamayan hesap
+static double burnWork(size_t first, size_t last) {
+    double sum = 0.0;
+    for (size_t i = first; i < last; i++) {
+        sum += std::sqrt(static_cast<double>(i) + 1.0) * std::sin(static_cast<double>(i));
+    }
+    return sum;
+}
+
+bool JobSystem::runBenchmarks() {
+    JobSystem& jobs = instance();
+    bool valid = true;
+    bool wasInitialized = jobs.isInitialized();
+    unsigned int hardwareThreads = std::max(1u, std::thread::hardware_concurrency());
+
+    // Boş işlerin oluşturma + kuyruğa ekleme + yürütme maliyeti
+    const int JOB_BATCH = 1000;
+    const int BATCH_COUNT = 200;
+    jobs.shutdown();
+    jobs.initialize();
+    {
+        std::atomic<int> executed(0);
+        auto start = std::chrono::steady_clock::now();
+        for (int batch = 0; batch < BATCH_COUNT; batch++) {
+            Counter counter(0);
+            for (int i = 0; i < JOB_BATCH; i++) {
+                jobs.run(jobs.createJob([&executed]() { executed.fetch_add(1, std::memory_order_relaxed); }), &counter);
+            }
+            jobs.wait(counter);
+        }
+        double seconds = elapsedSeconds(start);
+        std::cout << "Boş iş: " << executed.load() << " iş, iş başına "
+                  << seconds * 1e9 / executed.load() << " ns (" << jobs.getWorkerCount() << " çalışan)" << std::endl;
+        if (executed.load() != JOB_BATCH * BATCH_COUNT) {
+            std::cout << "  doğruluk HATA: " << JOB_BATCH * BATCH_COUNT << " iş bekleniyordu" << std::endl;
+            valid = false;
+        }
+    }
+
+    // Devam zincirleri: her iş bir sonrakini kuyruğa ekler
+    {
+        const int CHAIN_LENGTH = 64;
+        std::atomic<int> executed(0);
+        auto start = std::chrono::steady_clock::now();
+        for (int batch = 0; batch < BATCH_COUNT; batch++) {
+            Counter counter(0);
+            Job* first = jobs.createJob([&executed]() { executed.fetch_add(1, std::memory_order_relaxed); });
+            Job* previous = first;
+            for (int i = 1; i < CHAIN_LENGTH; i++) {
+                Job* next = jobs.createJob([&executed]() { executed.fetch_add(1, std::memory_order_relaxed); });
+                jobs.setContinuation(previous, next);
+                previous = next;
+            }
+            jobs.run(first, &counter);
+            jobs.wait(counter);
+        }
+        double seconds = elapsedSeconds(start);
+        std::cout << "Devam zinciri: " << executed.load() << " iş, iş başına "
+                  << seconds * 1e9 / executed.load() << " ns" << std::endl;
+        if (executed.load() != CHAIN_LENGTH * BATCH_COUNT) {
+            std::cout << "  doğruluk HATA: " << CHAIN_LENGTH * BATCH_COUNT << " iş bekleniyordu" << std::endl;
+            valid = false;
+        }
+    }
+
+    // Aynı hesabın çalışan sayısına göre hızlanması
+    std::vector<unsigned int> workerCounts;
+    for (unsigned int count = 1; count < hardwareThreads; count *= 2) {
+        workerCounts.push_back(count);
+    }
+    workerCounts.push_back(hardwareThreads);
+
+    const size_t ELEMENTS = 4000000;
+    double baseline = 0.0;
+
+    // Parçalar aynı sırayla toplandığı için paralel sonuç seri sonuçla birebir aynı olmalı
+    double reference = 0.0;
+    for (size_t first = 0; first < ELEMENTS; first += 4096) {
+        reference += burnWork(first, std::min(first + 4096, ELEMENTS));
+    }
+
+    for (unsigned int workerCount : workerCounts) {
+        jobs.shutdown();
+        jobs.initialize(workerCount);
+
+        std::vector<double> partial(ELEMENTS / 4096 + 1, 0.0);
+        auto start = std::chrono::steady_clock::now();
+        jobs.parallelFor(0, ELEMENTS, 4096, [&partial](size_t first, size_t last) {
+            partial[first / 4096] = burnWork(first, last);
+        });
+        double seconds = elapsedSeconds(start);
+        if (workerCount == 1) baseline = seconds;
+
+        double checksum = 0.0;
+        for (double value : partial) checksum += value;
+        bool matches = std::fabs(checksum - reference) <= 1e-9 * std::max(1.0, std::fabs(reference));
+        std::cout << "parallelFor " << workerCount << " çalışan: " << seconds * 1000.0 << " ms, hızlanma "
+                  << baseline / seconds << "x (kontrol " << checksum << (matches ? "" : ", doğruluk HATA") << ")"
+                  << std::endl;
+        valid = valid && matches;
+    }
+
+    jobs.shutdown();
+    if (wasInitialized) {
+        jobs.initialize();
+    }
+    return valid;
+}
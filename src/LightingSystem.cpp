@@ -1,20 +1,28 @@
 #include "../include/LightingSystem.hpp"
+#include "../include/ShaderLibrary.hpp"
+#include "../include/Statue.hpp"
+#include "../include/Robot.hpp"
+#include "../include/RobotFleet.hpp"
+#include "../include/TransformSystem.hpp"
+#include "../include/GLStateCache.hpp"
 #include <iostream>
 #include <string>
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtc/type_ptr.hpp>
 
-LightingSystem::LightingSystem() : lightVAO(0), lightVBO(0), shaderProgram(0) {
+LightingSystem::LightingSystem() : lightVAO(0), lightVBO(0),
+                                   shadowLightsChanged(true), shadowCenter(0.0f), shadowRadius(10.0f),
+                                   staticCasterVersion(0), dynamicCasterVersion(0),
+                                   dynamicLayerEmpty(true), staticShadowRenders(0) {
 }
 
 LightingSystem::~LightingSystem() {
-    glDeleteVertexArrays(1, &lightVAO);
-    glDeleteBuffers(1, &lightVBO);
-    glDeleteProgram(shaderProgram);
+    GLStateCache::deleteVertexArrays(1, &lightVAO);
+    GLStateCache::deleteBuffers(1, &lightVBO);
 }
 
-bool LightingSystem::initialize() {
-    createShaders();
+bool LightingSystem::initialize(ShaderLibrary& shaderLibrary) {
+    createShaders(shaderLibrary);
     
     float vertices[] = {
         // Pozisyon
@@ -41,16 +49,16 @@ bool LightingSystem::initialize() {
     glGenVertexArrays(1, &lightVAO);
     glGenBuffers(1, &lightVBO);
     
-    glBindVertexArray(lightVAO);
+    GLStateCache::bindVertexArray(lightVAO);
     
-    glBindBuffer(GL_ARRAY_BUFFER, lightVBO);
+    GLStateCache::bindBuffer(GL_ARRAY_BUFFER, lightVBO);
     glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
     
     glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)0);
     glEnableVertexAttribArray(0);
     
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
-    glBindVertexArray(0);
+    GLStateCache::bindBuffer(GL_ARRAY_BUFFER, 0);
+    GLStateCache::bindVertexArray(0);
     
     
     addAmbientLight(glm::vec3(0.0f, 3.0f, 0.0f), glm::vec3(1.0f, 1.0f, 1.0f), 0.7f);
@@ -68,7 +76,7 @@ bool LightingSystem::initialize() {
 void LightingSystem::apply(const glm::mat4& viewMatrix, 
                           const glm::mat4& projectionMatrix, 
                           GLuint shaderProgram) {
-    glUseProgram(shaderProgram);
+    GLStateCache::useProgram(shaderProgram);
     
     for (size_t i = 0; i < ambientLights.size(); ++i) {
         std::string prefix = "ambientLights[" + std::to_string(i) + "].";
@@ -77,9 +85,9 @@ void LightingSystem::apply(const glm::mat4& viewMatrix,
         GLint colorLoc = glGetUniformLocation(shaderProgram, (prefix + "color").c_str());
         GLint intensityLoc = glGetUniformLocation(shaderProgram, (prefix + "intensity").c_str());
         
-        glUniform3fv(posLoc, 1, glm::value_ptr(ambientLights[i].position));
-        glUniform3fv(colorLoc, 1, glm::value_ptr(ambientLights[i].color));
-        glUniform1f(intensityLoc, ambientLights[i].intensity);
+        GLStateCache::uniform3fv(posLoc, 1, glm::value_ptr(ambientLights[i].position));
+        GLStateCache::uniform3fv(colorLoc, 1, glm::value_ptr(ambientLights[i].color));
+        GLStateCache::uniform1f(intensityLoc, ambientLights[i].intensity);
     }
     
     for (size_t i = 0; i < spotLights.size(); ++i) {
@@ -92,12 +100,12 @@ void LightingSystem::apply(const glm::mat4& viewMatrix,
         GLint cutOffLoc = glGetUniformLocation(shaderProgram, (prefix + "cutOff").c_str());
         GLint outerCutOffLoc = glGetUniformLocation(shaderProgram, (prefix + "outerCutOff").c_str());
         
-        glUniform3fv(posLoc, 1, glm::value_ptr(spotLights[i].position));
-        glUniform3fv(dirLoc, 1, glm::value_ptr(spotLights[i].direction));
-        glUniform3fv(colorLoc, 1, glm::value_ptr(spotLights[i].color));
-        glUniform1f(intensityLoc, spotLights[i].intensity);
-        glUniform1f(cutOffLoc, glm::cos(glm::radians(spotLights[i].cutOff)));
-        glUniform1f(outerCutOffLoc, glm::cos(glm::radians(spotLights[i].outerCutOff)));
+        GLStateCache::uniform3fv(posLoc, 1, glm::value_ptr(spotLights[i].position));
+        GLStateCache::uniform3fv(dirLoc, 1, glm::value_ptr(spotLights[i].direction));
+        GLStateCache::uniform3fv(colorLoc, 1, glm::value_ptr(spotLights[i].color));
+        GLStateCache::uniform1f(intensityLoc, spotLights[i].intensity);
+        GLStateCache::uniform1f(cutOffLoc, glm::cos(glm::radians(spotLights[i].cutOff)));
+        GLStateCache::uniform1f(outerCutOffLoc, glm::cos(glm::radians(spotLights[i].outerCutOff)));
     }
     
     for (size_t i = 0; i < directionalLights.size(); ++i) {
@@ -107,9 +115,9 @@ void LightingSystem::apply(const glm::mat4& viewMatrix,
         GLint colorLoc = glGetUniformLocation(shaderProgram, (prefix + "color").c_str());
         GLint intensityLoc = glGetUniformLocation(shaderProgram, (prefix + "intensity").c_str());
         
-        glUniform3fv(dirLoc, 1, glm::value_ptr(directionalLights[i].direction));
-        glUniform3fv(colorLoc, 1, glm::value_ptr(directionalLights[i].color));
-        glUniform1f(intensityLoc, directionalLights[i].intensity);
+        GLStateCache::uniform3fv(dirLoc, 1, glm::value_ptr(directionalLights[i].direction));
+        GLStateCache::uniform3fv(colorLoc, 1, glm::value_ptr(directionalLights[i].color));
+        GLStateCache::uniform1f(intensityLoc, directionalLights[i].intensity);
     }
     
     renderLightSources(viewMatrix, projectionMatrix);
@@ -145,6 +153,7 @@ int LightingSystem::addSpotLight(const glm::vec3& position,
     light.outerCutOff = outerCutOff;
     
     spotLights.push_back(light);
+    shadowLightsChanged = true;
     return spotLights.size() - 1;
 }
 
@@ -157,10 +166,11 @@ int LightingSystem::addDirectionalLight(const glm::vec3& direction,
     light.intensity = intensity;
     
     directionalLights.push_back(light);
+    shadowLightsChanged = true;
     return directionalLights.size() - 1;
 }
 
-void LightingSystem::createShaders() {
+void LightingSystem::createShaders(ShaderLibrary& shaderLibrary) {
     const char* vertexShaderSource = R"(
         #version 330 core
         layout (location = 0) in vec3 aPos;
@@ -186,70 +196,33 @@ void LightingSystem::createShaders() {
     )";
     
   
-    GLuint vertexShader = glCreateShader(GL_VERTEX_SHADER);
-    glShaderSource(vertexShader, 1, &vertexShaderSource, NULL);
-    glCompileShader(vertexShader);
-    
-  
-    int success;
-    char infoLog[512];
-    glGetShaderiv(vertexShader, GL_COMPILE_STATUS, &success);
-    if (!success) {
-        glGetShaderInfoLog(vertexShader, 512, NULL, infoLog);
-        std::cerr << "ERROR::SHADER::VERTEX::COMPILATION_FAILED\n" << infoLog << std::endl;
-    }
-    
-    GLuint fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
-    glShaderSource(fragmentShader, 1, &fragmentShaderSource, NULL);
-    glCompileShader(fragmentShader);
-   
-    glGetShaderiv(fragmentShader, GL_COMPILE_STATUS, &success);
-    if (!success) {
-        glGetShaderInfoLog(fragmentShader, 512, NULL, infoLog);
-        std::cerr << "ERROR::SHADER::FRAGMENT::COMPILATION_FAILED\n" << infoLog << std::endl;
-    }
-    
-    
-    shaderProgram = glCreateProgram();
-    glAttachShader(shaderProgram, vertexShader);
-    glAttachShader(shaderProgram, fragmentShader);
-    glLinkProgram(shaderProgram);
-    
-    
-    glGetProgramiv(shaderProgram, GL_LINK_STATUS, &success);
-    if (!success) {
-        glGetProgramInfoLog(shaderProgram, 512, NULL, infoLog);
-        std::cerr << "ERROR::SHADER::PROGRAM::LINKING_FAILED\n" << infoLog << std::endl;
-    }
-    
-  
-    glDeleteShader(vertexShader);
-    glDeleteShader(fragmentShader);
+    lightShader = shaderLibrary.request(vertexShaderSource, fragmentShaderSource);
 }
 
 void LightingSystem::renderLightSources(const glm::mat4& viewMatrix, 
                                        const glm::mat4& projectionMatrix) {
     
-    glUseProgram(shaderProgram);
+    GLuint shaderProgram = lightShader.get();
+    GLStateCache::useProgram(shaderProgram);
     
     
     GLint viewLoc = glGetUniformLocation(shaderProgram, "view");
     GLint projLoc = glGetUniformLocation(shaderProgram, "projection");
     GLint lightColorLoc = glGetUniformLocation(shaderProgram, "lightColor");
     
-    glUniformMatrix4fv(viewLoc, 1, GL_FALSE, glm::value_ptr(viewMatrix));
-    glUniformMatrix4fv(projLoc, 1, GL_FALSE, glm::value_ptr(projectionMatrix));
+    GLStateCache::uniformMatrix4fv(viewLoc, 1, GL_FALSE, glm::value_ptr(viewMatrix));
+    GLStateCache::uniformMatrix4fv(projLoc, 1, GL_FALSE, glm::value_ptr(projectionMatrix));
    
     for (const auto& light : ambientLights) {
         glm::mat4 model = glm::mat4(1.0f);
         model = glm::translate(model, light.position);
         
         GLint modelLoc = glGetUniformLocation(shaderProgram, "model");
-        glUniformMatrix4fv(modelLoc, 1, GL_FALSE, glm::value_ptr(model));
+        GLStateCache::uniformMatrix4fv(modelLoc, 1, GL_FALSE, glm::value_ptr(model));
         
-        glUniform3fv(lightColorLoc, 1, glm::value_ptr(light.color));
+        GLStateCache::uniform3fv(lightColorLoc, 1, glm::value_ptr(light.color));
         
-        glBindVertexArray(lightVAO);
+        GLStateCache::bindVertexArray(lightVAO);
         glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
     }
     
@@ -259,13 +232,173 @@ void LightingSystem::renderLightSources(const glm::mat4& viewMatrix,
         model = glm::translate(model, light.position);
         
         GLint modelLoc = glGetUniformLocation(shaderProgram, "model");
-        glUniformMatrix4fv(modelLoc, 1, GL_FALSE, glm::value_ptr(model));
+        GLStateCache::uniformMatrix4fv(modelLoc, 1, GL_FALSE, glm::value_ptr(model));
         
-        glUniform3fv(lightColorLoc, 1, glm::value_ptr(light.color));
+        GLStateCache::uniform3fv(lightColorLoc, 1, glm::value_ptr(light.color));
         
-        glBindVertexArray(lightVAO);
+        GLStateCache::bindVertexArray(lightVAO);
         glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
     }
     
-    glBindVertexArray(0);
+    GLStateCache::bindVertexArray(0);
+}
+
+bool LightingSystem::initializeShadows(const glm::vec3& sceneCenter, float sceneRadius) {
+    shadowCenter = sceneCenter;
+    shadowRadius = sceneRadius;
+    shadowLightsChanged = true;
+    return shadowAtlas.initialize();
+}
+
+void LightingSystem::invalidateShadows() {
+    for (auto& light : shadowedLights) {
+        light.staticDirty = true;
+    }
+}
+
+// Atlasa sığdığı kadar spot ve yönlü ışığa karo verir, spot ışıklar önceliklidir
+void LightingSystem::rebuildShadowedLights() {
+    shadowedLights.clear();
+    for (size_t i = 0; i < spotLights.size() && shadowedLights.size() < ShadowAtlas::MAX_TILES; ++i) {
+        shadowedLights.push_back({ true, static_cast<int>(i), glm::mat4(1.0f), true });
+    }
+    for (size_t i = 0; i < directionalLights.size() && shadowedLights.size() < ShadowAtlas::MAX_TILES; ++i) {
+        shadowedLights.push_back({ false, static_cast<int>(i), glm::mat4(1.0f), true });
+    }
+    for (auto& light : shadowedLights) {
+        light.lightSpaceMatrix = computeLightSpaceMatrix(light);
+    }
+    shadowLightsChanged = false;
+    dynamicCasterVersion = 0;
+}
+
+glm::mat4 LightingSystem::computeLightSpaceMatrix(const ShadowedLight& light) const {
+    glm::vec3 direction = light.spot ? spotLights[light.lightIndex].direction
+                                     : directionalLights[light.lightIndex].direction;
+    direction = glm::normalize(direction);
+    glm::vec3 up = std::abs(direction.y) > 0.99f ? glm::vec3(0.0f, 0.0f, 1.0f) : glm::vec3(0.0f, 1.0f, 0.0f);
+
+    if (light.spot) {
+        const SpotLight& spot = spotLights[light.lightIndex];
+        glm::mat4 view = glm::lookAt(spot.position, spot.position + direction, up);
+        glm::mat4 projection = glm::perspective(glm::radians(spot.outerCutOff * 2.0f), 1.0f, 0.1f,
+                                                glm::length(spot.position - shadowCenter) + shadowRadius);
+        return projection * view;
+    }
+
+    // Yönlü ışık sahneyi çevreleyen kürenin dışından bakar
+    glm::vec3 eye = shadowCenter - direction * shadowRadius * 2.0f;
+    glm::mat4 view = glm::lookAt(eye, shadowCenter, up);
+    glm::mat4 projection = glm::ortho(-shadowRadius, shadowRadius, -shadowRadius, shadowRadius, 0.1f, shadowRadius * 4.0f);
+    return projection * view;
+}
+
+void LightingSystem::updateShadows(const std::vector<Statue*>& staticCasters, Robot* dynamicCaster, ShaderLibrary& shaderLibrary,
+                                   const RobotFleet* fleet) {
+    if (!shadowAtlas.isInitialized()) return;
+    
+    if (shadowLightsChanged) {
+        rebuildShadowedLights();
+    }
+    
+    TransformSystem& transforms = TransformSystem::instance();
+    
+    // Versiyonlar sadece artar; toplam değiştiyse en az bir heykel hareket etmiştir
+    uint64_t version = staticCasters.size();
+    for (auto statue : staticCasters) {
+        version += transforms.getVersion(statue->getTransform());
+    }
+    if (version != staticCasterVersion) {
+        staticCasterVersion = version;
+        invalidateShadows();
+    }
+    
+    bool anyStaticDirty = false;
+    for (const auto& light : shadowedLights) {
+        anyStaticDirty = anyStaticDirty || light.staticDirty;
+    }
+    
+    if (anyStaticDirty) {
+        shadowAtlas.begin(ShadowAtlas::STATIC_LAYER);
+        for (size_t tile = 0; tile < shadowedLights.size(); ++tile) {
+            ShadowedLight& light = shadowedLights[tile];
+            if (!light.staticDirty) continue;
+            
+            shadowAtlas.beginTile(static_cast<int>(tile));
+            for (auto statue : staticCasters) {
+                statue->renderDepth(light.lightSpaceMatrix, glm::mat4(1.0f), shaderLibrary);
+            }
+            light.staticDirty = false;
+            staticShadowRenders++;
+        }
+        shadowAtlas.end();
+    }
+    
+    // Dinamik katman robot ve filo hareket etmediyse olduğu gibi kalır
+    bool hasFleet = fleet && fleet->getUploadedCount() > 0;
+    uint64_t dynamicVersion = dynamicCaster ? transforms.getVersion(dynamicCaster->getBodyTransform()) + 1 : 0;
+    if (hasFleet) {
+        dynamicVersion += fleet->getUploadedVersion();
+    }
+    if (dynamicVersion == dynamicCasterVersion && (dynamicCaster || hasFleet || dynamicLayerEmpty)) return;
+    dynamicCasterVersion = dynamicVersion;
+    
+    GLuint depthProgram = shaderLibrary.getProgram(ShaderLibrary::variantKey(SHADER_FEATURE_DEPTH_ONLY, 1));
+    GLuint fleetDepthProgram = hasFleet
+        ? shaderLibrary.getProgram(ShaderLibrary::variantKey(SHADER_FEATURE_DEPTH_ONLY | SHADER_FEATURE_INSTANCED, 1)) : 0;
+    
+    shadowAtlas.begin(ShadowAtlas::DYNAMIC_LAYER);
+    for (size_t tile = 0; tile < shadowedLights.size(); ++tile) {
+        shadowAtlas.beginTile(static_cast<int>(tile));
+        if (dynamicCaster) {
+            dynamicCaster->renderDepth(shadowedLights[tile].lightSpaceMatrix, glm::mat4(1.0f), depthProgram);
+        }
+        if (hasFleet) {
+            fleet->renderDepth(shadowedLights[tile].lightSpaceMatrix, glm::mat4(1.0f), fleetDepthProgram);
+        }
+    }
+    shadowAtlas.end();
+    dynamicLayerEmpty = dynamicCaster == nullptr && !hasFleet;
+}
+
+void LightingSystem::applyShadows(GLuint program) const {
+    if (!shadowAtlas.isInitialized()) return;
+    
+    GLStateCache::activeTexture(GL_TEXTURE0 + SHADOW_TEXTURE_UNIT);
+    GLStateCache::bindTexture(GL_TEXTURE_2D, shadowAtlas.getTexture(ShadowAtlas::STATIC_LAYER));
+    GLStateCache::activeTexture(GL_TEXTURE0 + SHADOW_TEXTURE_UNIT + 1);
+    GLStateCache::bindTexture(GL_TEXTURE_2D, shadowAtlas.getTexture(ShadowAtlas::DYNAMIC_LAYER));
+    GLStateCache::activeTexture(GL_TEXTURE0);
+    
+    GLStateCache::uniform1i(glGetUniformLocation(program, "staticShadowAtlas"), SHADOW_TEXTURE_UNIT);
+    GLStateCache::uniform1i(glGetUniformLocation(program, "dynamicShadowAtlas"), SHADOW_TEXTURE_UNIT + 1);
+    GLStateCache::uniform1i(glGetUniformLocation(program, "shadowedLightCount"), static_cast<GLint>(shadowedLights.size()));
+    
+    for (size_t i = 0; i < shadowedLights.size(); ++i) {
+        const ShadowedLight& light = shadowedLights[i];
+        std::string index = "[" + std::to_string(i) + "]";
+        
+        glm::vec4 position(0.0f);
+        glm::vec3 direction, color;
+        glm::vec2 cutOffs(-1.0f);
+        if (light.spot) {
+            const SpotLight& spot = spotLights[light.lightIndex];
+            position = glm::vec4(spot.position, 1.0f);
+            direction = spot.direction;
+            color = spot.color * spot.intensity;
+            cutOffs = glm::vec2(glm::cos(glm::radians(spot.cutOff)), glm::cos(glm::radians(spot.outerCutOff)));
+        } else {
+            const DirectionalLight& directional = directionalLights[light.lightIndex];
+            direction = directional.direction;
+            color = directional.color * directional.intensity;
+        }
+        
+        glm::vec4 rect = shadowAtlas.getTileRect(static_cast<int>(i));
+        GLStateCache::uniformMatrix4fv(glGetUniformLocation(program, ("shadowMatrices" + index).c_str()), 1, GL_FALSE, glm::value_ptr(light.lightSpaceMatrix));
+        GLStateCache::uniform4fv(glGetUniformLocation(program, ("shadowRects" + index).c_str()), 1, glm::value_ptr(rect));
+        GLStateCache::uniform4fv(glGetUniformLocation(program, ("shadowLightPositions" + index).c_str()), 1, glm::value_ptr(position));
+        GLStateCache::uniform3fv(glGetUniformLocation(program, ("shadowLightDirections" + index).c_str()), 1, glm::value_ptr(direction));
+        GLStateCache::uniform3fv(glGetUniformLocation(program, ("shadowLightColors" + index).c_str()), 1, glm::value_ptr(color));
+        GLStateCache::uniform2fv(glGetUniformLocation(program, ("shadowLightCutOffs" + index).c_str()), 1, glm::value_ptr(cutOffs));
+    }
 }
@@ -0,0 +1,413 @@
+#include "../include/MuseumWorld.hpp"
+#include "../include/Statue.hpp"
+#include "../include/RobotMesh.hpp"
+#include "../include/GLStateCache.hpp"
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/type_ptr.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <string>
+
+// Heykelin sınır küresi ve ziyaretçilerin bu kürenin dışında durduğu mesafe
+const float STATUE_RADIUS = 0.6f;
+const float VISITOR_VIEW_GAP = 0.8f;
+
+// Ziyaretçi yürüme hızı ve bir heykele bakma süresi aralıkları (saniye)
+const float VISITOR_MIN_SPEED = 0.6f;
+const float VISITOR_MAX_SPEED = 1.1f;
+const float VISITOR_MIN_DWELL = 3.0f;
+const float VISITOR_MAX_DWELL = 9.0f;
+const float WALL_MARGIN = 0.3f;
+
+// Ziyaretçi robot gövdesinin küçültülmüş hali; gövde mesh'i merkezden 0.4 birim yüksekliğinde
+const float VISITOR_SCALE = 0.35f;
+const float VISITOR_HALF_HEIGHT = 0.4f * VISITOR_SCALE;
+
+// xorshift32; her ziyaretçi kendi tohumunu taşır, böylece sonuç thread sayısından bağımsızdır
+static uint32_t nextRandom(uint32_t& seed) {
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    return seed;
+}
+
+static float randomUnit(uint32_t& seed) {
+    return static_cast<float>(nextRandom(seed) & 0xFFFFFF) / static_cast<float>(0x1000000);
+}
+
+MuseumWorld::MuseumWorld()
+    : minBounds(0.0f), maxBounds(0.0f), floorHeight(0.0f), viewingCount(0), visitorVersion(0), mesh(nullptr),
+      instanceBuffer(0), vao(0), uploadedCount(0), bufferCapacity(0), uploadedVersion(0) {
+}
+
+MuseumWorld::~MuseumWorld() {
+    cleanup();
+}
+
+bool MuseumWorld::initialize(const std::vector<Statue*>& statues, const RobotMesh* robotMesh,
+                             const glm::vec3& roomHalfSize) {
+    floorHeight = -roomHalfSize.y;
+    minBounds = glm::vec3(-roomHalfSize.x + WALL_MARGIN, floorHeight, -roomHalfSize.z + WALL_MARGIN);
+    maxBounds = glm::vec3(roomHalfSize.x - WALL_MARGIN, floorHeight, roomHalfSize.z - WALL_MARGIN);
+
+    // Heykelin konumu transformdan bir kez okunur; sonraki sorguların hepsi varlığa gider
+    statueEntities.clear();
+    for (size_t i = 0; i < statues.size(); i++) {
+        const Statue* statue = statues[i];
+        statueEntities.push_back(world.create(Position{ statue->getPosition() }, Rotation{ statue->getRotation() },
+                                              Bounds{ STATUE_RADIUS }, StatueRef{ static_cast<int>(i) }));
+    }
+    collectStatues(exhibits, &exhibitRadii);
+
+    mesh = robotMesh;
+    if (mesh) {
+        glGenBuffers(1, &instanceBuffer);
+        vao = mesh->createInstancedVAO(RobotMesh::PART_BODY, instanceBuffer);
+    }
+    return true;
+}
+
+void MuseumWorld::cleanup() {
+    if (instanceBuffer != 0) {
+        GLStateCache::deleteVertexArrays(1, &vao);
+        GLStateCache::deleteBuffers(1, &instanceBuffer);
+        vao = 0;
+        instanceBuffer = 0;
+    }
+    uploadedCount = 0;
+    bufferCapacity = 0;
+    world.clear();
+    statueEntities.clear();
+    exhibits.clear();
+    exhibitRadii.clear();
+    visitorMatrices.clear();
+    viewingCount = 0;
+}
+
+void MuseumWorld::spawnVisitors(int count) {
+    if (exhibits.empty()) return;
+
+    uint32_t spawnSeed = 0x9E3779B9u;
+    for (int i = 0; i < count; i++) {
+        // Giriş, odanın +Z duvarının önü
+        float along = randomUnit(spawnSeed);
+        glm::vec3 start(minBounds.x + (maxBounds.x - minBounds.x) * along, floorHeight, maxBounds.z);
+
+        Visitor visitor;
+        visitor.seed = nextRandom(spawnSeed) | 1u;
+        visitor.targetStatue = static_cast<int>(nextRandom(visitor.seed) % exhibits.size());
+        visitor.dwell = 0.0f;
+        visitor.speed = VISITOR_MIN_SPEED + (VISITOR_MAX_SPEED - VISITOR_MIN_SPEED) * randomUnit(visitor.seed);
+        world.create(Position{ start }, Velocity{ glm::vec3(0.0f) }, visitor);
+    }
+}
+
+glm::vec3 MuseumWorld::getStatuePosition(int index) {
+    const Position* position = world.get<Position>(statueEntities[index]);
+    return position ? position->value : glm::vec3(0.0f);
+}
+
+void MuseumWorld::collectStatues(std::vector<glm::vec3>& positions, std::vector<float>* radii) {
+    positions.assign(statueEntities.size(), glm::vec3(0.0f));
+    if (radii) radii->assign(statueEntities.size(), 0.0f);
+    world.eachChunk<Position, Bounds, StatueRef>([&positions, radii](size_t count, const Entity*,
+                                                                    const Position* position, const Bounds* bounds,
+                                                                    const StatueRef* statue) {
+        for (size_t i = 0; i < count; i++) {
+            positions[statue[i].index] = position[i].value;
+            if (radii) (*radii)[statue[i].index] = bounds[i].radius;
+        }
+    });
+}
+
+size_t MuseumWorld::getVisitorCount() const {
+    return world.count(EntityWorld::maskOf<Visitor>());
+}
+
+void MuseumWorld::updateVisitors(float deltaTime) {
+    collectStatues(exhibits, &exhibitRadii);
+    if (exhibits.empty()) return;
+
+    std::atomic<int> viewing(0);
+    const std::vector<glm::vec3>& targets = exhibits;
+    const std::vector<float>& radii = exhibitRadii;
+    const glm::vec3 low = minBounds;
+    const glm::vec3 high = maxBounds;
+    world.parallelEachChunk<Position, Velocity, Visitor>(
+        [&viewing, &targets, &radii, low, high, deltaTime](size_t count, const Entity*, Position* positions,
+                                                           Velocity* velocities, Visitor* visitors) {
+            int chunkViewing = 0;
+            for (size_t i = 0; i < count; i++) {
+                Visitor& visitor = visitors[i];
+                glm::vec3& position = positions[i].value;
+
+                if (visitor.dwell > 0.0f) {
+                    visitor.dwell -= deltaTime;
+                    velocities[i].value = glm::vec3(0.0f);
+                    if (visitor.dwell > 0.0f) {
+                        chunkViewing++;
+                        continue;
+                    }
+                    // Bakma bitti; aynı heykele tekrar gitmemek için kaydırılır
+                    int next = static_cast<int>(nextRandom(visitor.seed) % targets.size());
+                    if (next == visitor.targetStatue && targets.size() > 1) {
+                        next = (next + 1) % static_cast<int>(targets.size());
+                    }
+                    visitor.targetStatue = next;
+                    visitor.dwell = 0.0f;
+                }
+
+                // Her ziyaretçi heykelin çevresinde tohumuna göre farklı bir açıdan bakar
+                float angle = static_cast<float>(visitor.seed & 0xFFFF) * (6.2831853f / 65536.0f);
+                float viewDistance = radii[visitor.targetStatue] + VISITOR_VIEW_GAP;
+                glm::vec3 target = targets[visitor.targetStatue] +
+                                   glm::vec3(std::cos(angle), 0.0f, std::sin(angle)) * viewDistance;
+                target = glm::clamp(target, low, high);
+                target.y = low.y;
+
+                glm::vec3 offset = target - position;
+                float distance = glm::length(offset);
+                float stepLength = visitor.speed * deltaTime;
+                if (distance <= stepLength) {
+                    position = target;
+                    velocities[i].value = glm::vec3(0.0f);
+                    visitor.dwell = VISITOR_MIN_DWELL + (VISITOR_MAX_DWELL - VISITOR_MIN_DWELL) * randomUnit(visitor.seed);
+                    chunkViewing++;
+                } else {
+                    velocities[i].value = offset * (visitor.speed / distance);
+                    position += velocities[i].value * deltaTime;
+                }
+            }
+            viewing.fetch_add(chunkViewing, std::memory_order_relaxed);
+        });
+    viewingCount = viewing.load();
+    visitorVersion++;
+}
+
+// Yürüyen ziyaretçi hızının yönüne, bakan ziyaretçi heykeline döner
+void MuseumWorld::captureVisitors(FleetInstances& instances) {
+    visitorMatrices.clear();
+    const std::vector<glm::vec3>& targets = exhibits;
+    std::vector<glm::mat4>& matrices = visitorMatrices;
+    world.eachChunk<Position, Velocity, Visitor>([&targets, &matrices](size_t count, const Entity*,
+                                                                       const Position* positions,
+                                                                       const Velocity* velocities,
+                                                                       const Visitor* visitors) {
+        for (size_t i = 0; i < count; i++) {
+            const glm::vec3& position = positions[i].value;
+            glm::vec3 facing = velocities[i].value;
+            if (facing.x == 0.0f && facing.z == 0.0f) {
+                facing = targets[visitors[i].targetStatue] - position;
+            }
+            float heading = std::atan2(-facing.x, -facing.z);
+
+            glm::mat4 model = glm::translate(glm::mat4(1.0f), position + glm::vec3(0.0f, VISITOR_HALF_HEIGHT, 0.0f));
+            model = glm::rotate(model, heading, glm::vec3(0.0f, 1.0f, 0.0f));
+            matrices.push_back(glm::scale(model, glm::vec3(VISITOR_SCALE)));
+        }
+    });
+
+    instances.bodies = visitorMatrices;
+    instances.arms.clear();
+    instances.version = visitorVersion;
+}
+
+// Tampon büyümedikçe yeniden ayrılmaz; eski içerik sürücü tarafından bırakılsın diye önce boşaltılır
+void MuseumWorld::uploadVisitors(const FleetInstances& instances) {
+    size_t count = instances.bodies.size();
+    if (instanceBuffer == 0 || (count == uploadedCount && instances.version == uploadedVersion)) return;
+
+    GLStateCache::bindBuffer(GL_ARRAY_BUFFER, instanceBuffer);
+    if (count > bufferCapacity) {
+        glBufferData(GL_ARRAY_BUFFER, count * sizeof(glm::mat4), instances.bodies.data(), GL_STREAM_DRAW);
+    } else {
+        glBufferData(GL_ARRAY_BUFFER, bufferCapacity * sizeof(glm::mat4), nullptr, GL_STREAM_DRAW);
+        glBufferSubData(GL_ARRAY_BUFFER, 0, count * sizeof(glm::mat4), instances.bodies.data());
+    }
+    GLStateCache::bindBuffer(GL_ARRAY_BUFFER, 0);
+    bufferCapacity = std::max(bufferCapacity, count);
+    uploadedCount = count;
+    uploadedVersion = instances.version;
+}
+
+void MuseumWorld::renderVisitors(const glm::mat4& viewMatrix, const glm::mat4& projectionMatrix, GLuint shaderProgram) const {
+    if (uploadedCount == 0) return;
+    GLStateCache::useProgram(shaderProgram);
+    GLStateCache::uniformMatrix4fv(glGetUniformLocation(shaderProgram, "view"), 1, GL_FALSE, glm::value_ptr(viewMatrix));
+    GLStateCache::uniformMatrix4fv(glGetUniformLocation(shaderProgram, "projection"), 1, GL_FALSE, glm::value_ptr(projectionMatrix));
+    GLStateCache::activeTexture(GL_TEXTURE0);
+    GLStateCache::bindTexture(GL_TEXTURE_2D, mesh->getRobotTextureID());
+    GLStateCache::uniform1i(glGetUniformLocation(shaderProgram, "texture_diffuse1"), 0);
+
+    GLStateCache::bindVertexArray(vao);
+    glDrawElementsInstanced(GL_TRIANGLES, static_cast<GLsizei>(mesh->getRobotIndicesCount()), GL_UNSIGNED_INT, 0,
+                            static_cast<GLsizei>(uploadedCount));
+    GLStateCache::bindVertexArray(0);
+}
+
+// Ölçümde karşılaştırılan eski düzen: Statue gibi sıcak ve soğuk veriyi karıştıran, tek tek
+// heap'e ayrılmış nesneler
+namespace {
+
+struct LegacyExhibit {
+    std::string modelPath;
+    glm::vec3 position;
+    glm::vec3 rotation;
+    glm::vec3 scale;
+    glm::vec3 velocity;
+    std::string title;
+    std::string description;
+    std::string artist;
+    int year;
+    float radius;
+    GLuint VAO, VBO, EBO;
+    std::vector<float> vertices;
+};
+
+volatile float benchmarkSink = 0.0f;
+
+double elapsedSeconds(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+}
+
+bool MuseumWorld::runBenchmarks() {
+    const size_t COUNTS[2] = { 10000, 100000 };
+    const size_t WORK = 4000000;  // her ölçümde toplam varlık ziyareti
+    const glm::vec3 point(1.0f, 0.0f, -2.0f);
+    const float RANGE = 6.0f;
+    const float STEP = 1.0f / 60.0f;
+
+    JobSystem::instance().initialize();
+    std::cout << "ECS ölçümü: " << JobSystem::instance().getWorkerCount() << " çalışan" << std::endl;
+
+    bool allValid = true;
+
+    for (size_t count : COUNTS) {
+        const int repeat = static_cast<int>(std::max<size_t>(1, WORK / count));
+        std::mt19937 random(777);
+        std::uniform_real_distribution<float> coordinate(-20.0f, 20.0f);
+        std::uniform_real_distribution<float> speed(-1.0f, 1.0f);
+
+        // Aynı veriyle iki düzen
+        std::vector<LegacyExhibit*> objects;
+        objects.reserve(count);
+        EntityWorld ecs;
+        for (size_t i = 0; i < count; i++) {
+            LegacyExhibit* object = new LegacyExhibit();
+            object->modelPath = "models/exhibit_" + std::to_string(i) + "/statue_high_detail.obj";
+            object->position = glm::vec3(coordinate(random), 0.0f, coordinate(random));
+            object->rotation = glm::vec3(0.0f);
+            object->scale = glm::vec3(1.0f);
+            object->velocity = glm::vec3(speed(random), 0.0f, speed(random));
+            object->title = "Eser " + std::to_string(i);
+            object->description = "Müze koleksiyonundan, uzun açıklama metni ile birlikte sergilenen bir eser #" +
+                                  std::to_string(i);
+            object->artist = "Bilinmeyen sanatçı";
+            object->year = 1900 + static_cast<int>(i % 120);
+            object->radius = 0.3f + 0.1f * static_cast<float>(i % 5);
+            object->VAO = object->VBO = object->EBO = 0;
+            object->vertices.assign(24, 0.0f);
+            objects.push_back(object);
+
+            ecs.create(Position{ object->position }, Velocity{ object->velocity }, Bounds{ object->radius },
+                       StatueRef{ static_cast<int>(i) });
+        }
+
+        // Yakınlık: menzildeki nesneleri say (salt okuma)
+        size_t objectHits = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (int r = 0; r < repeat; r++) {
+            objectHits = 0;
+            for (const LegacyExhibit* object : objects) {
+                float reach = RANGE + object->radius;
+                glm::vec3 offset = object->position - point;
+                objectHits += glm::dot(offset, offset) <= reach * reach;
+            }
+        }
+        double objectProximity = elapsedSeconds(start);
+
+        size_t ecsHits = 0;
+        start = std::chrono::steady_clock::now();
+        for (int r = 0; r < repeat; r++) {
+            ecsHits = 0;
+            ecs.eachChunk<Position, Bounds>([&ecsHits, point, RANGE](size_t chunkCount, const Entity*,
+                                                                     const Position* positions, const Bounds* bounds) {
+                size_t hits = 0;
+                for (size_t i = 0; i < chunkCount; i++) {
+                    float reach = RANGE + bounds[i].radius;
+                    glm::vec3 offset = positions[i].value - point;
+                    hits += glm::dot(offset, offset) <= reach * reach;
+                }
+                ecsHits += hits;
+            });
+        }
+        double ecsProximity = elapsedSeconds(start);
+
+        // Entegrasyon: konum += hız * adım (okuma + yazma)
+        start = std::chrono::steady_clock::now();
+        for (int r = 0; r < repeat; r++) {
+            for (LegacyExhibit* object : objects) {
+                object->position += object->velocity * STEP;
+            }
+        }
+        double objectIntegrate = elapsedSeconds(start);
+
+        start = std::chrono::steady_clock::now();
+        for (int r = 0; r < repeat; r++) {
+            ecs.eachChunk<Position, Velocity>([STEP](size_t chunkCount, const Entity*, Position* positions,
+                                                     const Velocity* velocities) {
+                for (size_t i = 0; i < chunkCount; i++) {
+                    positions[i].value += velocities[i].value * STEP;
+                }
+            });
+        }
+        double ecsIntegrate = elapsedSeconds(start);
+
+        start = std::chrono::steady_clock::now();
+        for (int r = 0; r < repeat; r++) {
+            ecs.parallelEachChunk<Position, Velocity>([STEP](size_t chunkCount, const Entity*, Position* positions,
+                                                             const Velocity* velocities) {
+                for (size_t i = 0; i < chunkCount; i++) {
+                    positions[i].value += velocities[i].value * STEP;
+                }
+            });
+        }
+        double parallelIntegrate = elapsedSeconds(start);
+
+        // Doğruluk: iki düzen aynı sayıda entegre edildi; fark sadece derleyicinin işlem birleştirmesinden olabilir
+        for (int r = 0; r < repeat; r++) {
+            for (LegacyExhibit* object : objects) {
+                object->position += object->velocity * STEP;
+            }
+        }
+        size_t mismatches = 0;
+        ecs.each<Position, StatueRef>([&objects, &mismatches](Entity, Position& position, StatueRef& ref) {
+            mismatches += glm::distance(position.value, objects[ref.index]->position) > 1e-3f;
+        });
+        bool valid = objectHits == ecsHits && mismatches == 0;
+        allValid = allValid && valid;
+        benchmarkSink = static_cast<float>(objectHits);
+
+        double visits = static_cast<double>(count) * repeat;
+        std::cout << "[" << count << " varlık, " << ecs.getChunkCount() << " parça] doğruluk "
+                  << (valid ? "TAMAM" : "HATA") << " (yakın " << objectHits << "/" << ecsHits
+                  << ", konum farkı " << mismatches << ")" << std::endl;
+        std::cout << "  yakınlık: nesne " << objectProximity * 1e9 / visits << " ns, ECS "
+                  << ecsProximity * 1e9 / visits << " ns/varlık (" << objectProximity / ecsProximity << "x)" << std::endl;
+        std::cout << "  entegrasyon: nesne " << objectIntegrate * 1e9 / visits << " ns, ECS "
+                  << ecsIntegrate * 1e9 / visits << " ns, paralel ECS " << parallelIntegrate * 1e9 / visits
+                  << " ns/varlık (" << objectIntegrate / ecsIntegrate << "x, paralel "
+                  << objectIntegrate / parallelIntegrate << "x)" << std::endl;
+
+        for (LegacyExhibit* object : objects) {
+            delete object;
+        }
+    }
+    return allValid;
+}
@@ -0,0 +1,567 @@
+#include "../include/NavGrid.hpp"
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <iostream>
+#include <limits>
+
+const float SQRT2 = 1.41421356f;
+
+NavGrid::NavGrid()
+    : origin(0.0f), extent(0.0f), cellSize(0.1f), agentRadius(0.0f), width(0), height(0), mainRegion(-1), searchStamp(0),
+      cacheHits(0), cacheMisses(0) {
+}
+
+bool NavGrid::initialize(const glm::vec2& minCorner, const glm::vec2& maxCorner, float size, float radius) {
+    if (size <= 0.0f || maxCorner.x <= minCorner.x || maxCorner.y <= minCorner.y) {
+        std::cerr << "Geçersiz yol ızgarası boyutu!" << std::endl;
+        return false;
+    }
+    origin = minCorner;
+    extent = maxCorner - minCorner;
+    cellSize = size;
+    agentRadius = radius;
+    width = std::max(1, static_cast<int>(std::ceil(extent.x / cellSize)));
+    height = std::max(1, static_cast<int>(std::ceil(extent.y / cellSize)));
+
+    size_t cells = static_cast<size_t>(width) * height;
+    blocked.assign(cells, 0);
+    walkable.assign(cells, 0);
+    regions.assign(cells, -1);
+    mainRegion = -1;
+    costs.assign(cells, 0.0f);
+    parents.assign(cells, -1);
+    openStamps.assign(cells, 0);
+    closedStamps.assign(cells, 0);
+    searchStamp = 0;
+    pathCache.clear();
+    return true;
+}
+
+glm::ivec2 NavGrid::cellOf(const glm::vec2& point) const {
+    glm::vec2 local = (point - origin) / cellSize;
+    int x = std::min(std::max(static_cast<int>(std::floor(local.x)), 0), width - 1);
+    int z = std::min(std::max(static_cast<int>(std::floor(local.y)), 0), height - 1);
+    return glm::ivec2(x, z);
+}
+
+glm::vec2 NavGrid::cellCenter(int cell) const {
+    int x = cell % width;
+    int z = cell / width;
+    return origin + glm::vec2(x + 0.5f, z + 0.5f) * cellSize;
+}
+
+void NavGrid::markBlocked(int x, int z) {
+    if (x < 0 || z < 0 || x >= width || z >= height) return;
+    blocked[cellIndex(x, z)] = 1;
+}
+
+void NavGrid::addCircle(const glm::vec2& center, float radius) {
+    glm::ivec2 low = cellOf(center - glm::vec2(radius));
+    glm::ivec2 high = cellOf(center + glm::vec2(radius));
+    for (int z = low.y; z <= high.y; z++) {
+        for (int x = low.x; x <= high.x; x++) {
+            glm::vec2 offset = cellCenter(cellIndex(x, z)) - center;
+            if (glm::dot(offset, offset) <= radius * radius) markBlocked(x, z);
+        }
+    }
+    glm::ivec2 middle = cellOf(center);
+    markBlocked(middle.x, middle.y);
+}
+
+// Kutunun değdiği tüm hücreler
+void NavGrid::addBox(const glm::vec2& minCorner, const glm::vec2& maxCorner) {
+    glm::ivec2 low = cellOf(minCorner);
+    glm::ivec2 high = cellOf(maxCorner);
+    for (int z = low.y; z <= high.y; z++) {
+        for (int x = low.x; x <= high.x; x++) {
+            markBlocked(x, z);
+        }
+    }
+}
+
+// Merkezi üçgenin içinde kalan hücreler ve köşelerin hücreleri; hücreden küçük
+// üçgenlerin kaçırdığı kısımları şişirme kapatır
+void NavGrid::addTriangle(const glm::vec2& a, const glm::vec2& b, const glm::vec2& c) {
+    glm::ivec2 low = cellOf(glm::min(a, glm::min(b, c)));
+    glm::ivec2 high = cellOf(glm::max(a, glm::max(b, c)));
+    for (const glm::vec2* vertex : { &a, &b, &c }) {
+        if (contains(*vertex)) {
+            glm::ivec2 cell = cellOf(*vertex);
+            markBlocked(cell.x, cell.y);
+        }
+    }
+
+    float area = (b.x - a.x) * (c.y - a.y) - (b.y - a.y) * (c.x - a.x);
+    if (area == 0.0f) return;
+    float sign = area > 0.0f ? 1.0f : -1.0f;
+    for (int z = low.y; z <= high.y; z++) {
+        for (int x = low.x; x <= high.x; x++) {
+            glm::vec2 p = cellCenter(cellIndex(x, z));
+            float w0 = ((b.x - a.x) * (p.y - a.y) - (b.y - a.y) * (p.x - a.x)) * sign;
+            float w1 = ((c.x - b.x) * (p.y - b.y) - (c.y - b.y) * (p.x - b.x)) * sign;
+            float w2 = ((a.x - c.x) * (p.y - c.y) - (a.y - c.y) * (p.x - c.x)) * sign;
+            if (w0 >= 0.0f && w1 >= 0.0f && w2 >= 0.0f) markBlocked(x, z);
+        }
+    }
+}
+
+void NavGrid::build() {
+    // Merkezi duvara ajan yarıçapından yakın hücreler yürünemez
+    for (int z = 0; z < height; z++) {
+        for (int x = 0; x < width; x++) {
+            glm::vec2 center = glm::vec2(x + 0.5f, z + 0.5f) * cellSize;
+            bool nearWall = center.x < agentRadius || center.y < agentRadius ||
+                            extent.x - center.x < agentRadius || extent.y - center.y < agentRadius;
+            walkable[cellIndex(x, z)] = nearWall ? 0 : 1;
+        }
+    }
+
+    // Her engel hücresinin çevresindeki ajan yarıçapı içindeki hücreler kapatılır
+    int reach = static_cast<int>(std::ceil(agentRadius / cellSize));
+    std::vector<glm::ivec2> kernel;
+    for (int oz = -reach; oz <= reach; oz++) {
+        for (int ox = -reach; ox <= reach; ox++) {
+            float distance = std::sqrt(static_cast<float>(ox * ox + oz * oz)) * cellSize;
+            if (distance <= agentRadius) kernel.push_back(glm::ivec2(ox, oz));
+        }
+    }
+    for (int z = 0; z < height; z++) {
+        for (int x = 0; x < width; x++) {
+            if (!blocked[cellIndex(x, z)]) continue;
+            for (const glm::ivec2& offset : kernel) {
+                int nx = x + offset.x;
+                int nz = z + offset.y;
+                if (nx < 0 || nz < 0 || nx >= width || nz >= height) continue;
+                walkable[cellIndex(nx, nz)] = 0;
+            }
+        }
+    }
+
+    labelRegions();
+    pathCache.clear();
+}
+
+// Taşma doldurma; komşuluk kuralı aramayla aynı (çaprazda köşe kesilmez)
+void NavGrid::labelRegions() {
+    std::fill(regions.begin(), regions.end(), -1);
+    mainRegion = -1;
+    size_t mainSize = 0;
+    int regionCount = 0;
+    std::vector<int> stack;
+    for (int cell = 0; cell < width * height; cell++) {
+        if (!walkable[cell] || regions[cell] >= 0) continue;
+
+        int region = regionCount++;
+        size_t size = 0;
+        regions[cell] = region;
+        stack.push_back(cell);
+        while (!stack.empty()) {
+            int current = stack.back();
+            stack.pop_back();
+            size++;
+            int x = current % width;
+            int z = current / width;
+            for (int dz = -1; dz <= 1; dz++) {
+                for (int dx = -1; dx <= 1; dx++) {
+                    if (!cellWalkable(x + dx, z + dz)) continue;
+                    if (dx != 0 && dz != 0 && (!cellWalkable(x + dx, z) || !cellWalkable(x, z + dz))) continue;
+                    int next = cellIndex(x + dx, z + dz);
+                    if (regions[next] >= 0) continue;
+                    regions[next] = region;
+                    stack.push_back(next);
+                }
+            }
+        }
+        if (size > mainSize) {
+            mainSize = size;
+            mainRegion = region;
+        }
+    }
+}
+
+int NavGrid::regionOf(const glm::vec2& point) const {
+    if (!isWalkable(point)) return -1;
+    glm::ivec2 cell = cellOf(point);
+    return regions[cellIndex(cell.x, cell.y)];
+}
+
+int NavGrid::snappedCell(const glm::vec2& point) const {
+    glm::vec2 snapped = point;
+    if (!isWalkable(snapped) && !nearestWalkable(point, snapped, mainRegion)) return -1;
+    glm::ivec2 cell = cellOf(snapped);
+    return cellIndex(cell.x, cell.y);
+}
+
+bool NavGrid::contains(const glm::vec2& point) const {
+    glm::vec2 local = point - origin;
+    return local.x >= 0.0f && local.y >= 0.0f && local.x <= extent.x && local.y <= extent.y;
+}
+
+bool NavGrid::isWalkable(const glm::vec2& point) const {
+    if (!contains(point)) return false;
+    glm::ivec2 cell = cellOf(point);
+    return cellWalkable(cell.x, cell.y);
+}
+
+size_t NavGrid::getWalkableCount() const {
+    return static_cast<size_t>(std::count(walkable.begin(), walkable.end(), 1));
+}
+
+// Noktanın hücresinden dışa doğru halka halka arar
+bool NavGrid::nearestWalkable(const glm::vec2& point, glm::vec2& result, int region) const {
+    glm::ivec2 start = cellOf(point);
+    int maxRing = std::max(width, height);
+    for (int ring = 0; ring <= maxRing; ring++) {
+        float bestDistance = std::numeric_limits<float>::max();
+        int best = -1;
+        for (int z = start.y - ring; z <= start.y + ring; z++) {
+            for (int x = start.x - ring; x <= start.x + ring; x++) {
+                // Sadece halkanın kenarı
+                if (std::abs(x - start.x) != ring && std::abs(z - start.y) != ring) continue;
+                if (!cellWalkable(x, z)) continue;
+                if (region >= 0 && regions[cellIndex(x, z)] != region) continue;
+                glm::vec2 offset = cellCenter(cellIndex(x, z)) - point;
+                float distance = glm::dot(offset, offset);
+                if (distance < bestDistance) {
+                    bestDistance = distance;
+                    best = cellIndex(x, z);
+                }
+            }
+        }
+        if (best >= 0) {
+            result = cellCenter(best);
+            return true;
+        }
+    }
+    return false;
+}
+
+bool NavGrid::findPath(const glm::vec2& start, const glm::vec2& goal, std::vector<glm::vec2>& path, Search mode) {
+    path.clear();
+    if (walkable.empty()) return false;
+
+    // Engelin içindeki uçlar en yakın yürünebilir noktaya çekilir; hedef başlangıçtan
+    // ulaşılamayan bir cepte kalırsa başlangıcın bölgesindeki en yakın noktaya taşınır
+    glm::vec2 from = start;
+    glm::vec2 to = goal;
+    if (!isWalkable(from) && !nearestWalkable(start, from, mainRegion) && !nearestWalkable(start, from)) return false;
+    if (!isWalkable(to) && !nearestWalkable(goal, to, mainRegion) && !nearestWalkable(goal, to)) return false;
+    if (regionOf(from) != regionOf(to) && !nearestWalkable(goal, to, regionOf(from))) return false;
+
+    glm::ivec2 startCell = cellOf(from);
+    glm::ivec2 goalCell = cellOf(to);
+    int startIndex = cellIndex(startCell.x, startCell.y);
+    int goalIndex = cellIndex(goalCell.x, goalCell.y);
+
+    if (from != start) path.push_back(start);
+    path.push_back(from);
+
+    // Önbellekteki ara noktalar aynı hücre çiftinin ilk sorgusundan kalır; uçlar hücre
+    // içinde kaydığı için ilk ve son parça en fazla bir hücre kadar farklı olabilir
+    uint64_t key = (static_cast<uint64_t>(startIndex) << 32) | static_cast<uint32_t>(goalIndex);
+    if (mode == SEARCH_JPS) {
+        auto cached = pathCache.find(key);
+        if (cached != pathCache.end()) {
+            cacheHits++;
+            path.insert(path.end(), cached->second.begin(), cached->second.end());
+            path.push_back(to);
+            return true;
+        }
+        cacheMisses++;
+    }
+
+    if (search(startIndex, goalIndex, mode) < 0.0f) {
+        path.clear();
+        return false;
+    }
+
+    // cellPath hedeften başa doğru; uç hücrelerin yerine gerçek uç noktalar kullanılır
+    std::vector<glm::vec2> points;
+    points.reserve(cellPath.size() + 2);
+    points.push_back(from);
+    for (size_t i = cellPath.size() - 1; i-- > 1;) {
+        points.push_back(cellCenter(cellPath[i]));
+    }
+    points.push_back(to);
+    smoothPath(points);
+
+    std::vector<glm::vec2> interior(points.begin() + 1, points.end() - 1);
+    if (mode == SEARCH_JPS) {
+        if (pathCache.size() >= MAX_CACHED_PATHS) {
+            pathCache.clear();
+        }
+        pathCache[key] = interior;
+    }
+    path.insert(path.end(), interior.begin(), interior.end());
+    path.push_back(to);
+    return true;
+}
+
+float NavGrid::searchCost(const glm::vec2& start, const glm::vec2& goal, Search mode) {
+    if (!isWalkable(start) || !isWalkable(goal)) return -1.0f;
+    glm::ivec2 startCell = cellOf(start);
+    glm::ivec2 goalCell = cellOf(goal);
+    return search(cellIndex(startCell.x, startCell.y), cellIndex(goalCell.x, goalCell.y), mode);
+}
+
+// Hedefsiz Dijkstra; tüm ulaşılabilir hücreler kapanana kadar sürer
+void NavGrid::computeDistanceField(const glm::vec2& source, std::vector<float>& field) {
+    field.assign(walkable.size(), -1.0f);
+    int sourceCell = snappedCell(source);
+    if (sourceCell < 0) return;
+
+    search(sourceCell, -1, SEARCH_ASTAR);
+    for (size_t cell = 0; cell < field.size(); cell++) {
+        if (closedStamps[cell] == searchStamp) field[cell] = costs[cell];
+    }
+}
+
+float NavGrid::sampleField(const std::vector<float>& field, const glm::vec2& point) const {
+    int cell = snappedCell(point);
+    return cell >= 0 && static_cast<size_t>(cell) < field.size() ? field[cell] : -1.0f;
+}
+
+// Sekiz yönlü ızgarada oktil mesafe; köşe kesilmediği için kabul edilebilir tahmin
+static float octileDistance(int dx, int dz, float cellSize) {
+    dx = std::abs(dx);
+    dz = std::abs(dz);
+    return (std::max(dx, dz) + (SQRT2 - 1.0f) * std::min(dx, dz)) * cellSize;
+}
+
+void NavGrid::pushOpen(int cell, int parent, float cost, int goalCell) {
+    if (closedStamps[cell] == searchStamp) return;
+    if (openStamps[cell] == searchStamp && costs[cell] <= cost) return;
+    openStamps[cell] = searchStamp;
+    costs[cell] = cost;
+    parents[cell] = parent;
+
+    OpenNode node;
+    node.cell = cell;
+    node.priority = cost;
+    if (goalCell >= 0) {
+        node.priority += octileDistance(cell % width - goalCell % width, cell / width - goalCell / width, cellSize);
+    }
+    openList.push_back(node);
+    std::push_heap(openList.begin(), openList.end(), std::greater<OpenNode>());
+}
+
+float NavGrid::search(int startCell, int goalCell, Search mode) {
+    // Damga taşarsa diziler bir kez sıfırlanır
+    if (++searchStamp == 0) {
+        std::fill(openStamps.begin(), openStamps.end(), 0);
+        std::fill(closedStamps.begin(), closedStamps.end(), 0);
+        searchStamp = 1;
+    }
+    openList.clear();
+    cellPath.clear();
+    pushOpen(startCell, -1, 0.0f, goalCell);
+
+    while (!openList.empty()) {
+        std::pop_heap(openList.begin(), openList.end(), std::greater<OpenNode>());
+        int cell = openList.back().cell;
+        openList.pop_back();
+
+        // Kuyrukta aynı hücrenin eski kopyaları kalabilir
+        if (closedStamps[cell] == searchStamp) continue;
+        closedStamps[cell] = searchStamp;
+
+        if (cell == goalCell) {
+            for (int node = goalCell; node >= 0; node = parents[node]) {
+                cellPath.push_back(node);
+            }
+            return costs[goalCell];
+        }
+
+        if (mode == SEARCH_JPS) {
+            expandJumpPoints(cell, goalCell);
+        } else {
+            expandNeighbors(cell, goalCell);
+        }
+    }
+    return -1.0f;
+}
+
+// Düz A*: sekiz komşu, çapraz geçiş için iki yan komşu da açık olmalı
+void NavGrid::expandNeighbors(int cell, int goalCell) {
+    int x = cell % width;
+    int z = cell / width;
+    for (int dz = -1; dz <= 1; dz++) {
+        for (int dx = -1; dx <= 1; dx++) {
+            if (dx == 0 && dz == 0) continue;
+            if (!cellWalkable(x + dx, z + dz)) continue;
+            if (dx != 0 && dz != 0 && (!cellWalkable(x + dx, z) || !cellWalkable(x, z + dz))) continue;
+            float step = (dx != 0 && dz != 0) ? SQRT2 * cellSize : cellSize;
+            pushOpen(cellIndex(x + dx, z + dz), cell, costs[cell] + step, goalCell);
+        }
+    }
+}
+
+// Ebeveynden gelen yöne göre budanmış komşulardan atlayarak sıçrama noktalarına gider
+void NavGrid::expandJumpPoints(int cell, int goalCell) {
+    int x = cell % width;
+    int z = cell / width;
+    int parent = parents[cell];
+
+    glm::ivec2 directions[8];
+    int count = 0;
+    if (parent < 0) {
+        for (int dz = -1; dz <= 1; dz++) {
+            for (int dx = -1; dx <= 1; dx++) {
+                if (dx == 0 && dz == 0) continue;
+                if (!cellWalkable(x + dx, z + dz)) continue;
+                if (dx != 0 && dz != 0 && (!cellWalkable(x + dx, z) || !cellWalkable(x, z + dz))) continue;
+                directions[count++] = glm::ivec2(dx, dz);
+            }
+        }
+    } else {
+        int dx = glm::sign(x - parent % width);
+        int dz = glm::sign(z - parent / width);
+        if (dx != 0 && dz != 0) {
+            bool sideZ = cellWalkable(x, z + dz);
+            bool sideX = cellWalkable(x + dx, z);
+            if (sideZ) directions[count++] = glm::ivec2(0, dz);
+            if (sideX) directions[count++] = glm::ivec2(dx, 0);
+            if (sideZ && sideX) directions[count++] = glm::ivec2(dx, dz);
+        } else if (dx != 0) {
+            bool ahead = cellWalkable(x + dx, z);
+            bool up = cellWalkable(x, z + 1);
+            bool down = cellWalkable(x, z - 1);
+            if (ahead) {
+                directions[count++] = glm::ivec2(dx, 0);
+                if (up) directions[count++] = glm::ivec2(dx, 1);
+                if (down) directions[count++] = glm::ivec2(dx, -1);
+            }
+            if (up) directions[count++] = glm::ivec2(0, 1);
+            if (down) directions[count++] = glm::ivec2(0, -1);
+        } else {
+            bool ahead = cellWalkable(x, z + dz);
+            bool right = cellWalkable(x + 1, z);
+            bool left = cellWalkable(x - 1, z);
+            if (ahead) {
+                directions[count++] = glm::ivec2(0, dz);
+                if (right) directions[count++] = glm::ivec2(1, dz);
+                if (left) directions[count++] = glm::ivec2(-1, dz);
+            }
+            if (right) directions[count++] = glm::ivec2(1, 0);
+            if (left) directions[count++] = glm::ivec2(-1, 0);
+        }
+    }
+
+    for (int i = 0; i < count; i++) {
+        int jumpPoint;
+        if (!jump(x + directions[i].x, z + directions[i].y, directions[i].x, directions[i].y, goalCell, jumpPoint)) {
+            continue;
+        }
+        int jx = jumpPoint % width;
+        int jz = jumpPoint / width;
+        pushOpen(jumpPoint, cell, costs[cell] + octileDistance(jx - x, jz - z, cellSize), goalCell);
+    }
+}
+
+// Köşe kesmeyen JPS: düz giderken yanda zorunlu komşu çıkınca, çapraz giderken düz
+// kollardan biri bir sıçrama noktası bulunca durur
+bool NavGrid::jump(int x, int z, int dx, int dz, int goalCell, int& result) const {
+    while (true) {
+        if (!cellWalkable(x, z)) return false;
+        int cell = cellIndex(x, z);
+        if (cell == goalCell) {
+            result = cell;
+            return true;
+        }
+
+        if (dx != 0 && dz != 0) {
+            int branch;
+            if (jump(x + dx, z, dx, 0, goalCell, branch) || jump(x, z + dz, 0, dz, goalCell, branch)) {
+                result = cell;
+                return true;
+            }
+        } else if (dx != 0) {
+            if ((cellWalkable(x, z - 1) && !cellWalkable(x - dx, z - 1)) ||
+                (cellWalkable(x, z + 1) && !cellWalkable(x - dx, z + 1))) {
+                result = cell;
+                return true;
+            }
+        } else {
+            if ((cellWalkable(x - 1, z) && !cellWalkable(x - 1, z - dz)) ||
+                (cellWalkable(x + 1, z) && !cellWalkable(x + 1, z - dz))) {
+                result = cell;
+                return true;
+            }
+        }
+
+        if (!cellWalkable(x + dx, z) || !cellWalkable(x, z + dz)) return false;
+        x += dx;
+        z += dz;
+    }
+}
+
+// Hücre hücre ilerleyen DDA; tam köşeden geçerken iki yan hücre de açık olmalı
+bool NavGrid::hasLineOfSight(const glm::vec2& from, const glm::vec2& to) const {
+    glm::vec2 a = (from - origin) / cellSize;
+    glm::vec2 b = (to - origin) / cellSize;
+    glm::ivec2 cell = cellOf(from);
+    glm::ivec2 end = cellOf(to);
+    if (!cellWalkable(cell.x, cell.y) || !cellWalkable(end.x, end.y)) return false;
+
+    glm::vec2 delta = b - a;
+    int stepX = delta.x > 0.0f ? 1 : -1;
+    int stepZ = delta.y > 0.0f ? 1 : -1;
+    const float INFINITE = std::numeric_limits<float>::max();
+    float deltaX = delta.x != 0.0f ? 1.0f / std::fabs(delta.x) : INFINITE;
+    float deltaZ = delta.y != 0.0f ? 1.0f / std::fabs(delta.y) : INFINITE;
+    float nextX = delta.x != 0.0f ? (stepX > 0 ? cell.x + 1 - a.x : a.x - cell.x) * deltaX : INFINITE;
+    float nextZ = delta.y != 0.0f ? (stepZ > 0 ? cell.y + 1 - a.y : a.y - cell.y) * deltaZ : INFINITE;
+
+    int steps = std::abs(end.x - cell.x) + std::abs(end.y - cell.y);
+    while (steps > 0 && cell != end) {
+        const float EPSILON = 1e-6f;
+        if (nextX < nextZ - EPSILON) {
+            cell.x += stepX;
+            nextX += deltaX;
+            steps--;
+        } else if (nextZ < nextX - EPSILON) {
+            cell.y += stepZ;
+            nextZ += deltaZ;
+            steps--;
+        } else {
+            if (!cellWalkable(cell.x + stepX, cell.y) || !cellWalkable(cell.x, cell.y + stepZ)) return false;
+            cell.x += stepX;
+            cell.y += stepZ;
+            nextX += deltaX;
+            nextZ += deltaZ;
+            steps -= 2;
+        }
+        if (!cellWalkable(cell.x, cell.y)) return false;
+    }
+    return true;
+}
+
+void NavGrid::smoothPath(std::vector<glm::vec2>& points) const {
+    if (points.size() <= 2) return;
+
+    std::vector<glm::vec2> result;
+    result.push_back(points.front());
+    size_t anchor = 0;
+    while (anchor < points.size() - 1) {
+        // Çapadan görülebilen en uzak nokta
+        size_t next = anchor + 1;
+        for (size_t candidate = points.size() - 1; candidate > anchor + 1; candidate--) {
+            if (hasLineOfSight(points[anchor], points[candidate])) {
+                next = candidate;
+                break;
+            }
+        }
+        result.push_back(points[next]);
+        anchor = next;
+    }
+    points.swap(result);
+}
+
+float NavGrid::pathLength(const std::vector<glm::vec2>& path) {
+    float length = 0.0f;
+    for (size_t i = 1; i < path.size(); i++) {
+        length += glm::distance(path[i - 1], path[i]);
+    }
+    return length;
+}
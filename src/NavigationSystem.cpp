@@ -0,0 +1,358 @@
+#include "../include/NavigationSystem.hpp"
+#include "../include/Statue.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <random>
+
+NavigationSystem::NavigationSystem() : queryCount(0) {
+}
+
+NavigationSystem::~NavigationSystem() {
+}
+
+int NavigationSystem::addRoom(const glm::vec3& minCorner, const glm::vec3& maxCorner, float cellSize, float agentRadius) {
+    std::unique_ptr<Room> room(new Room());
+    if (!room->grid.initialize(flatten(minCorner), flatten(maxCorner), cellSize, agentRadius)) {
+        return -1;
+    }
+    room->minCorner = minCorner;
+    room->maxCorner = maxCorner;
+    rooms.push_back(std::move(room));
+    return static_cast<int>(rooms.size() - 1);
+}
+
+void NavigationSystem::addStatue(const Statue& statue) {
+    std::vector<glm::vec3> triangles;
+    statue.collectTriangles(triangles);
+    addTriangles(triangles);
+}
+
+void NavigationSystem::addTriangles(const std::vector<glm::vec3>& triangles) {
+    for (auto& room : rooms) {
+        for (size_t i = 0; i + 2 < triangles.size(); i += 3) {
+            const glm::vec3& a = triangles[i];
+            const glm::vec3& b = triangles[i + 1];
+            const glm::vec3& c = triangles[i + 2];
+
+            // Ajanın üstünde ya da zeminin altında kalan parçalar yolu kapatmaz
+            float low = std::min(a.y, std::min(b.y, c.y));
+            float high = std::max(a.y, std::max(b.y, c.y));
+            if (low > room->maxCorner.y || high < room->minCorner.y) continue;
+
+            glm::vec3 boxMin = glm::min(a, glm::min(b, c));
+            glm::vec3 boxMax = glm::max(a, glm::max(b, c));
+            if (boxMax.x < room->minCorner.x || boxMin.x > room->maxCorner.x ||
+                boxMax.z < room->minCorner.z || boxMin.z > room->maxCorner.z) {
+                continue;
+            }
+            room->grid.addTriangle(flatten(a), flatten(b), flatten(c));
+        }
+    }
+}
+
+void NavigationSystem::addObstacle(const glm::vec3& center, float radius) {
+    for (auto& room : rooms) {
+        if (center.x + radius < room->minCorner.x || center.x - radius > room->maxCorner.x ||
+            center.z + radius < room->minCorner.z || center.z - radius > room->maxCorner.z) {
+            continue;
+        }
+        room->grid.addCircle(flatten(center), radius);
+    }
+}
+
+int NavigationSystem::addPortal(int roomA, const glm::vec3& pointA, int roomB, const glm::vec3& pointB) {
+    if (roomA < 0 || roomB < 0 || roomA >= static_cast<int>(rooms.size()) || roomB >= static_cast<int>(rooms.size())) {
+        std::cerr << "Kapı geçersiz bir odaya bağlanamaz!" << std::endl;
+        return -1;
+    }
+    Endpoint a;
+    a.room = roomA;
+    a.point = flatten(pointA);
+    Endpoint b;
+    b.room = roomB;
+    b.point = flatten(pointB);
+    rooms[roomA]->endpoints.push_back(static_cast<int>(endpoints.size()));
+    endpoints.push_back(a);
+    rooms[roomB]->endpoints.push_back(static_cast<int>(endpoints.size()));
+    endpoints.push_back(b);
+    return static_cast<int>(endpoints.size() / 2 - 1);
+}
+
+void NavigationSystem::build() {
+    for (auto& room : rooms) {
+        room->grid.build();
+    }
+
+    for (Endpoint& endpoint : endpoints) {
+        rooms[endpoint.room]->grid.computeDistanceField(endpoint.point, endpoint.field);
+    }
+
+    // Soyut grafik: aynı odadaki kapı uçları arası yürüme mesafesi; aradaki yollar da önbelleğe alınır
+    size_t count = endpoints.size();
+    endpointCosts.assign(count * count, -1.0f);
+    for (size_t r = 0; r < rooms.size(); r++) {
+        NavGrid& grid = rooms[r]->grid;
+        const std::vector<int>& list = rooms[r]->endpoints;
+        for (int from : list) {
+            for (int to : list) {
+                if (from == to) continue;
+                endpointCosts[from * count + to] = grid.sampleField(endpoints[from].field, endpoints[to].point);
+                grid.findPath(endpoints[from].point, endpoints[to].point, segment);
+            }
+        }
+    }
+}
+
+int NavigationSystem::findRoom(const glm::vec3& point) const {
+    for (size_t i = 0; i < rooms.size(); i++) {
+        if (rooms[i]->grid.contains(flatten(point))) return static_cast<int>(i);
+    }
+    return -1;
+}
+
+uint64_t NavigationSystem::getCacheHits() const {
+    uint64_t hits = 0;
+    for (const auto& room : rooms) {
+        hits += room->grid.getCacheHits();
+    }
+    return hits;
+}
+
+void NavigationSystem::appendSegment(std::vector<glm::vec3>& path, float y) {
+    for (const glm::vec2& point : segment) {
+        if (!path.empty() && glm::distance(flatten(path.back()), point) < 1e-5f) continue;
+        path.push_back(glm::vec3(point.x, y, point.y));
+    }
+}
+
+bool NavigationSystem::findPath(const glm::vec3& start, const glm::vec3& goal, std::vector<glm::vec3>& path) {
+    queryCount++;
+    path.clear();
+    int startRoom = findRoom(start);
+    int goalRoom = findRoom(goal);
+    if (startRoom < 0 || goalRoom < 0) return false;
+
+    glm::vec2 from = flatten(start);
+    glm::vec2 to = flatten(goal);
+    if (startRoom == goalRoom && rooms[startRoom]->grid.findPath(from, to, segment)) {
+        appendSegment(path, start.y);
+        return true;
+    }
+
+    // Kapı uçları + başlangıç + hedef üzerinde Dijkstra; düğüm sayısı kapı sayısı kadar küçük
+    const int count = static_cast<int>(endpoints.size());
+    const int START = count;
+    const int GOAL = count + 1;
+    const float INFINITE = std::numeric_limits<float>::max();
+    nodeCosts.assign(count + 2, INFINITE);
+    nodeParents.assign(count + 2, -1);
+    nodeDone.assign(count + 2, 0);
+    nodeCosts[START] = 0.0f;
+
+    auto relax = [this](int node, int next, float cost) {
+        if (cost >= 0.0f && nodeCosts[node] + cost < nodeCosts[next]) {
+            nodeCosts[next] = nodeCosts[node] + cost;
+            nodeParents[next] = node;
+        }
+    };
+
+    while (true) {
+        int node = -1;
+        for (int i = 0; i < count + 2; i++) {
+            if (!nodeDone[i] && nodeCosts[i] < INFINITE && (node < 0 || nodeCosts[i] < nodeCosts[node])) node = i;
+        }
+        if (node < 0) return false;
+        if (node == GOAL) break;
+        nodeDone[node] = 1;
+
+        if (node == START) {
+            for (int endpoint : rooms[startRoom]->endpoints) {
+                relax(node, endpoint, rooms[startRoom]->grid.sampleField(endpoints[endpoint].field, from));
+            }
+            continue;
+        }
+
+        // Kapıdan geçiş, aynı odadaki diğer kapılar ve oda hedefin odasıysa hedef
+        int partner = node ^ 1;
+        relax(node, partner, glm::distance(endpoints[node].point, endpoints[partner].point));
+        int room = endpoints[node].room;
+        for (int other : rooms[room]->endpoints) {
+            if (other != node) relax(node, other, endpointCosts[node * count + other]);
+        }
+        if (room == goalRoom) {
+            relax(node, GOAL, rooms[goalRoom]->grid.sampleField(endpoints[node].field, to));
+        }
+    }
+
+    // Düğüm dizisi hedeften geriye; parçalar oda ızgaralarında (kapıdan kapıya önbellekten) birleştirilir
+    std::vector<int> nodes;
+    for (int node = GOAL; node >= 0; node = nodeParents[node]) {
+        nodes.push_back(node);
+    }
+    std::reverse(nodes.begin(), nodes.end());
+
+    path.push_back(start);
+    for (size_t i = 1; i < nodes.size(); i++) {
+        int previous = nodes[i - 1];
+        int node = nodes[i];
+        if (previous != START && node != GOAL && (previous ^ 1) == node) {
+            segment.assign(1, endpoints[node].point);
+            appendSegment(path, start.y);
+            continue;
+        }
+        int room = previous == START ? startRoom : endpoints[previous].room;
+        glm::vec2 a = previous == START ? from : endpoints[previous].point;
+        glm::vec2 b = node == GOAL ? to : endpoints[node].point;
+        if (!rooms[room]->grid.findPath(a, b, segment)) {
+            path.clear();
+            return false;
+        }
+        appendSegment(path, start.y);
+    }
+    return true;
+}
+
+static double elapsedMicroseconds(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+}
+
+bool NavigationSystem::runBenchmarks() {
+    std::mt19937 random(4242);
+    bool valid = true;
+
+    // 1) Tek ızgara: JPS ile A* aynı uzunlukta yol bulmalı, düzeltilmiş yol engele girmemeli
+    {
+        const float SIZE = 16.0f;
+        NavGrid grid;
+        grid.initialize(glm::vec2(0.0f), glm::vec2(SIZE), 0.1f, 0.25f);
+        std::uniform_real_distribution<float> coordinate(0.0f, SIZE);
+        std::uniform_real_distribution<float> radius(0.2f, 0.9f);
+        for (int i = 0; i < 60; i++) {
+            grid.addCircle(glm::vec2(coordinate(random), coordinate(random)), radius(random));
+        }
+        for (int i = 0; i < 6; i++) {
+            glm::vec2 corner(coordinate(random), coordinate(random));
+            grid.addBox(corner, corner + glm::vec2(radius(random) * 4.0f, 0.2f));
+        }
+        grid.build();
+
+        std::vector<std::pair<glm::vec2, glm::vec2>> queries;
+        while (queries.size() < 500) {
+            glm::vec2 a(coordinate(random), coordinate(random));
+            glm::vec2 b(coordinate(random), coordinate(random));
+            if (grid.isWalkable(a) && grid.isWalkable(b)) queries.push_back(std::make_pair(a, b));
+        }
+
+        int mismatches = 0, blockedSegments = 0, unreachable = 0;
+        double astarTime = 0.0, jpsTime = 0.0;
+        size_t smoothLength = 0;
+        std::vector<glm::vec2> path;
+        for (const auto& query : queries) {
+            auto start = std::chrono::steady_clock::now();
+            float astarCost = grid.searchCost(query.first, query.second, NavGrid::SEARCH_ASTAR);
+            astarTime += elapsedMicroseconds(start);
+            start = std::chrono::steady_clock::now();
+            float jpsCost = grid.searchCost(query.first, query.second, NavGrid::SEARCH_JPS);
+            jpsTime += elapsedMicroseconds(start);
+
+            if (astarCost < 0.0f || jpsCost < 0.0f) {
+                unreachable++;
+                if ((astarCost < 0.0f) != (jpsCost < 0.0f)) mismatches++;
+                continue;
+            }
+            if (std::fabs(astarCost - jpsCost) > 1e-3f * std::max(1.0f, astarCost)) mismatches++;
+
+            grid.findPath(query.first, query.second, path);
+            smoothLength += path.size();
+            for (size_t i = 1; i < path.size(); i++) {
+                if (!grid.hasLineOfSight(path[i - 1], path[i])) blockedSegments++;
+            }
+            // Uçlar hücre merkezinde olmadığı için düzeltilmiş yol en fazla iki yarım hücre uzun olabilir
+            if (NavGrid::pathLength(path) > jpsCost + grid.getCellSize() * 1.5f) mismatches++;
+        }
+        size_t reachable = queries.size() - unreachable;
+        valid = valid && mismatches == 0 && blockedSegments == 0;
+        std::cout << "Izgara " << grid.getWidth() << "x" << grid.getHeight() << ", " << queries.size()
+                  << " sorgu: doğruluk " << (mismatches == 0 && blockedSegments == 0 ? "TAMAM" : "HATA")
+                  << " (fark " << mismatches << ", engele giren parça " << blockedSegments << ", ulaşılamaz "
+                  << unreachable << ")" << std::endl;
+        std::cout << "  A* " << astarTime / queries.size() << " us, JPS " << jpsTime / queries.size()
+                  << " us/sorgu (" << astarTime / jpsTime << "x); düzeltilmiş yolda ortalama "
+                  << static_cast<double>(smoothLength) / std::max<size_t>(1, reachable) << " nokta" << std::endl;
+    }
+
+    // 2) 4x4 odalı müze: her oda 15 m, komşu odalar ortadaki kapıyla bağlı, oda başına 30 eser
+    {
+        const int GRID = 4;
+        const float ROOM = 15.0f;
+        const float WALL = 0.3f;
+        const float DOOR_DEPTH = 0.6f;
+        NavigationSystem navigation;
+        std::vector<glm::vec3> exhibits;
+        std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+
+        for (int rz = 0; rz < GRID; rz++) {
+            for (int rx = 0; rx < GRID; rx++) {
+                glm::vec3 low(rx * (ROOM + WALL), 0.0f, rz * (ROOM + WALL));
+                navigation.addRoom(low, low + glm::vec3(ROOM, 1.0f, ROOM), 0.1f, 0.3f);
+            }
+        }
+        for (int rz = 0; rz < GRID; rz++) {
+            for (int rx = 0; rx < GRID; rx++) {
+                int room = rz * GRID + rx;
+                glm::vec3 low(rx * (ROOM + WALL), 0.0f, rz * (ROOM + WALL));
+                if (rx + 1 < GRID) {
+                    float x = low.x + ROOM;
+                    float z = low.z + ROOM * 0.5f;
+                    navigation.addPortal(room, glm::vec3(x - DOOR_DEPTH, 0.0f, z),
+                                         room + 1, glm::vec3(x + WALL + DOOR_DEPTH, 0.0f, z));
+                }
+                if (rz + 1 < GRID) {
+                    float x = low.x + ROOM * 0.5f;
+                    float z = low.z + ROOM;
+                    navigation.addPortal(room, glm::vec3(x, 0.0f, z - DOOR_DEPTH),
+                                         room + GRID, glm::vec3(x, 0.0f, z + WALL + DOOR_DEPTH));
+                }
+                // Eserler kapıların önünü kapatmasın diye oda kenarından içeride
+                for (int i = 0; i < 30; i++) {
+                    glm::vec3 center = low + glm::vec3(1.5f + unit(random) * (ROOM - 3.0f), 0.0f,
+                                                       1.5f + unit(random) * (ROOM - 3.0f));
+                    navigation.addObstacle(center, 0.3f + unit(random) * 0.4f);
+                    exhibits.push_back(center);
+                }
+            }
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        navigation.build();
+        double buildTime = elapsedMicroseconds(start);
+
+        std::vector<std::pair<int, int>> pairs;
+        std::uniform_int_distribution<int> pick(0, static_cast<int>(exhibits.size()) - 1);
+        for (int i = 0; i < 1000; i++) {
+            pairs.push_back(std::make_pair(pick(random), pick(random)));
+        }
+
+        std::vector<glm::vec3> path;
+        int failures = 0;
+        double passTimes[2];
+        for (int pass = 0; pass < 2; pass++) {
+            start = std::chrono::steady_clock::now();
+            for (const auto& pair : pairs) {
+                if (!navigation.findPath(exhibits[pair.first], exhibits[pair.second], path)) failures++;
+            }
+            passTimes[pass] = elapsedMicroseconds(start) / pairs.size();
+        }
+        // Eserler kapılardan uzakta ve odalar bağlı; her çift için yol bulunmalı
+        valid = valid && failures == 0;
+        std::cout << "Müze " << GRID * GRID << " oda, " << exhibits.size() << " eser: kurulum "
+                  << buildTime / 1000.0 << " ms, " << pairs.size() << " eserden esere sorgu: doğruluk "
+                  << (failures == 0 ? "TAMAM" : "HATA") << " (" << failures << " başarısız)" << std::endl;
+        std::cout << "  ilk geçiş " << passTimes[0] << " us/sorgu, önbellekli tekrar " << passTimes[1]
+                  << " us/sorgu, önbellek isabeti " << navigation.getCacheHits() << std::endl;
+    }
+    return valid;
+}
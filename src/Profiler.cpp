@@ -0,0 +1,354 @@
+#include "../include/Profiler.hpp"
+#include "../include/Tracer.hpp"
+#include "imgui.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+
+// Ortalamalar birkaç saniyelik pencereye yayılsın diye küçük katsayı
+static const double AVERAGE_WEIGHT = 0.05;
+
+Profiler& Profiler::instance() {
+    static Profiler profiler;
+    return profiler;
+}
+
+Profiler::Profiler()
+    : frameIndex(0), frameStart(0), frameMilliseconds(0.0), gpuFrameIndex(0), gpuDepth(0), overlayVisible(false) {
+    for (GpuFrame& frame : gpuFrames) {
+        frame.usedQueries = 0;
+        frame.issued = false;
+        frame.clockOffset = 0;
+    }
+}
+
+Profiler::~Profiler() {
+    for (ThreadBuffer* buffer : buffers) {
+        delete buffer;
+    }
+}
+
+// Sorgular GL bağlamı varken silinmelidir
+void Profiler::cleanup() {
+    for (GpuFrame& frame : gpuFrames) {
+        if (!frame.queryPool.empty()) {
+            glDeleteQueries(static_cast<GLsizei>(frame.queryPool.size()), frame.queryPool.data());
+        }
+        frame.queryPool.clear();
+        frame.zones.clear();
+        frame.usedQueries = 0;
+        frame.issued = false;
+    }
+}
+
+uint64_t Profiler::now() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+// İlk kullanımda thread'e ait tampon oluşturulur; kilit sadece bu kayıt sırasında alınır
+Profiler::ThreadBuffer* Profiler::threadBuffer() {
+    static thread_local ThreadBuffer* buffer = nullptr;
+    if (!buffer) {
+        Profiler& profiler = instance();
+        buffer = new ThreadBuffer();
+        buffer->writeIndex = 0;
+        buffer->readIndex = 0;
+        buffer->depth = 0;
+
+        std::lock_guard<std::mutex> lock(profiler.registryMutex);
+        buffer->threadIndex = static_cast<int>(profiler.buffers.size());
+        profiler.buffers.push_back(buffer);
+    }
+    return buffer;
+}
+
+void Profiler::beginZone(const char* name) {
+    ThreadBuffer* buffer = threadBuffer();
+    if (buffer->depth < ThreadBuffer::MAX_DEPTH) {
+        buffer->openNames[buffer->depth] = name;
+        buffer->openStarts[buffer->depth] = now();
+    }
+    buffer->depth++;
+}
+
+void Profiler::endZone() {
+    ThreadBuffer* buffer = threadBuffer();
+    buffer->depth--;
+    if (buffer->depth < 0 || buffer->depth >= ThreadBuffer::MAX_DEPTH) {
+        buffer->depth = std::max(buffer->depth, 0);
+        return;
+    }
+
+    const char* name = buffer->openNames[buffer->depth];
+    uint64_t start = buffer->openStarts[buffer->depth];
+    uint64_t end = now();
+    Tracer::recordZone(name, start, end);
+
+    uint32_t index = buffer->writeIndex.load(std::memory_order_relaxed);
+    if (index - buffer->readIndex.load(std::memory_order_acquire) >= ThreadBuffer::CAPACITY) {
+        return;
+    }
+    Event& event = buffer->events[index % ThreadBuffer::CAPACITY];
+    event.name = name;
+    event.start = start;
+    event.end = end;
+    event.depth = buffer->depth;
+    event.threadIndex = buffer->threadIndex;
+    buffer->writeIndex.store(index + 1, std::memory_order_release);
+}
+
+void Profiler::updateStats(ZoneStats& stats, double milliseconds, uint64_t frame) {
+    stats.averageMilliseconds = stats.lastSeenFrame == 0
+        ? milliseconds
+        : stats.averageMilliseconds * (1.0 - AVERAGE_WEIGHT) + milliseconds * AVERAGE_WEIGHT;
+    stats.lastMilliseconds = milliseconds;
+    stats.lastSeenFrame = frame;
+}
+
+// Aynı bölge bir karede birden çok kez çalışabilir; süreleri toplanıp tek örnek sayılır
+void Profiler::beginFrame() {
+    uint64_t frameEnd = now();
+    if (frameStart != 0) {
+        double milliseconds = (frameEnd - frameStart) / 1000000.0;
+        frameMilliseconds = frameIndex <= 1 ? milliseconds
+                                            : frameMilliseconds * (1.0 - AVERAGE_WEIGHT) + milliseconds * AVERAGE_WEIGHT;
+    }
+
+    std::vector<ThreadBuffer*> activeBuffers;
+    {
+        std::lock_guard<std::mutex> lock(registryMutex);
+        activeBuffers = buffers;
+    }
+
+    lastFrameEvents.clear();
+    std::map<std::string, double> frameTotals;
+    std::map<std::string, std::pair<int, int>> frameZones;
+
+    for (ThreadBuffer* buffer : activeBuffers) {
+        uint32_t written = buffer->writeIndex.load(std::memory_order_acquire);
+
+        char prefix[16];
+        std::snprintf(prefix, sizeof(prefix), "%d/", buffer->threadIndex);
+        for (uint32_t i = buffer->readIndex.load(std::memory_order_relaxed); i != written; i++) {
+            const Event& event = buffer->events[i % ThreadBuffer::CAPACITY];
+            std::string key = prefix;
+            key += event.name;
+            frameTotals[key] += (event.end - event.start) / 1000000.0;
+            frameZones[key] = std::make_pair(buffer->threadIndex, event.depth);
+            lastFrameEvents.push_back(event);
+        }
+        buffer->readIndex.store(written, std::memory_order_release);
+    }
+
+    frameIndex++;
+    for (const auto& total : frameTotals) {
+        ZoneStats& stats = cpuStats[total.first];
+        if (stats.lastSeenFrame == 0) {
+            stats.name = total.first.substr(total.first.find('/') + 1);
+            stats.threadIndex = frameZones[total.first].first;
+            stats.depth = frameZones[total.first].second;
+        }
+        updateStats(stats, total.second, frameIndex);
+    }
+
+    frameStart = frameEnd;
+}
+
+GLuint Profiler::acquireQuery(GpuFrame& frame) {
+    if (frame.usedQueries == frame.queryPool.size()) {
+        GLuint query = 0;
+        glGenQueries(1, &query);
+        frame.queryPool.push_back(query);
+    }
+    return frame.queryPool[frame.usedQueries++];
+}
+
+// Karenin son sorgusu hazırsa hepsi hazırdır; değilse bu karenin ölçümü atlanır
+void Profiler::collectGpuFrame(GpuFrame& frame) {
+    if (frame.zones.empty() || frame.zones.back().endQuery == 0) return;
+
+    GLint available = 0;
+    glGetQueryObjectiv(frame.zones.back().endQuery, GL_QUERY_RESULT_AVAILABLE, &available);
+    if (!available) return;
+
+    std::map<std::string, double> totals;
+    std::map<std::string, int> depths;
+    for (const GpuZone& zone : frame.zones) {
+        if (zone.endQuery == 0) continue;
+        GLuint64 begin = 0, end = 0;
+        glGetQueryObjectui64v(zone.beginQuery, GL_QUERY_RESULT, &begin);
+        glGetQueryObjectui64v(zone.endQuery, GL_QUERY_RESULT, &end);
+        totals[zone.name] += (end - begin) / 1000000.0;
+        depths[zone.name] = zone.depth;
+        Tracer::recordGpuZone(zone.name, begin + frame.clockOffset, end + frame.clockOffset);
+    }
+
+    std::lock_guard<std::mutex> lock(gpuStatsMutex);
+    for (const auto& total : totals) {
+        ZoneStats& stats = gpuStats[total.first];
+        if (stats.lastSeenFrame == 0) {
+            stats.name = total.first;
+            stats.threadIndex = 0;
+            stats.depth = depths[total.first];
+        }
+        updateStats(stats, total.second, stats.lastSeenFrame + 1);
+    }
+}
+
+void Profiler::beginGpuFrame() {
+    gpuFrameIndex = (gpuFrameIndex + 1) % GPU_FRAME_LATENCY;
+    GpuFrame& frame = gpuFrames[gpuFrameIndex];
+    if (frame.issued) {
+        collectGpuFrame(frame);
+    }
+
+    frame.zones.clear();
+    frame.usedQueries = 0;
+    frame.issued = false;
+    gpuDepth = 0;
+    gpuOpenZones.clear();
+
+    // İz dosyasında GPU bölgeleri CPU saatine taşınır; saatler kayabildiği için her kare ölçülür
+    if (Tracer::isActive()) {
+        GLint64 gpuTime = 0;
+        glGetInteger64v(GL_TIMESTAMP, &gpuTime);
+        frame.clockOffset = static_cast<int64_t>(now()) - gpuTime;
+    }
+}
+
+// Zaman damgası sorguları iç içe kullanılabilir; GL_TIME_ELAPSED ise iç içe başlatılamaz
+void Profiler::beginGpuZone(const char* name) {
+    GpuFrame& frame = gpuFrames[gpuFrameIndex];
+    GpuZone zone = { name, gpuDepth, acquireQuery(frame), 0 };
+    glQueryCounter(zone.beginQuery, GL_TIMESTAMP);
+    gpuOpenZones.push_back(frame.zones.size());
+    frame.zones.push_back(zone);
+    gpuDepth++;
+}
+
+void Profiler::endGpuZone() {
+    if (gpuOpenZones.empty()) return;
+
+    GpuFrame& frame = gpuFrames[gpuFrameIndex];
+    GpuZone& zone = frame.zones[gpuOpenZones.back()];
+    gpuOpenZones.pop_back();
+    gpuDepth--;
+
+    zone.endQuery = acquireQuery(frame);
+    glQueryCounter(zone.endQuery, GL_TIMESTAMP);
+    frame.issued = true;
+}
+
+// Bölge adından sabit bir renk üretir, böylece bir bölge kareden kareye aynı renkte kalır
+static ImU32 zoneColor(const char* name) {
+    uint32_t hash = 2166136261u;
+    for (const char* c = name; *c; c++) {
+        hash = (hash ^ static_cast<unsigned char>(*c)) * 16777619u;
+    }
+    return IM_COL32(90 + hash % 140, 90 + (hash >> 8) % 140, 90 + (hash >> 16) % 140, 255);
+}
+
+void Profiler::renderOverlay() {
+    if (!overlayVisible) return;
+
+    ImGuiIO& io = ImGui::GetIO();
+    ImGui::SetNextWindowPos(ImVec2(io.DisplaySize.x - 10.0f, 10.0f), ImGuiCond_FirstUseEver, ImVec2(1.0f, 0.0f));
+    ImGui::SetNextWindowSize(ImVec2(420.0f, 360.0f), ImGuiCond_FirstUseEver);
+    ImGui::SetNextWindowBgAlpha(0.85f);
+    if (!ImGui::Begin("Profiler (F3)", &overlayVisible)) {
+        ImGui::End();
+        return;
+    }
+
+#ifndef VM_ENABLE_PROFILER
+    ImGui::TextWrapped("Profiler bölgeleri derlemede kapalı (VM_ENABLE_PROFILER).");
+#endif
+    ImGui::Text("Kare: %.2f ms (%.0f FPS)", frameMilliseconds, frameMilliseconds > 0.0 ? 1000.0 / frameMilliseconds : 0.0);
+
+    // Zaman çizelgesi: son karenin olayları, olayı olan her thread ayrı bir bantta, derinlik aşağı doğru
+    if (!lastFrameEvents.empty()) {
+        uint64_t first = lastFrameEvents[0].start, last = lastFrameEvents[0].end;
+        int maxDepth = 0;
+        std::vector<int> bandThreads;
+        for (size_t i = 0; i < lastFrameEvents.size(); i++) {
+            first = std::min(first, lastFrameEvents[i].start);
+            last = std::max(last, lastFrameEvents[i].end);
+            maxDepth = std::max(maxDepth, lastFrameEvents[i].depth);
+            if (std::find(bandThreads.begin(), bandThreads.end(), lastFrameEvents[i].threadIndex) == bandThreads.end()) {
+                bandThreads.push_back(lastFrameEvents[i].threadIndex);
+            }
+        }
+
+        const float rowHeight = 16.0f;
+        float bandHeight = (maxDepth + 1) * rowHeight + 4.0f;
+        ImVec2 origin = ImGui::GetCursorScreenPos();
+        float width = ImGui::GetContentRegionAvail().x;
+        ImGui::InvisibleButton("timeline", ImVec2(width, bandHeight * bandThreads.size()));
+
+        ImDrawList* drawList = ImGui::GetWindowDrawList();
+        double scale = last > first ? width / static_cast<double>(last - first) : 0.0;
+        for (size_t i = 0; i < lastFrameEvents.size(); i++) {
+            const Event& event = lastFrameEvents[i];
+            float x0 = origin.x + static_cast<float>((event.start - first) * scale);
+            float x1 = std::max(x0 + 1.0f, origin.x + static_cast<float>((event.end - first) * scale));
+            size_t band = std::find(bandThreads.begin(), bandThreads.end(), lastFrameEvents[i].threadIndex) - bandThreads.begin();
+            float y0 = origin.y + band * bandHeight + event.depth * rowHeight;
+            drawList->AddRectFilled(ImVec2(x0, y0), ImVec2(x1, y0 + rowHeight - 1.0f), zoneColor(event.name));
+            if (x1 - x0 > 40.0f) {
+                drawList->PushClipRect(ImVec2(x0, y0), ImVec2(x1, y0 + rowHeight), true);
+                drawList->AddText(ImVec2(x0 + 2.0f, y0 + 1.0f), IM_COL32(0, 0, 0, 255), event.name);
+                drawList->PopClipRect();
+            }
+            if (ImGui::IsMouseHoveringRect(ImVec2(x0, y0), ImVec2(x1, y0 + rowHeight))) {
+                ImGui::SetTooltip("%s: %.3f ms", event.name, (event.end - event.start) / 1000000.0);
+            }
+        }
+    }
+
+    // Hiyerarşi son karedeki sıraya göre; her satır bölgenin kayan ortalamasını gösterir
+    if (ImGui::BeginTable("cpuZones", 3, ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingStretchProp)) {
+        ImGui::TableSetupColumn("CPU bölgesi");
+        ImGui::TableSetupColumn("ort. ms");
+        ImGui::TableSetupColumn("son ms");
+        ImGui::TableHeadersRow();
+
+        std::vector<std::string> shown;
+        for (size_t i = 0; i < lastFrameEvents.size(); i++) {
+            char prefix[16];
+            std::snprintf(prefix, sizeof(prefix), "%d/", lastFrameEvents[i].threadIndex);
+            std::string key = std::string(prefix) + lastFrameEvents[i].name;
+            if (std::find(shown.begin(), shown.end(), key) != shown.end()) continue;
+            shown.push_back(key);
+
+            auto found = cpuStats.find(key);
+            if (found == cpuStats.end()) continue;
+            const ZoneStats& stats = found->second;
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn();
+            ImGui::Text("%*s%s [%d]", stats.depth * 2, "", stats.name.c_str(), stats.threadIndex);
+            ImGui::TableNextColumn();
+            ImGui::Text("%.3f", stats.averageMilliseconds);
+            ImGui::TableNextColumn();
+            ImGui::Text("%.3f", stats.lastMilliseconds);
+        }
+        ImGui::EndTable();
+    }
+
+    std::lock_guard<std::mutex> lock(gpuStatsMutex);
+    if (!gpuStats.empty() && ImGui::BeginTable("gpuZones", 2, ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingStretchProp)) {
+        ImGui::TableSetupColumn("GPU bölgesi");
+        ImGui::TableSetupColumn("ort. ms");
+        ImGui::TableHeadersRow();
+        for (const auto& entry : gpuStats) {
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn();
+            ImGui::Text("%*s%s", entry.second.depth * 2, "", entry.second.name.c_str());
+            ImGui::TableNextColumn();
+            ImGui::Text("%.3f", entry.second.averageMilliseconds);
+        }
+        ImGui::EndTable();
+    }
+
+    ImGui::End();
+}
@@ -0,0 +1,159 @@
+#include "../include/ProgramCache.hpp"
+#include "../include/GLExtensions.hpp"
+#include "../include/GLStateCache.hpp"
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <vector>
+#include <cstring>
+#include <filesystem>
+
+namespace {
+    const uint32_t CACHE_MAGIC = 0x42504D56; // "VMPB"
+    const uint32_t MAX_BINARY_SIZE = 64u << 20;
+
+    struct CacheHeader {
+        uint32_t magic;
+        uint32_t binaryFormat;
+        uint32_t length;
+    };
+
+    // FNV-1a, 64 bit
+    uint64_t hashBytes(uint64_t hash, const char* data, size_t size) {
+        for (size_t i = 0; i < size; i++) {
+            hash ^= static_cast<unsigned char>(data[i]);
+            hash *= 1099511628211ULL;
+        }
+        return hash;
+    }
+
+    std::string glString(GLenum name) {
+        const GLubyte* value = glGetString(name);
+        return value ? reinterpret_cast<const char*>(value) : "";
+    }
+}
+
+bool ProgramCache::enabled = false;
+std::string ProgramCache::cacheDirectory;
+std::string ProgramCache::driverSignature;
+int ProgramCache::hits = 0;
+int ProgramCache::misses = 0;
+int ProgramCache::rejected = 0;
+
+bool ProgramCache::initialize(const std::string& directory) {
+    enabled = false;
+    if (!GLExtensions::programBinary) {
+        std::cout << "Shader önbelleği devre dışı: sürücü program binary desteklemiyor." << std::endl;
+        return false;
+    }
+
+    std::error_code error;
+    std::filesystem::create_directories(directory, error);
+    if (error) {
+        std::cerr << "Shader önbellek klasörü oluşturulamadı: " << directory << std::endl;
+        return false;
+    }
+
+    cacheDirectory = directory;
+    driverSignature = glString(GL_VENDOR) + "|" + glString(GL_RENDERER) + "|" +
+                      glString(GL_VERSION) + "|" + glString(GL_SHADING_LANGUAGE_VERSION);
+    enabled = true;
+    return true;
+}
+
+bool ProgramCache::isEnabled() {
+    return enabled;
+}
+
+uint64_t ProgramCache::makeKey(const char* vertexSource, const char* fragmentSource) {
+    uint64_t hash = 14695981039346656037ULL;
+    hash = hashBytes(hash, vertexSource, std::strlen(vertexSource) + 1);
+    hash = hashBytes(hash, fragmentSource, std::strlen(fragmentSource) + 1);
+    hash = hashBytes(hash, driverSignature.data(), driverSignature.size());
+    return hash;
+}
+
+std::string ProgramCache::pathFor(uint64_t key) {
+    std::ostringstream name;
+    name << cacheDirectory << '/' << std::hex << std::setw(16) << std::setfill('0') << key << ".bin";
+    return name.str();
+}
+
+GLuint ProgramCache::load(uint64_t key) {
+    if (!enabled) return 0;
+
+    std::ifstream file(pathFor(key), std::ios::binary);
+    if (!file) {
+        misses++;
+        return 0;
+    }
+
+    CacheHeader header;
+    file.read(reinterpret_cast<char*>(&header), sizeof(header));
+    bool validHeader = file && header.magic == CACHE_MAGIC && header.length <= MAX_BINARY_SIZE;
+    std::vector<char> binary(validHeader ? header.length : 0);
+    if (!binary.empty()) {
+        file.read(binary.data(), binary.size());
+    }
+    if (!file || header.magic != CACHE_MAGIC || binary.empty()) {
+        rejected++;
+        misses++;
+        return 0;
+    }
+
+    GLuint program = glCreateProgram();
+    GLExtensions::ProgramBinary(program, header.binaryFormat, binary.data(), static_cast<GLsizei>(binary.size()));
+
+    // Sürücü güncellenmişse binary reddedilir; sessizce kaynaktan derlemeye döneriz
+    GLint success = 0;
+    glGetProgramiv(program, GL_LINK_STATUS, &success);
+    if (!success) {
+        GLStateCache::deleteProgram(program);
+        file.close();
+        std::error_code error;
+        std::filesystem::remove(pathFor(key), error);
+        rejected++;
+        misses++;
+        return 0;
+    }
+
+    hits++;
+    return program;
+}
+
+void ProgramCache::prepareForLink(GLuint program) {
+    if (!enabled) return;
+    GLExtensions::ProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+}
+
+void ProgramCache::store(uint64_t key, GLuint program) {
+    if (!enabled) return;
+
+    GLint length = 0;
+    glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+    if (length <= 0) return;
+
+    std::vector<char> binary(length);
+    GLenum format = 0;
+    GLsizei written = 0;
+    GLExtensions::GetProgramBinary(program, length, &written, &format, binary.data());
+    if (written <= 0) return;
+
+    CacheHeader header = { CACHE_MAGIC, format, static_cast<uint32_t>(written) };
+    std::ofstream file(pathFor(key), std::ios::binary | std::ios::trunc);
+    if (!file) return;
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(binary.data(), written);
+}
+
+void ProgramCache::logStats() {
+    if (!enabled) return;
+    int total = hits + misses;
+    int percent = total > 0 ? (hits * 100) / total : 0;
+    std::cout << "Shader önbelleği: " << hits << "/" << total << " isabet (%" << percent << ")";
+    if (rejected > 0) {
+        std::cout << ", " << rejected << " geçersiz kayıt yeniden derlendi";
+    }
+    std::cout << std::endl;
+}
@@ -0,0 +1,136 @@
+#include "../include/RenderThread.hpp"
+#include "../include/Profiler.hpp"
+#include "../include/Tracer.hpp"
+#include <chrono>
+#include <iostream>
+
+// Kısa beklemeler için önce thread'i bırakır, uzarsa uyuyarak çekirdeği boş tutar
+static void waitBriefly(int& attempts) {
+    if (++attempts < 64) {
+        std::this_thread::yield();
+    } else {
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+}
+
+FramePacket::FramePacket()
+    : view(1.0f), projection(1.0f), cameraPosition(0.0f), robotPopupVisible(false), framebufferWidth(0), framebufferHeight(0),
+      inputTime(0.0), drawData(nullptr) {
+}
+
+FramePacket::~FramePacket() {
+    releaseDrawLists();
+}
+
+void FramePacket::copyDrawData(const ImDrawData* source) {
+    releaseDrawLists();
+    drawData = nullptr;
+    if (!source || !source->Valid) return;
+
+    ownedDrawData = *source;
+    ownedDrawData.CmdLists.resize(0);
+    for (int i = 0; i < source->CmdListsCount; i++) {
+        ImDrawList* list = source->CmdLists[i]->CloneOutput();
+        ownedLists.push_back(list);
+        ownedDrawData.CmdLists.push_back(list);
+    }
+    drawData = &ownedDrawData;
+}
+
+void FramePacket::releaseDrawLists() {
+    for (ImDrawList* list : ownedLists) {
+        IM_DELETE(list);
+    }
+    ownedLists.clear();
+}
+
+RenderThread::RenderThread() : window(nullptr), writeIndex(0), running(false) {
+    slotStates[0] = SLOT_FREE;
+    slotStates[1] = SLOT_FREE;
+}
+
+RenderThread::~RenderThread() {
+    stop();
+}
+
+bool RenderThread::start(GLFWwindow* targetWindow, RenderFunction function, PresentFunction present) {
+    if (running) return true;
+
+    window = targetWindow;
+    renderFunction = function;
+    presentFunction = present;
+    writeIndex = 0;
+    slotStates[0] = SLOT_FREE;
+    slotStates[1] = SLOT_FREE;
+
+    // Bağlam aynı anda yalnızca bir thread'de aktif olabilir
+    glfwMakeContextCurrent(nullptr);
+    running = true;
+    try {
+        thread = std::thread(&RenderThread::run, this);
+    } catch (const std::exception& e) {
+        std::cerr << "Render thread başlatılamadı: " << e.what() << std::endl;
+        running = false;
+        glfwMakeContextCurrent(window);
+        return false;
+    }
+    return true;
+}
+
+void RenderThread::stop() {
+    if (!thread.joinable()) return;
+
+    running = false;
+    thread.join();
+    glfwMakeContextCurrent(window);
+}
+
+FramePacket& RenderThread::acquirePacket() {
+    int attempts = 0;
+    while (slotStates[writeIndex].load(std::memory_order_acquire) != SLOT_FREE) {
+        waitBriefly(attempts);
+    }
+    return packets[writeIndex];
+}
+
+void RenderThread::submitPacket() {
+    slotStates[writeIndex].store(SLOT_READY, std::memory_order_release);
+    writeIndex = (writeIndex + 1) % 2;
+}
+
+// Paketler simülasyonun yazdığı sırayla okunur; bekleyen paket yoksa ve durdurulduysa çıkar
+void RenderThread::run() {
+    glfwMakeContextCurrent(window);
+    Tracer::setThreadName("render");
+
+    int readIndex = 0;
+    while (true) {
+        int attempts = 0;
+        while (slotStates[readIndex].load(std::memory_order_acquire) != SLOT_READY) {
+            if (!running) {
+                glFinish();
+                glfwMakeContextCurrent(nullptr);
+                return;
+            }
+            waitBriefly(attempts);
+        }
+
+        const FramePacket& packet = packets[readIndex];
+
+        // Heykel ve robot matrisleri canlı transformlar yerine paketteki kopyadan okunur
+        TransformSystem::bindSnapshot(&packet.transforms);
+        renderFunction(packet);
+        TransformSystem::bindSnapshot(nullptr);
+
+        {
+            VM_PROFILE_ZONE("swap");
+            glfwSwapBuffers(window);
+        }
+        if (presentFunction) {
+            presentFunction(packet);
+        }
+
+        slotStates[readIndex].store(SLOT_FREE, std::memory_order_release);
+        readIndex = (readIndex + 1) % 2;
+    }
+}
@@ -1,10 +1,19 @@
 #include "../include/Renderer.hpp"
+#include "../include/Profiler.hpp"
+#include "../include/GLStateCache.hpp"
 #include <iostream>
 #include "stb_image.h"
 
 // render sınıfını kurar.
-Renderer::Renderer() : roomVAO(0), roomVBO(0), wallTextureID(0), 
-                       roomWidth(0), roomHeight(0), roomLength(0) {
+Renderer::Renderer() : shaderLibrary(nullptr), lightingSystem(nullptr), sceneFeatures(SCENE_FEATURES), roomVAO(0), roomVBO(0), wallTextureID(0), 
+                       roomWidth(0), roomHeight(0), roomLength(0), depthPrepass(false),
+                       activeDepthPrepass(false), passQueryIndex(0) {
+    for (int i = 0; i < 2; i++) {
+        passQueries[i] = { 0, 0, false, false };
+        passStats[i].gpuMilliseconds = 0.0;
+        passStats[i].fragments = 0.0;
+        passStats[i].samples = 0;
+    }
 }
 
 // render sınıfını kapatırken temizlik 
@@ -13,15 +22,27 @@ Renderer::~Renderer() {
 }
 
 // render sınıfını başlatır, shader ve oda ayarlarını yapılan yer
-bool Renderer::initialize(float width, float height, float length) {
+bool Renderer::initialize(float width, float height, float length, ShaderLibrary* library, LightingSystem* lighting) {
     roomWidth = width;
     roomHeight = height;
     roomLength = length;
+    shaderLibrary = library;
+    lightingSystem = lighting;
+    sceneFeatures = SCENE_FEATURES;
+    if (lightingSystem && lightingSystem->hasShadows()) {
+        sceneFeatures |= SHADER_FEATURE_SHADOWS;
+    }
     
-    setupShaders();
+    // Programlar arka planda derlenirken oda ve dokular hazırlanır
+    colorShader = shaderLibrary->request(ShaderLibrary::variantKey(sceneFeatures));
+    texturedShader = shaderLibrary->request(ShaderLibrary::variantKey(sceneFeatures | SHADER_FEATURE_TEXTURED));
+    
+    setupLights();
     
     setupRoom();
     
+    setupPassQueries();
+    
     wallTextureID = loadTexture("textures/walls/duvarresmi.jpg");
     if (wallTextureID == 0) {
         std::cerr << "Duvar dokusu yüklenemedi!" << std::endl;
@@ -33,34 +54,104 @@ bool Renderer::initialize(float width, float height, float length) {
 
 // Kullanılan kaynakları temizlemek icin gerekli fonksiyon
 void Renderer::cleanup() {
-    glDeleteVertexArrays(1, &roomVAO);
-    glDeleteBuffers(1, &roomVBO);
-    glDeleteTextures(1, &wallTextureID);
-    glDeleteProgram(shaderProgram);
+    GLStateCache::deleteVertexArrays(1, &roomVAO);
+    GLStateCache::deleteBuffers(1, &roomVBO);
+    GLStateCache::deleteTextures(1, &wallTextureID);
+    
+    for (auto& query : passQueries) {
+        glDeleteQueries(1, &query.timeQuery);
+        glDeleteQueries(1, &query.fragmentQuery);
+        query = { 0, 0, false, false };
+    }
 }
 
-// Bütün sahneyi  ekrana çizdigimiz yer
-void Renderer::renderScene(GLFWwindow* window, const std::vector<Statue*>& statues, Robot* robot, 
-                           UIManager* uiManager, const glm::vec3& cameraPos, const glm::mat4& viewMatrix, 
-                           const glm::mat4& projectionMatrix, int activeStatueIndex, bool showInfoPanel, 
-                           bool isScanning, float scanProgress, float scanDuration) {
-    
-    int width, height;
-    glfwGetWindowSize(window, &width, &height);
-    
-    
-    glUseProgram(shaderProgram);
-    
-    glUniformMatrix4fv(viewLoc, 1, GL_FALSE, glm::value_ptr(viewMatrix));
-    glUniformMatrix4fv(projLoc, 1, GL_FALSE, glm::value_ptr(projectionMatrix));
-    glUniform3fv(viewPosLoc, 1, glm::value_ptr(cameraPos));
-    
-    setupLights();
+// Heykelleri ve robotu o an bağlı framebuffer'a çizer
+void Renderer::renderScene(const std::vector<Statue*>& statues, Robot* robot, const glm::vec3& cameraPos,
+                           const glm::mat4& viewMatrix, const glm::mat4& projectionMatrix, bool robotPopupVisible,
+                           const RobotFleet* fleet, const MuseumWorld* visitors) {
+    // Heykellerin kullanacağı iki varyantı (dokulu / düz renk) hazırla
+    GLuint colorProgram = colorShader.get();
+    GLStateCache::useProgram(colorProgram);
+    applySceneUniforms(colorProgram, viewMatrix, projectionMatrix, cameraPos);
+    
+    GLuint texturedProgram = texturedShader.get();
+    GLStateCache::useProgram(texturedProgram);
+    applySceneUniforms(texturedProgram, viewMatrix, projectionMatrix, cameraPos);
+    
+    // Önceki karede bu sorgu çiftine yazılan sonucu al, sonra yeniden kullan
+    StatuePassQuery& query = passQueries[passQueryIndex];
+    passQueryIndex = (passQueryIndex + 1) % 2;
+    collectPassQuery(query);
+    
+    // Mod değişirken iki modun son ölçümlerini yan yana yaz
+    bool prepass = depthPrepass;
+    if (prepass != activeDepthPrepass) {
+        activeDepthPrepass = prepass;
+        std::cout << "Derinlik ön geçişi " << (prepass ? "açık" : "kapalı")
+                  << " | kapalı: " << passStats[0].gpuMilliseconds << " ms, " << passStats[0].fragments << " fragment"
+                  << " | açık: " << passStats[1].gpuMilliseconds << " ms, " << passStats[1].fragments << " fragment"
+                  << std::endl;
+    }
     
+    // Heykel geçişi ayrı bir profiler bölgesi; kapsam bitince bölge kapanır
+    {
+        VM_PROFILE_GPU_ZONE("statues");
+        glBeginQuery(GL_TIME_ELAPSED, query.timeQuery);
+        if (prepass) {
+            GLStateCache::colorMask(GL_FALSE, GL_FALSE, GL_FALSE, GL_FALSE);
+            renderStatueDepth(statues, viewMatrix, projectionMatrix);
+            GLStateCache::colorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+        
+            // Sadece ön geçişte en yakın çıkan fragment'lar gölgelendirilir
+            GLStateCache::depthFunc(GL_EQUAL);
+            GLStateCache::depthMask(GL_FALSE);
+        }
+    
+        // Renk geçişinde derinlik testini geçen örnekler gölgelendirilen fragment'lardır
+        glBeginQuery(GL_SAMPLES_PASSED, query.fragmentQuery);
+        renderStatues(statues, viewMatrix, projectionMatrix);
+        glEndQuery(GL_SAMPLES_PASSED);
+    
+        if (prepass) {
+            GLStateCache::depthFunc(GL_LESS);
+            GLStateCache::depthMask(GL_TRUE);
+        }
+        glEndQuery(GL_TIME_ELAPSED);
+        query.issued = true;
+        query.withPrepass = prepass;
+    }
     
-    renderStatues(statues, viewMatrix, projectionMatrix);
+    {
+        VM_PROFILE_GPU_ZONE("robot");
+        renderRobot(robot, viewMatrix, projectionMatrix, texturedProgram, robotPopupVisible);
+    }
     
-    renderRobot(robot, viewMatrix, projectionMatrix);
+    // Robot sayısı ne olursa olsun gövde ve kol için birer çizim; ziyaretçiler aynı programla tek çizim
+    bool hasFleet = fleet && fleet->getUploadedCount() > 0;
+    bool hasVisitors = visitors && visitors->getUploadedVisitorCount() > 0;
+    if (!hasFleet && !hasVisitors) return;
+    if (!fleetShader.isValid()) {
+        fleetShader = shaderLibrary->request(ShaderLibrary::variantKey(sceneFeatures | SHADER_FEATURE_TEXTURED | SHADER_FEATURE_INSTANCED));
+    }
+    GLuint fleetProgram = fleetShader.get();
+    GLStateCache::useProgram(fleetProgram);
+    applySceneUniforms(fleetProgram, viewMatrix, projectionMatrix, cameraPos);
+    if (hasFleet) {
+        VM_PROFILE_GPU_ZONE("fleet");
+        fleet->render(viewMatrix, projectionMatrix, fleetProgram);
+    }
+    if (hasVisitors) {
+        VM_PROFILE_GPU_ZONE("visitors");
+        visitors->renderVisitors(viewMatrix, projectionMatrix, fleetProgram);
+    }
+}
+
+// Arayüz her zaman pencerenin kendi çözünürlüğünde çizilir
+void Renderer::renderUI(GLFWwindow* window, const std::vector<Statue*>& statues, UIManager* uiManager,
+                        const glm::mat4& viewMatrix, const glm::mat4& projectionMatrix, int activeStatueIndex,
+                        bool showInfoPanel, bool isScanning, float scanProgress, float scanDuration) {
+    int width, height;
+    glfwGetWindowSize(window, &width, &height);
     
     if (isScanning && activeStatueIndex >= 0 && activeStatueIndex < statues.size()) {
         uiManager->renderScanEffect(window, *statues[activeStatueIndex], viewMatrix, projectionMatrix, scanProgress, scanDuration);
@@ -72,20 +163,8 @@ void Renderer::renderScene(GLFWwindow* window, const std::vector<Statue*>& statu
     
     uiManager->renderRobotControlPanel(width, height, activeStatueIndex, statues);
     
-    uiManager->render();
-}
-
-// Işık ve gölge efektleri için shader'ları kurar
-void Renderer::setupShaders() {
-    shaderProgram = createShaderProgram(vertexShaderSource, fragmentShaderSource);
-    
-    modelLoc = glGetUniformLocation(shaderProgram, "model");
-    viewLoc = glGetUniformLocation(shaderProgram, "view");
-    projLoc = glGetUniformLocation(shaderProgram, "projection");
-    objectColorLoc = glGetUniformLocation(shaderProgram, "objectColor");
-    lightPosLoc = glGetUniformLocation(shaderProgram, "lightPositions");
-    lightColorsLoc = glGetUniformLocation(shaderProgram, "lightColors");
-    viewPosLoc = glGetUniformLocation(shaderProgram, "viewPos");
+    uiManager->renderDepthPrepassPanel(depthPrepass, passStats[0].gpuMilliseconds, passStats[0].fragments,
+                                       passStats[1].gpuMilliseconds, passStats[1].fragments);
 }
 
 // Odanın iskeletini  oluşturur
@@ -137,8 +216,8 @@ void Renderer::setupRoom() {
     glGenVertexArrays(1, &roomVAO);
     glGenBuffers(1, &roomVBO);
     
-    glBindVertexArray(roomVAO);
-    glBindBuffer(GL_ARRAY_BUFFER, roomVBO);
+    GLStateCache::bindVertexArray(roomVAO);
+    GLStateCache::bindBuffer(GL_ARRAY_BUFFER, roomVBO);
     glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
     
     glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)0);
@@ -148,117 +227,74 @@ void Renderer::setupRoom() {
     glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)(6 * sizeof(float)));
     glEnableVertexAttribArray(2);
     
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
-    glBindVertexArray(0);
+    GLStateCache::bindBuffer(GL_ARRAY_BUFFER, 0);
+    GLStateCache::bindVertexArray(0);
 }
 
 // Sahnenin ışıklarını ayarlamak
 void Renderer::setupLights() {
-    glm::vec3 lightPositions[4] = {
-        glm::vec3(-roomWidth * 0.8f, roomHeight * 0.8f, -roomLength * 0.8f),
-        glm::vec3(roomWidth * 0.8f, roomHeight * 0.8f, -roomLength * 0.8f),
-        glm::vec3(-roomWidth * 0.8f, roomHeight * 0.8f, roomLength * 0.8f),
-        glm::vec3(roomWidth * 0.8f, roomHeight * 0.8f, roomLength * 0.8f)
-    };
-    
-    glm::vec3 lightColors[4] = {
-        glm::vec3(1.0f, 0.9f, 0.9f),
-        glm::vec3(0.9f, 1.0f, 0.9f),
-        glm::vec3(0.9f, 0.9f, 1.0f),
-        glm::vec3(1.0f, 1.0f, 1.0f)
-    };
-    
-    glUniform3fv(lightPosLoc, 4, glm::value_ptr(lightPositions[0]));
-    glUniform3fv(lightColorsLoc, 4, glm::value_ptr(lightColors[0]));
+    lightPositions[0] = glm::vec3(-roomWidth * 0.8f, roomHeight * 0.8f, -roomLength * 0.8f);
+    lightPositions[1] = glm::vec3(roomWidth * 0.8f, roomHeight * 0.8f, -roomLength * 0.8f);
+    lightPositions[2] = glm::vec3(-roomWidth * 0.8f, roomHeight * 0.8f, roomLength * 0.8f);
+    lightPositions[3] = glm::vec3(roomWidth * 0.8f, roomHeight * 0.8f, roomLength * 0.8f);
+    
+    lightColors[0] = glm::vec3(1.0f, 0.9f, 0.9f);
+    lightColors[1] = glm::vec3(0.9f, 1.0f, 0.9f);
+    lightColors[2] = glm::vec3(0.9f, 0.9f, 1.0f);
+    lightColors[3] = glm::vec3(1.0f, 1.0f, 1.0f);
+}
+
+// Kamera ve ışık uniform'larını verilen programa yükler
+void Renderer::applySceneUniforms(GLuint program, const glm::mat4& view, const glm::mat4& projection, const glm::vec3& cameraPos) {
+    GLStateCache::uniformMatrix4fv(glGetUniformLocation(program, "view"), 1, GL_FALSE, glm::value_ptr(view));
+    GLStateCache::uniformMatrix4fv(glGetUniformLocation(program, "projection"), 1, GL_FALSE, glm::value_ptr(projection));
+    GLStateCache::uniform3fv(glGetUniformLocation(program, "viewPos"), 1, glm::value_ptr(cameraPos));
+    GLStateCache::uniform3fv(glGetUniformLocation(program, "lightPositions"), 4, glm::value_ptr(lightPositions[0]));
+    GLStateCache::uniform3fv(glGetUniformLocation(program, "lightColors"), 4, glm::value_ptr(lightColors[0]));
+    if (sceneFeatures & SHADER_FEATURE_SHADOWS) {
+        lightingSystem->applyShadows(program);
+    }
 }
 
 // Odanın duvarlarını ve zeminini çizer
 void Renderer::renderRoom(const glm::mat4& view, const glm::mat4& projection) {
-   
-    GLint hasTextureLoc = glGetUniformLocation(shaderProgram, "hasTexture");
-    GLint useWallTextureLoc = glGetUniformLocation(shaderProgram, "useWallTexture");
-    
-   
-    if (hasTextureLoc != -1) {
-        glUniform1i(hasTextureLoc, GL_FALSE);
-    }
-    if (useWallTextureLoc != -1) {
-        glUniform1i(useWallTextureLoc, GL_TRUE);
-    }
-    
-   
-    glActiveTexture(GL_TEXTURE0);
-    glBindTexture(GL_TEXTURE_2D, wallTextureID);
-    glUniform1i(glGetUniformLocation(shaderProgram, "wallTexture"), 0);
+    GLuint program = shaderLibrary->use(ShaderLibrary::variantKey(sceneFeatures | SHADER_FEATURE_WALL));
     
+    GLStateCache::activeTexture(GL_TEXTURE0);
+    GLStateCache::bindTexture(GL_TEXTURE_2D, wallTextureID);
+    GLStateCache::uniform1i(glGetUniformLocation(program, "wallTexture"), 0);
     
     glm::mat4 model = glm::mat4(1.0f); 
-    glUniformMatrix4fv(modelLoc, 1, GL_FALSE, glm::value_ptr(model));
-    glUniform3f(objectColorLoc, 1.0f, 0.9f, 0.2f); 
-    
-    glBindVertexArray(roomVAO);
-    
-    glDrawArrays(GL_TRIANGLES, 0, 30);
+    GLStateCache::uniformMatrix4fv(glGetUniformLocation(program, "model"), 1, GL_FALSE, glm::value_ptr(model));
+    glm::mat3 normalMatrix = glm::mat3(1.0f);
+    GLStateCache::uniformMatrix3fv(glGetUniformLocation(program, "normalMatrix"), 1, GL_FALSE, glm::value_ptr(normalMatrix));
     
-   
-    glUniform3f(objectColorLoc, 1.0f, 1.0f, 1.0f); 
-   
-    glDrawArrays(GL_TRIANGLES, 30, 6);
-    
-    glBindVertexArray(0);
+    GLStateCache::bindVertexArray(roomVAO);
+    glDrawArrays(GL_TRIANGLES, 0, 36);
+    GLStateCache::bindVertexArray(0);
 }
 
-void Renderer::renderStatues(const std::vector<Statue*>& statues, const glm::mat4& view, const glm::mat4& projection) {
-   
-    GLint useWallTextureLoc = glGetUniformLocation(shaderProgram, "useWallTexture");
-    GLint hasTextureLoc = glGetUniformLocation(shaderProgram, "hasTexture");
-    
-    if (useWallTextureLoc != -1) {
-        glUniform1i(useWallTextureLoc, GL_FALSE);
-    }
-    if (hasTextureLoc != -1) {
-        glUniform1i(hasTextureLoc, GL_TRUE);
+// Renk yazmadan sadece heykellerin derinliğini doldurur
+void Renderer::renderStatueDepth(const std::vector<Statue*>& statues, const glm::mat4& view, const glm::mat4& projection) {
+    for (auto statue : statues) {
+        statue->renderDepth(view, projection, *shaderLibrary);
     }
-    
-   
-    glUniform3f(objectColorLoc, 1.0f, 0.7f, 0.3f); 
-    
+}
 
+// Heykeller kendi mesh'lerine uygun varyantı kütüphaneden ister
+void Renderer::renderStatues(const std::vector<Statue*>& statues, const glm::mat4& view, const glm::mat4& projection) {
     for (auto statue : statues) {
-        statue->render(view, projection, shaderProgram);
+        statue->render(view, projection, *shaderLibrary, sceneFeatures);
     }
 }
 
-void Renderer::renderRobot(Robot* robot, const glm::mat4& view, const glm::mat4& projection) {
+void Renderer::renderRobot(Robot* robot, const glm::mat4& view, const glm::mat4& projection, GLuint program,
+                           bool popupVisible) {
     if (robot) {
-        robot->render(view, projection, shaderProgram);
+        robot->render(view, projection, program, popupVisible);
     }
 }
 
-unsigned int Renderer::createShaderProgram(const char* vertexShaderSource, const char* fragmentShaderSource) {
-    
-    unsigned int vertexShader = glCreateShader(GL_VERTEX_SHADER);
-    glShaderSource(vertexShader, 1, &vertexShaderSource, NULL);
-    glCompileShader(vertexShader);
-    
-   
-    unsigned int fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
-    glShaderSource(fragmentShader, 1, &fragmentShaderSource, NULL);
-    glCompileShader(fragmentShader);
-    
-   
-    unsigned int shaderProgram = glCreateProgram();
-    glAttachShader(shaderProgram, vertexShader);
-    glAttachShader(shaderProgram, fragmentShader);
-    glLinkProgram(shaderProgram);
-    
-   
-    glDeleteShader(vertexShader);
-    glDeleteShader(fragmentShader);
-    
-    return shaderProgram;
-}
-
 unsigned int Renderer::loadTexture(const char* path) {
     unsigned int textureID;
     glGenTextures(1, &textureID);
@@ -275,7 +311,7 @@ unsigned int Renderer::loadTexture(const char* path) {
         else if (nrChannels == 4)
             format = GL_RGBA;
         
-        glBindTexture(GL_TEXTURE_2D, textureID);
+        GLStateCache::bindTexture(GL_TEXTURE_2D, textureID);
         glTexImage2D(GL_TEXTURE_2D, 0, format, width, height, 0, format, GL_UNSIGNED_BYTE, data);
         glGenerateMipmap(GL_TEXTURE_2D);
         
@@ -294,3 +330,38 @@ unsigned int Renderer::loadTexture(const char* path) {
     
     return textureID;
 }
+
+// Her kare için bir zaman ve bir örnek sayısı sorgusu; iki kare dönüşümlü kullanılır
+void Renderer::setupPassQueries() {
+    for (auto& query : passQueries) {
+        glGenQueries(1, &query.timeQuery);
+        glGenQueries(1, &query.fragmentQuery);
+        query.issued = false;
+    }
+}
+
+// Sonuç hazırsa okur ve ilgili modun ortalamasına ekler; hazır değilse bu ölçüm atlanır
+void Renderer::collectPassQuery(StatuePassQuery& query) {
+    if (!query.issued) return;
+    query.issued = false;
+    
+    GLint timeReady = 0, fragmentsReady = 0;
+    glGetQueryObjectiv(query.timeQuery, GL_QUERY_RESULT_AVAILABLE, &timeReady);
+    glGetQueryObjectiv(query.fragmentQuery, GL_QUERY_RESULT_AVAILABLE, &fragmentsReady);
+    if (!timeReady || !fragmentsReady) return;
+    
+    GLuint64 elapsed = 0, fragments = 0;
+    glGetQueryObjectui64v(query.timeQuery, GL_QUERY_RESULT, &elapsed);
+    glGetQueryObjectui64v(query.fragmentQuery, GL_QUERY_RESULT, &fragments);
+    
+    StatuePassStats& stats = passStats[query.withPrepass ? 1 : 0];
+    double milliseconds = elapsed / 1000000.0;
+    if (stats.samples == 0) {
+        stats.gpuMilliseconds = milliseconds;
+        stats.fragments = static_cast<double>(fragments);
+    } else {
+        stats.gpuMilliseconds = stats.gpuMilliseconds * 0.95 + milliseconds * 0.05;
+        stats.fragments = stats.fragments * 0.95 + fragments * 0.05;
+    }
+    stats.samples++;
+}
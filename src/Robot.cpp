@@ -1,9 +1,14 @@
 #include "../include/Robot.hpp"
 #include "../include/Texture.hpp"
+#include "../include/GLStateCache.hpp"
+#include "../include/NavigationSystem.hpp"
+#include "../include/CollisionWorld.hpp"
+#include <iostream>
 #include <GLFW/glfw3.h>
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtc/type_ptr.hpp>
 #include <cmath>
+#include <cstdlib>
 #include <glm/common.hpp> 
 
 const float MIN_X = -2.8f;
@@ -17,14 +22,25 @@ Robot::Robot(const glm::vec3& position)
     : position(position)
     , front(glm::vec3(0.0f, 0.0f, -1.0f))
     , rotation(0.0f)
+    , previousPosition(position)
+    , previousRotation(0.0f)
+    , renderPosition(position)
+    , renderRotation(0.0f)
     , movementSpeed(5.0f)
     , rotationSpeed(90.0f)
-    , isMoving(false), isPopupVisible(false), popupVAO(0), popupVBO(0) {
+    , isMoving(false), hasReachedTarget(false), currentTargetIndex(0)
+    , navigation(nullptr), currentStop(-1), autopilot(false), dwellTimer(0.0f), collision(nullptr)
+    , isPopupVisible(false), scanning(false), scanTimer(0.0f), popupVAO(0), popupVBO(0) {
+    TransformSystem& transforms = TransformSystem::instance();
+    bodyTransform = transforms.create(position, glm::vec3(0.0f), glm::vec3(0.5f));
+    armTransform = transforms.create(glm::vec3(0.39f, 0.2f, 0.6f), glm::vec3(0.0f), glm::vec3(1.0f), bodyTransform);
 }
 
 Robot::~Robot() {
-    glDeleteVertexArrays(1, &popupVAO);
-    glDeleteBuffers(1, &popupVBO);
+    TransformSystem::instance().release(armTransform);
+    TransformSystem::instance().release(bodyTransform);
+    GLStateCache::deleteVertexArrays(1, &popupVAO);
+    GLStateCache::deleteBuffers(1, &popupVBO);
 }
     
 
@@ -37,111 +53,198 @@ bool Robot::initialize() {
     return true;
 }
 
-void Robot::render(const glm::mat4& viewMatrix, const glm::mat4& projectionMatrix, GLuint shaderProgram) {
-    glUseProgram(shaderProgram);
+void Robot::render(const glm::mat4& viewMatrix, const glm::mat4& projectionMatrix, GLuint shaderProgram, bool popupVisible) {
+    GLStateCache::useProgram(shaderProgram);
     
     GLint viewLoc = glGetUniformLocation(shaderProgram, "view");
     GLint projLoc = glGetUniformLocation(shaderProgram, "projection");
     GLint modelLoc = glGetUniformLocation(shaderProgram, "model");
     
-    glUniformMatrix4fv(viewLoc, 1, GL_FALSE, glm::value_ptr(viewMatrix));
-    glUniformMatrix4fv(projLoc, 1, GL_FALSE, glm::value_ptr(projectionMatrix));
+    GLStateCache::uniformMatrix4fv(viewLoc, 1, GL_FALSE, glm::value_ptr(viewMatrix));
+    GLStateCache::uniformMatrix4fv(projLoc, 1, GL_FALSE, glm::value_ptr(projectionMatrix));
     
-    glm::mat4 model = glm::mat4(1.0f);
-    model = glm::translate(model, position);
-    model = glm::rotate(model, glm::radians(rotation), glm::vec3(0.0f, 1.0f, 0.0f));
-    model = glm::scale(model, glm::vec3(0.5f));
+    TransformSystem& transforms = TransformSystem::instance();
+    GLint normalMatrixLoc = glGetUniformLocation(shaderProgram, "normalMatrix");
     
-    glUniformMatrix4fv(modelLoc, 1, GL_FALSE, glm::value_ptr(model));
+    GLStateCache::uniformMatrix4fv(modelLoc, 1, GL_FALSE, glm::value_ptr(transforms.getWorldMatrix(bodyTransform)));
+    GLStateCache::uniformMatrix3fv(normalMatrixLoc, 1, GL_FALSE, glm::value_ptr(transforms.getNormalMatrix(bodyTransform)));
     
-    glActiveTexture(GL_TEXTURE0);
-    glBindTexture(GL_TEXTURE_2D, robotMesh.getRobotTextureID());
-    glUniform1i(glGetUniformLocation(shaderProgram, "robotTexture"), 0);
+    GLStateCache::activeTexture(GL_TEXTURE0);
+    GLStateCache::bindTexture(GL_TEXTURE_2D, robotMesh.getRobotTextureID());
+    GLStateCache::uniform1i(glGetUniformLocation(shaderProgram, "robotTexture"), 0);
     
-    glBindVertexArray(robotMesh.getRobotVAO());
+    GLStateCache::bindVertexArray(robotMesh.getRobotVAO());
     glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(robotMesh.getRobotIndicesCount()), GL_UNSIGNED_INT, 0);
-    glBindVertexArray(0);
+    GLStateCache::bindVertexArray(0);
     
-    glm::mat4 armModel = model;
+    GLStateCache::uniformMatrix4fv(modelLoc, 1, GL_FALSE, glm::value_ptr(transforms.getWorldMatrix(armTransform)));
+    GLStateCache::uniformMatrix3fv(normalMatrixLoc, 1, GL_FALSE, glm::value_ptr(transforms.getNormalMatrix(armTransform)));
     
-    armModel = glm::translate(armModel, glm::vec3(0.39f, 0.2f, 0.1f));
-      
-    
-    armModel = glm::translate(armModel, glm::vec3(0.0f, 0.0f, 0.5f));
-    
-    glUniformMatrix4fv(modelLoc, 1, GL_FALSE, glm::value_ptr(armModel));
-    
-    glBindVertexArray(robotMesh.getArmVAO());
+    GLStateCache::bindVertexArray(robotMesh.getArmVAO());
     glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(robotMesh.getArmIndicesCount()), GL_UNSIGNED_INT, 0);
-    glBindVertexArray(0);
+    GLStateCache::bindVertexArray(0);
     
-    if (isPopupVisible) {
-        glUseProgram(shaderProgram);
+    if (popupVisible) {
+        GLStateCache::useProgram(shaderProgram);
         
         glm::mat4 orthoProjection = glm::ortho(0.0f, 800.0f, 0.0f, 600.0f);
-        glUniformMatrix4fv(projLoc, 1, GL_FALSE, glm::value_ptr(orthoProjection));
+        GLStateCache::uniformMatrix4fv(projLoc, 1, GL_FALSE, glm::value_ptr(orthoProjection));
         
         glm::mat4 popupModel = glm::mat4(1.0f);
-        glUniformMatrix4fv(modelLoc, 1, GL_FALSE, glm::value_ptr(popupModel));
+        GLStateCache::uniformMatrix4fv(modelLoc, 1, GL_FALSE, glm::value_ptr(popupModel));
         
-        glBindVertexArray(popupVAO);
+        GLStateCache::bindVertexArray(popupVAO);
         glDrawArrays(GL_TRIANGLES, 0, 6);
-        glBindVertexArray(0);
+        GLStateCache::bindVertexArray(0);
         
     }
 }
 
-void Robot::update(float deltaTime, const std::vector<std::unique_ptr<Statue>>& statues) {
-    if (isMoving) {
-        glm::vec3 direction = glm::normalize(targetPosition - position);
-        position += direction * movementSpeed * deltaTime;
-
-        
-        position.x = glm::clamp(position.x, MIN_X, MAX_X);
-        position.y = glm::clamp(position.y, MIN_Y, MAX_Y);
-        position.z = glm::clamp(position.z, MIN_Z, MAX_Z);
-        
-        float distance = glm::length(targetPosition - position);
-        if (distance < 0.1f) {
-            isMoving = false;
-            hasReachedTarget = true;
-        }
-    }
+void Robot::renderDepth(const glm::mat4& viewMatrix, const glm::mat4& projectionMatrix, GLuint shaderProgram) {
+    GLStateCache::useProgram(shaderProgram);
+    GLStateCache::uniformMatrix4fv(glGetUniformLocation(shaderProgram, "view"), 1, GL_FALSE, glm::value_ptr(viewMatrix));
+    GLStateCache::uniformMatrix4fv(glGetUniformLocation(shaderProgram, "projection"), 1, GL_FALSE, glm::value_ptr(projectionMatrix));
     
-    const Statue* nearestStatue = findNearestStatue(statues);
+    TransformSystem& transforms = TransformSystem::instance();
+    GLint modelLoc = glGetUniformLocation(shaderProgram, "model");
     
-    static bool isScanning = false;
-    static float scanTimer = 0.0f;
-    static const float scanDuration = 4.0f;
+    GLStateCache::uniformMatrix4fv(modelLoc, 1, GL_FALSE, glm::value_ptr(transforms.getWorldMatrix(bodyTransform)));
+    GLStateCache::bindVertexArray(robotMesh.getRobotVAO());
+    glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(robotMesh.getRobotIndicesCount()), GL_UNSIGNED_INT, 0);
+    
+    GLStateCache::uniformMatrix4fv(modelLoc, 1, GL_FALSE, glm::value_ptr(transforms.getWorldMatrix(armTransform)));
+    GLStateCache::bindVertexArray(robotMesh.getArmVAO());
+    glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(robotMesh.getArmIndicesCount()), GL_UNSIGNED_INT, 0);
+    GLStateCache::bindVertexArray(0);
+}
+
+void Robot::update(float deltaTime, const std::vector<std::unique_ptr<Statue>>& statues, const SpatialHash& statueIndex) {
+    updateAutopilot(deltaTime);
+    
+    const Statue* nearestStatue = findNearestStatue(statues, statueIndex);
     
     if (nearestStatue && isNearStatue(*nearestStatue)) {
         showInfoPopup(*nearestStatue);
         
-        if (glfwGetKey(glfwGetCurrentContext(), GLFW_KEY_E) == GLFW_PRESS && !isScanning) {
-            isScanning = true;
+        if (glfwGetKey(glfwGetCurrentContext(), GLFW_KEY_E) == GLFW_PRESS && !scanning) {
+            scanning = true;
             scanTimer = 0.0f;
         }
     } else {
         closeInfoPopup();
         
-        if (isScanning) {
-            isScanning = false;
+        if (scanning) {
+            scanning = false;
         }
     }
     
-    if (isScanning) {
+    if (scanning) {
         scanTimer += deltaTime;
-        if (scanTimer >= scanDuration) {
-            isScanning = false;
+        if (scanTimer >= SCAN_DURATION) {
+            scanning = false;
             
         }
     }
     
-    if (hasReachedTarget && !isStopped) {
-        currentTargetIndex = (currentTargetIndex + 1) % targetPoints.size();
-        moveTo(targetPoints[currentTargetIndex]);
-        hasReachedTarget = false;
+}
+
+void Robot::setNavigation(NavigationSystem* navigation, const std::vector<glm::vec3>& tourStops) {
+    this->navigation = navigation;
+    this->tourStops = tourStops;
+    currentStop = -1;
+    setAutopilot(false);
+}
+
+void Robot::setAutopilot(bool enabled) {
+    if (enabled && (!navigation || tourStops.empty())) {
+        std::cerr << "Otomatik tur için yol haritası veya durak yok" << std::endl;
+        enabled = false;
+    }
+    autopilot = enabled;
+    isMoving = false;
+    hasReachedTarget = false;
+    targetPoints.clear();
+    dwellTimer = 0.0f;
+    if (autopilot) {
+        planToStop((currentStop + 1) % static_cast<int>(tourStops.size()));
+    }
+}
+
+// Durağın kendisi heykelin içinde; yol heykelin yanındaki en yakın yürünebilir noktada biter
+bool Robot::planToStop(int stop) {
+    currentStop = stop;
+    glm::vec3 goal(tourStops[stop].x, position.y, tourStops[stop].z);
+    if (!navigation->findPath(position, goal, targetPoints) || targetPoints.size() < 2) {
+        targetPoints.clear();
+        isMoving = false;
+        hasReachedTarget = true;
+        return false;
+    }
+    currentTargetIndex = 1;
+    hasReachedTarget = false;
+    moveTo(targetPoints[currentTargetIndex]);
+    return true;
+}
+
+// rotate() ile aynı kural: front = (-sin, -cos)
+void Robot::turnTowards(const glm::vec3& direction, float maxAngle) {
+    float desired = glm::degrees(std::atan2(-direction.x, -direction.z));
+    float delta = std::remainder(desired - rotation, 360.0f);
+    rotation += glm::clamp(delta, -maxAngle, maxAngle);
+    float radians = glm::radians(rotation);
+    front = glm::normalize(glm::vec3(-std::sin(radians), 0.0f, -std::cos(radians)));
+}
+
+void Robot::updateAutopilot(float deltaTime) {
+    if (!autopilot) {
+        // Yol haritası yokken R ile seçilen rastgele noktaya düz gidilir
+        if (isMoving) {
+            followPath(AUTOPILOT_SPEED * deltaTime, AUTOPILOT_TURN_SPEED * deltaTime);
+        }
+        return;
+    }
+    
+    if (hasReachedTarget) {
+        dwellTimer += deltaTime;
+        if (dwellTimer >= STOP_DWELL) {
+            dwellTimer = 0.0f;
+            planToStop((currentStop + 1) % static_cast<int>(tourStops.size()));
+        }
+        return;
     }
+    
+    followPath(AUTOPILOT_SPEED * deltaTime, AUTOPILOT_TURN_SPEED * deltaTime);
+}
+
+// Bu adımda kat edilecek mesafe ara noktalar boyunca harcanır. Hareket moveBy'dan geçer;
+// çarpışma dünyası robotu rotadan iterse sonraki ara noktaya gerçek konumdan gidilir
+void Robot::followPath(float budget, float maxTurn) {
+    glm::vec3 heading(0.0f);
+    while (isMoving && budget > 0.0f) {
+        glm::vec3 offset = targetPosition - position;
+        offset.y = 0.0f;
+        float distance = glm::length(offset);
+        if (distance > 1e-4f) {
+            heading = offset / distance;
+        }
+        if (distance > budget) {
+            moveBy(heading * budget);
+            break;
+        }
+        moveBy(offset);
+        budget -= distance;
+        if (++currentTargetIndex < static_cast<int>(targetPoints.size())) {
+            moveTo(targetPoints[currentTargetIndex]);
+        } else {
+            isMoving = false;
+            hasReachedTarget = true;
+        }
+    }
+    
+    if (glm::length(heading) > 0.0f) {
+        turnTowards(heading, maxTurn);
+    }
+    syncTransform();
 }
 
 void Robot::moveTo(const glm::vec3& targetPosition) {
@@ -153,8 +256,32 @@ glm::vec3 Robot::getPosition() const {
     return position;
 }
 
+// Işınlama; önceki poz da taşınır ki arada interpolasyon yapılmasın
 void Robot::setPosition(const glm::vec3& newPosition) {
     position = newPosition;
+    previousPosition = newPosition;
+    syncTransform();
+}
+
+// Konum veya yön değişince gövde transformunu kirli işaretler
+void Robot::syncTransform() {
+    TransformSystem& transforms = TransformSystem::instance();
+    transforms.setPosition(bodyTransform, position);
+    transforms.setRotation(bodyTransform, glm::vec3(0.0f, rotation, 0.0f));
+}
+
+void Robot::beginTick() {
+    previousPosition = position;
+    previousRotation = rotation;
+}
+
+// Poz değişmediyse TransformSystem versiyonu artmaz, gölge önbellekleri korunur
+void Robot::applyInterpolation(float alpha) {
+    renderPosition = glm::mix(previousPosition, position, alpha);
+    renderRotation = previousRotation + (rotation - previousRotation) * alpha;
+    TransformSystem& transforms = TransformSystem::instance();
+    transforms.setPosition(bodyTransform, renderPosition);
+    transforms.setRotation(bodyTransform, glm::vec3(0.0f, renderRotation, 0.0f));
 }
 
 glm::vec3 Robot::getDirection() const {
@@ -169,74 +296,60 @@ void Robot::closeInfoPopup() {
     isPopupVisible = false;
 }
 
+// R otomatik turu açıp kapatır; yol haritası verilmediyse robotu rastgele bir noktaya gönderir
 void Robot::handleUserInteraction(int key, int action) {
-    if (key == GLFW_KEY_R && action == GLFW_PRESS) {
-        float randomX = static_cast<float>(rand() % 10 - 5);
-        float randomZ = static_cast<float>(rand() % 10 - 5);
-        moveTo(glm::vec3(randomX, 0.0f, randomZ));
+    if (key != GLFW_KEY_R || action != GLFW_PRESS) {
+        return;
+    }
+    if (navigation) {
+        setAutopilot(!autopilot);
+        return;
     }
+    
+    float randomX = static_cast<float>(rand() % 10 - 5);
+    float randomZ = static_cast<float>(rand() % 10 - 5);
+    targetPoints.assign(1, glm::vec3(glm::clamp(randomX, MIN_X, MAX_X), position.y, glm::clamp(randomZ, MIN_Z, MAX_Z)));
+    currentTargetIndex = 0;
+    hasReachedTarget = false;
+    moveTo(targetPoints[0]);
 }
 
 void Robot::moveForward(float speed) {
-    glm::vec3 newPosition = position + front * speed * movementSpeed;
-    
-    newPosition.x = glm::clamp(newPosition.x, MIN_X, MAX_X);
-    newPosition.y = glm::clamp(newPosition.y, MIN_Y, MAX_Y);
-    newPosition.z = glm::clamp(newPosition.z, MIN_Z, MAX_Z);
-    position = newPosition;
+    moveBy(front * speed * movementSpeed);
 }
 
 void Robot::moveBackward(float speed) {
-    glm::vec3 newPosition = position - front * speed * movementSpeed;
-    
-    newPosition.x = glm::clamp(newPosition.x, MIN_X, MAX_X);
-    newPosition.y = glm::clamp(newPosition.y, MIN_Y, MAX_Y);
-    newPosition.z = glm::clamp(newPosition.z, MIN_Z, MAX_Z);
-    position = newPosition;
+    moveBy(-front * speed * movementSpeed);
 }
 
 void Robot::moveLeft(float speed) {
     glm::vec3 leftDirection = glm::normalize(glm::cross(front, glm::vec3(0.0f, 1.0f, 0.0f)));
-    glm::vec3 newPosition = position - leftDirection * speed * movementSpeed;
-    
-    
-    newPosition.x = glm::clamp(newPosition.x, MIN_X, MAX_X);
-    newPosition.y = glm::clamp(newPosition.y, MIN_Y, MAX_Y);
-    newPosition.z = glm::clamp(newPosition.z, MIN_Z, MAX_Z);
-    position = newPosition;
+    moveBy(-leftDirection * speed * movementSpeed);
 }
 
 void Robot::moveRight(float speed) {
     glm::vec3 right = glm::normalize(glm::cross(front, glm::vec3(0.0f, 1.0f, 0.0f))); 
-    glm::vec3 newPosition = position + right * speed * movementSpeed;
-    
-
-    newPosition.x = glm::clamp(newPosition.x, MIN_X, MAX_X);
-    newPosition.y = glm::clamp(newPosition.y, MIN_Y, MAX_Y);
-    newPosition.z = glm::clamp(newPosition.z, MIN_Z, MAX_Z);
-    position = newPosition;
+    moveBy(right * speed * movementSpeed);
 }
 
-
-
 void Robot::moveUp(float speed) {
-    glm::vec3 upDirection = glm::vec3(0.0f, 1.0f, 0.0f);
-    glm::vec3 newPosition = position + upDirection * speed * movementSpeed;
-
-    newPosition.x = glm::clamp(newPosition.x, MIN_X, MAX_X);
-    newPosition.y = glm::clamp(newPosition.y, MIN_Y, MAX_Y); 
-    newPosition.z = glm::clamp(newPosition.z, MIN_Z, MAX_Z);
-    position = newPosition;
+    moveBy(glm::vec3(0.0f, 1.0f, 0.0f) * speed * movementSpeed);
 }
 
 void Robot::moveDown(float speed) {
-    glm::vec3 downDirection = glm::vec3(0.0f, -1.0f, 0.0f);
-    glm::vec3 newPosition = position + downDirection * speed * movementSpeed;
+    moveBy(glm::vec3(0.0f, -1.0f, 0.0f) * speed * movementSpeed);
+}
 
+// Küre hareket boyunca süpürülür, çarptığı yüzeyde kayar; sınır kutusu yine de korunur
+void Robot::moveBy(const glm::vec3& motion) {
+    glm::vec3 newPosition = collision ? collision->moveSphere(position, motion, COLLISION_RADIUS)
+                                      : position + motion;
+    
     newPosition.x = glm::clamp(newPosition.x, MIN_X, MAX_X);
-    newPosition.y = glm::clamp(newPosition.y, MIN_Y, MAX_Y); 
+    newPosition.y = glm::clamp(newPosition.y, MIN_Y, MAX_Y);
     newPosition.z = glm::clamp(newPosition.z, MIN_Z, MAX_Z);
     position = newPosition;
+    syncTransform();
 }
 
 void Robot::rotate(float angle) {
@@ -245,6 +358,7 @@ void Robot::rotate(float angle) {
     front.x = -sin(radians);  
     front.z = -cos(radians);   
     front = glm::normalize(front); 
+    syncTransform();
 }
 
 
@@ -263,35 +377,26 @@ void Robot::createPopupInterface() {
     glGenVertexArrays(1, &popupVAO);
     glGenBuffers(1, &popupVBO);
     
-    glBindVertexArray(popupVAO);
+    GLStateCache::bindVertexArray(popupVAO);
     
-    glBindBuffer(GL_ARRAY_BUFFER, popupVBO);
+    GLStateCache::bindBuffer(GL_ARRAY_BUFFER, popupVBO);
     glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
     
     glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), (void*)0);
     glEnableVertexAttribArray(0);
     
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
-    glBindVertexArray(0);
+    GLStateCache::bindBuffer(GL_ARRAY_BUFFER, 0);
+    GLStateCache::bindVertexArray(0);
 }
 
 
-const Statue* Robot::findNearestStatue(const std::vector<std::unique_ptr<Statue>>& statues) {
-    const Statue* nearestStatue = nullptr;
-    float minDistance = std::numeric_limits<float>::max();
-    
-    for (const auto& statue : statues) {
-        if (isNearStatue(*statue)) {
-            float distance = glm::length(position - statue->getPosition());
-            
-            if (distance < minDistance) {
-                minDistance = distance;
-                nearestStatue = statue.get();
-            }
-        }
+// Sadece isNearStatue mesafesindeki hücrelere bakılır
+const Statue* Robot::findNearestStatue(const std::vector<std::unique_ptr<Statue>>& statues, const SpatialHash& statueIndex) {
+    SpatialHash::Handle nearest = statueIndex.nearestWithin(position, 2.0f);
+    if (nearest == SpatialHash::INVALID_HANDLE) {
+        return nullptr;
     }
-    
-    return nearestStatue;
+    return statues[nearest].get();
 }
 
 bool Robot::isNearStatue(const Statue& statue, float threshold) {
@@ -0,0 +1,277 @@
+#include "../include/RobotFleet.hpp"
+#include "../include/JobSystem.hpp"
+#include "../include/SimdKernels.hpp"
+#include "../include/GLStateCache.hpp"
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/type_ptr.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <iostream>
+
+// Robotlar heykelin bu kadar uzağında, her biri farklı bir açıda durur
+const float VIEW_DISTANCE = 1.0f;
+const float GOLDEN_ANGLE = 2.39996323f;
+
+// Duvarlarla arada bırakılan pay ve gövdenin zeminden yüksekliği (Robot ile aynı ölçek)
+const float WALL_MARGIN = 0.2f;
+const float BODY_HALF_HEIGHT = 0.2f;
+const float BODY_SCALE = 0.5f;
+
+// Bir iş parçasına düşen robot sayısı; küçük filolar tek parçada kalır
+const size_t UPDATE_GRAIN = 256;
+
+RobotFleet::RobotFleet()
+    : mesh(nullptr), minBounds(0.0f), maxBounds(0.0f), floorHeight(0.0f), scanDuration(4.0f), movementSpeed(1.2f),
+      poseVersion(0), uploadedCount(0), bufferCapacity(0), uploadedVersion(0) {
+    instanceBuffers[0] = instanceBuffers[1] = 0;
+    vaos[0] = vaos[1] = 0;
+}
+
+RobotFleet::~RobotFleet() {
+    cleanup();
+}
+
+bool RobotFleet::initialize(const RobotMesh* robotMesh, const std::vector<glm::vec3>& tourStops,
+                            const glm::vec3& roomHalfSize, float duration) {
+    if (!robotMesh) {
+        std::cerr << "Rehber filosu için robot mesh'i yok!" << std::endl;
+        return false;
+    }
+    mesh = robotMesh;
+    scanDuration = duration;
+    floorHeight = -roomHalfSize.y + BODY_HALF_HEIGHT;
+    minBounds = glm::vec3(-roomHalfSize.x + WALL_MARGIN, floorHeight, -roomHalfSize.z + WALL_MARGIN);
+    maxBounds = glm::vec3(roomHalfSize.x - WALL_MARGIN, floorHeight, roomHalfSize.z - WALL_MARGIN);
+
+    stops = tourStops;
+
+    glGenBuffers(2, instanceBuffers);
+    vaos[RobotMesh::PART_BODY] = mesh->createInstancedVAO(RobotMesh::PART_BODY, instanceBuffers[RobotMesh::PART_BODY]);
+    vaos[RobotMesh::PART_ARM] = mesh->createInstancedVAO(RobotMesh::PART_ARM, instanceBuffers[RobotMesh::PART_ARM]);
+    return true;
+}
+
+void RobotFleet::cleanup() {
+    GLStateCache::deleteVertexArrays(2, vaos);
+    GLStateCache::deleteBuffers(2, instanceBuffers);
+    vaos[0] = vaos[1] = 0;
+    instanceBuffers[0] = instanceBuffers[1] = 0;
+    uploadedCount = 0;
+    bufferCapacity = 0;
+}
+
+void RobotFleet::spawn(int count) {
+    size_t robots = static_cast<size_t>(std::max(count, 0));
+    for (std::vector<float>* array : { &positionX, &positionZ, &rotation, &previousX, &previousZ, &previousRotation,
+                                       &targetX, &targetZ, &scanElapsed, &renderX, &renderZ, &renderRotation, &zeros }) {
+        array->assign(robots, 0.0f);
+    }
+    renderY.assign(robots, floorHeight);
+    scales.assign(robots, BODY_SCALE);
+    tourStop.assign(robots, 0);
+    scanStatue.assign(robots, -1);
+    completed.assign(robots, 0);
+    bodyMatrices.assign(robots, glm::mat4(1.0f));
+    armMatrices.assign(robots, glm::mat4(1.0f));
+    armOffsets.assign(robots, glm::translate(glm::mat4(1.0f), glm::vec3(0.39f, 0.2f, 0.6f)));
+
+    // Odanın giriş ucunda satır satır dizilirler
+    const float SPACING = 0.5f;
+    int columns = std::max(1, static_cast<int>((maxBounds.x - minBounds.x) / SPACING) + 1);
+    for (size_t i = 0; i < robots; i++) {
+        int column = static_cast<int>(i % columns);
+        int row = static_cast<int>(i / columns);
+        positionX[i] = previousX[i] = renderX[i] = minBounds.x + column * SPACING;
+        positionZ[i] = previousZ[i] = renderZ[i] = std::max(maxBounds.z - row * SPACING, minBounds.z);
+        tourStop[i] = stops.empty() ? 0 : static_cast<int>(i % stops.size());
+        chooseViewpoint(i);
+    }
+    poseVersion++;
+}
+
+// Durağın çevresinde robota özgü bir açıda izleme noktası
+void RobotFleet::chooseViewpoint(size_t robot) {
+    if (stops.empty()) {
+        targetX[robot] = positionX[robot];
+        targetZ[robot] = positionZ[robot];
+        return;
+    }
+    const glm::vec3& stop = stops[tourStop[robot]];
+    float angle = static_cast<float>(robot) * GOLDEN_ANGLE;
+    targetX[robot] = glm::clamp(stop.x + std::cos(angle) * VIEW_DISTANCE, minBounds.x, maxBounds.x);
+    targetZ[robot] = glm::clamp(stop.z + std::sin(angle) * VIEW_DISTANCE, minBounds.z, maxBounds.z);
+}
+
+void RobotFleet::beginTick() {
+    previousX = positionX;
+    previousZ = positionZ;
+    previousRotation = rotation;
+}
+
+void RobotFleet::update(float deltaTime) {
+    size_t count = getCount();
+    if (count == 0) return;
+    JobSystem::instance().parallelFor(0, count, UPDATE_GRAIN, [this, deltaTime](size_t first, size_t last) {
+        updateRange(first, last, deltaTime);
+    });
+}
+
+// Robot yönü Robot::rotate ile aynı: ön = (-sin r, 0, -cos r)
+static float headingTowards(float dx, float dz) {
+    return glm::degrees(std::atan2(-dx, -dz));
+}
+
+void RobotFleet::updateRange(size_t first, size_t last, float deltaTime) {
+    float step = movementSpeed * deltaTime;
+    for (size_t i = first; i < last; i++) {
+        // Tarama oturumu sürerken robot yerinde bekler
+        if (scanStatue[i] >= 0) {
+            scanElapsed[i] += deltaTime;
+            if (scanElapsed[i] >= scanDuration) {
+                scanStatue[i] = -1;
+                completed[i]++;
+                tourStop[i] = (tourStop[i] + 1) % static_cast<int>(stops.size());
+                chooseViewpoint(i);
+            }
+            continue;
+        }
+
+        float dx = targetX[i] - positionX[i];
+        float dz = targetZ[i] - positionZ[i];
+        float distance = std::sqrt(dx * dx + dz * dz);
+        if (distance <= step) {
+            positionX[i] = targetX[i];
+            positionZ[i] = targetZ[i];
+            if (!stops.empty()) {
+                const glm::vec3& stop = stops[tourStop[i]];
+                rotation[i] = headingTowards(stop.x - positionX[i], stop.z - positionZ[i]);
+                scanStatue[i] = tourStop[i];
+                scanElapsed[i] = 0.0f;
+            }
+        } else {
+            positionX[i] += dx / distance * step;
+            positionZ[i] += dz / distance * step;
+            rotation[i] = headingTowards(dx, dz);
+        }
+    }
+}
+
+void RobotFleet::applyInterpolation(float alpha) {
+    size_t count = getCount();
+    if (count == 0) return;
+    std::atomic<bool> changed(false);
+    JobSystem::instance().parallelFor(0, count, UPDATE_GRAIN, [this, alpha, &changed](size_t first, size_t last) {
+        if (composeRange(first, last, alpha)) {
+            changed.store(true, std::memory_order_relaxed);
+        }
+    });
+    if (changed) {
+        poseVersion++;
+    }
+}
+
+// Poz değiştiyse true; matrisler parça parça SimdKernels ile kurulur
+bool RobotFleet::composeRange(size_t first, size_t last, float alpha) {
+    bool changed = false;
+    for (size_t i = first; i < last; i++) {
+        float x = previousX[i] + (positionX[i] - previousX[i]) * alpha;
+        float z = previousZ[i] + (positionZ[i] - previousZ[i]) * alpha;
+
+        // ±180 sınırında kısa yoldan dönülür
+        float turn = rotation[i] - previousRotation[i];
+        turn -= 360.0f * std::floor((turn + 180.0f) / 360.0f);
+        float heading = previousRotation[i] + turn * alpha;
+
+        changed = changed || x != renderX[i] || z != renderZ[i] || heading != renderRotation[i];
+        renderX[i] = x;
+        renderZ[i] = z;
+        renderRotation[i] = heading;
+    }
+
+    size_t count = last - first;
+    SimdKernels::composeTRS(&renderX[first], &renderY[first], &renderZ[first],
+                            &zeros[first], &renderRotation[first], &zeros[first],
+                            &scales[first], &scales[first], &scales[first], count, &bodyMatrices[first]);
+    SimdKernels::multiply(&bodyMatrices[first], &armOffsets[first], count, &armMatrices[first]);
+    return changed;
+}
+
+void RobotFleet::captureInstances(FleetInstances& instances) const {
+    instances.bodies = bodyMatrices;
+    instances.arms = armMatrices;
+    instances.version = poseVersion;
+}
+
+// Tampon büyümedikçe yeniden ayrılmaz; eski içerik sürücü tarafından bırakılsın diye önce boşaltılır
+void RobotFleet::upload(const FleetInstances& instances) {
+    size_t count = instances.bodies.size();
+    if (count == uploadedCount && instances.version == uploadedVersion) return;
+
+    const std::vector<glm::mat4>* sources[2] = { &instances.bodies, &instances.arms };
+    for (int part = 0; part < 2; part++) {
+        GLStateCache::bindBuffer(GL_ARRAY_BUFFER, instanceBuffers[part]);
+        if (count > bufferCapacity) {
+            glBufferData(GL_ARRAY_BUFFER, count * sizeof(glm::mat4), sources[part]->data(), GL_STREAM_DRAW);
+        } else {
+            glBufferData(GL_ARRAY_BUFFER, bufferCapacity * sizeof(glm::mat4), nullptr, GL_STREAM_DRAW);
+            glBufferSubData(GL_ARRAY_BUFFER, 0, count * sizeof(glm::mat4), sources[part]->data());
+        }
+    }
+    GLStateCache::bindBuffer(GL_ARRAY_BUFFER, 0);
+    bufferCapacity = std::max(bufferCapacity, count);
+    uploadedCount = count;
+    uploadedVersion = instances.version;
+}
+
+void RobotFleet::draw(const glm::mat4& viewMatrix, const glm::mat4& projectionMatrix, GLuint shaderProgram, bool textured) const {
+    if (uploadedCount == 0) return;
+    GLStateCache::useProgram(shaderProgram);
+    GLStateCache::uniformMatrix4fv(glGetUniformLocation(shaderProgram, "view"), 1, GL_FALSE, glm::value_ptr(viewMatrix));
+    GLStateCache::uniformMatrix4fv(glGetUniformLocation(shaderProgram, "projection"), 1, GL_FALSE, glm::value_ptr(projectionMatrix));
+    if (textured) {
+        GLStateCache::activeTexture(GL_TEXTURE0);
+        GLStateCache::bindTexture(GL_TEXTURE_2D, mesh->getRobotTextureID());
+        GLStateCache::uniform1i(glGetUniformLocation(shaderProgram, "texture_diffuse1"), 0);
+    }
+
+    GLsizei instances = static_cast<GLsizei>(uploadedCount);
+    GLStateCache::bindVertexArray(vaos[RobotMesh::PART_BODY]);
+    glDrawElementsInstanced(GL_TRIANGLES, static_cast<GLsizei>(mesh->getRobotIndicesCount()), GL_UNSIGNED_INT, 0, instances);
+    GLStateCache::bindVertexArray(vaos[RobotMesh::PART_ARM]);
+    glDrawElementsInstanced(GL_TRIANGLES, static_cast<GLsizei>(mesh->getArmIndicesCount()), GL_UNSIGNED_INT, 0, instances);
+    GLStateCache::bindVertexArray(0);
+}
+
+void RobotFleet::render(const glm::mat4& viewMatrix, const glm::mat4& projectionMatrix, GLuint shaderProgram) const {
+    draw(viewMatrix, projectionMatrix, shaderProgram, true);
+}
+
+void RobotFleet::renderDepth(const glm::mat4& viewMatrix, const glm::mat4& projectionMatrix, GLuint shaderProgram) const {
+    draw(viewMatrix, projectionMatrix, shaderProgram, false);
+}
+
+float RobotFleet::getScanProgress(size_t robot) const {
+    if (scanStatue[robot] < 0 || scanDuration <= 0.0f) return 0.0f;
+    return std::min(scanElapsed[robot] / scanDuration, 1.0f);
+}
+
+glm::vec3 RobotFleet::getPosition(size_t robot) const {
+    return glm::vec3(positionX[robot], floorHeight, positionZ[robot]);
+}
+
+int RobotFleet::getScanningCount() const {
+    int scanning = 0;
+    for (int statue : scanStatue) {
+        scanning += statue >= 0 ? 1 : 0;
+    }
+    return scanning;
+}
+
+uint64_t RobotFleet::getCompletedScans() const {
+    uint64_t total = 0;
+    for (uint32_t scans : completed) {
+        total += scans;
+    }
+    return total;
+}
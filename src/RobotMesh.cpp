@@ -1,5 +1,6 @@
 #include "../include/RobotMesh.hpp"
 #include "../include/Texture.hpp" 
+#include "../include/GLStateCache.hpp"
 #include <iostream>
 
 RobotMesh::RobotMesh()
@@ -10,16 +11,16 @@ RobotMesh::RobotMesh()
 }
 
 RobotMesh::~RobotMesh() {
-    glDeleteVertexArrays(1, &robotVAO);
-    glDeleteBuffers(1, &robotVBO);
-    glDeleteBuffers(1, &robotEBO);
+    GLStateCache::deleteVertexArrays(1, &robotVAO);
+    GLStateCache::deleteBuffers(1, &robotVBO);
+    GLStateCache::deleteBuffers(1, &robotEBO);
 
-    glDeleteVertexArrays(1, &armVAO);
-    glDeleteBuffers(1, &armVBO);
-    glDeleteBuffers(1, &armEBO);
+    GLStateCache::deleteVertexArrays(1, &armVAO);
+    GLStateCache::deleteBuffers(1, &armVBO);
+    GLStateCache::deleteBuffers(1, &armEBO);
 
     if (robotTextureID != 0) {
-        glDeleteTextures(1, &robotTextureID);
+        GLStateCache::deleteTextures(1, &robotTextureID);
     }
 }
 
@@ -396,12 +397,12 @@ void RobotMesh::createBuffers() {
     glGenBuffers(1, &this->robotVBO);
     glGenBuffers(1, &this->robotEBO);
 
-    glBindVertexArray(this->robotVAO);
+    GLStateCache::bindVertexArray(this->robotVAO);
 
-    glBindBuffer(GL_ARRAY_BUFFER, this->robotVBO);
+    GLStateCache::bindBuffer(GL_ARRAY_BUFFER, this->robotVBO);
     glBufferData(GL_ARRAY_BUFFER, this->bodyVertices.size() * sizeof(float), &this->bodyVertices[0], GL_STATIC_DRAW);
 
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, this->robotEBO);
+    GLStateCache::bindBuffer(GL_ELEMENT_ARRAY_BUFFER, this->robotEBO);
     glBufferData(GL_ELEMENT_ARRAY_BUFFER, this->bodyIndices.size() * sizeof(unsigned int), &this->bodyIndices[0], GL_STATIC_DRAW);
 
     glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)0);
@@ -411,20 +412,20 @@ void RobotMesh::createBuffers() {
     glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)(6 * sizeof(float)));
     glEnableVertexAttribArray(2);
 
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
-    glBindVertexArray(0);
+    GLStateCache::bindBuffer(GL_ARRAY_BUFFER, 0);
+    GLStateCache::bindVertexArray(0);
     this->robotIndicesCount = this->bodyIndices.size();
 
     glGenVertexArrays(1, &this->armVAO);
     glGenBuffers(1, &this->armVBO);
     glGenBuffers(1, &this->armEBO);
     
-    glBindVertexArray(this->armVAO);
+    GLStateCache::bindVertexArray(this->armVAO);
     
-    glBindBuffer(GL_ARRAY_BUFFER, this->armVBO);
+    GLStateCache::bindBuffer(GL_ARRAY_BUFFER, this->armVBO);
     glBufferData(GL_ARRAY_BUFFER, this->armVerticesData.size() * sizeof(float), &this->armVerticesData[0], GL_STATIC_DRAW);
     
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, this->armEBO);
+    GLStateCache::bindBuffer(GL_ELEMENT_ARRAY_BUFFER, this->armEBO);
     glBufferData(GL_ELEMENT_ARRAY_BUFFER, this->armIndicesData.size() * sizeof(unsigned int), &this->armIndicesData[0], GL_STATIC_DRAW);
     
     glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)0);
@@ -434,7 +435,35 @@ void RobotMesh::createBuffers() {
     glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)(6 * sizeof(float)));
     glEnableVertexAttribArray(2);
     
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
-    glBindVertexArray(0);
+    GLStateCache::bindBuffer(GL_ARRAY_BUFFER, 0);
+    GLStateCache::bindVertexArray(0);
     this->armIndicesCount = this->armIndicesData.size();
 }
+
+GLuint RobotMesh::createInstancedVAO(Part part, GLuint instanceBuffer) const {
+    GLuint vao = 0;
+    glGenVertexArrays(1, &vao);
+    GLStateCache::bindVertexArray(vao);
+
+    GLStateCache::bindBuffer(GL_ARRAY_BUFFER, part == PART_BODY ? robotVBO : armVBO);
+    GLStateCache::bindBuffer(GL_ELEMENT_ARRAY_BUFFER, part == PART_BODY ? robotEBO : armEBO);
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)0);
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)(3 * sizeof(float)));
+    glEnableVertexAttribArray(1);
+    glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)(6 * sizeof(float)));
+    glEnableVertexAttribArray(2);
+
+    // mat4 dört vec4 konumu kaplar; her örnekte bir ilerler
+    GLStateCache::bindBuffer(GL_ARRAY_BUFFER, instanceBuffer);
+    for (int column = 0; column < 4; column++) {
+        GLuint location = 3 + column;
+        glVertexAttribPointer(location, 4, GL_FLOAT, GL_FALSE, sizeof(glm::mat4), (void*)(column * sizeof(glm::vec4)));
+        glEnableVertexAttribArray(location);
+        glVertexAttribDivisor(location, 1);
+    }
+
+    GLStateCache::bindBuffer(GL_ARRAY_BUFFER, 0);
+    GLStateCache::bindVertexArray(0);
+    return vao;
+}
@@ -1,4 +1,6 @@
 #include "../include/Room.hpp"
+#include "../include/LightingSystem.hpp"
+#include "../include/GLStateCache.hpp"
 #include <iostream>
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtc/type_ptr.hpp>
@@ -16,9 +18,9 @@ Room::Room(float width, float height, float length)
 
 // Oda silinince hafızayı temizlemek için
 Room::~Room() {
-    glDeleteVertexArrays(1, &roomVAO);
-    glDeleteBuffers(1, &roomVBO);
-    glDeleteTextures(1, &wallTextureID);
+    GLStateCache::deleteVertexArrays(1, &roomVAO);
+    GLStateCache::deleteBuffers(1, &roomVBO);
+    GLStateCache::deleteTextures(1, &wallTextureID);
 }
 
 // Odayı kullanıma hazırlar, duvar resmini yüklenir ambientcg sitesinden aldim
@@ -27,7 +29,7 @@ bool Room::initialize() {
     unsigned char *data = stbi_load("textures/walls/duvarresmi.jpg", &width, &height, &nrChannels, 0);
     if (data) {
         glGenTextures(1, &wallTextureID);
-        glBindTexture(GL_TEXTURE_2D, wallTextureID);
+        GLStateCache::bindTexture(GL_TEXTURE_2D, wallTextureID);
         glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, width, height, 0, GL_RGB, GL_UNSIGNED_BYTE, data);
         glGenerateMipmap(GL_TEXTURE_2D);
         
@@ -48,40 +50,43 @@ bool Room::initialize() {
 }
 
 // Odayı ekrana çizdiğimiz kisim
-void Room::render(const glm::mat4& viewMatrix, const glm::mat4& projectionMatrix, GLuint shaderProgram) {
-    glUseProgram(shaderProgram);
+void Room::render(const glm::mat4& viewMatrix, const glm::mat4& projectionMatrix, ShaderLibrary& shaderLibrary,
+                  const LightingSystem* lighting) {
+    // Duvarlar her zaman dokulu çizildiği için WALL varyantı istenir
+    bool shadows = lighting && lighting->hasShadows();
+    unsigned int features = SHADER_FEATURE_WALL | (shadows ? SHADER_FEATURE_SHADOWS : 0u);
+    GLuint shaderProgram = shaderLibrary.use(ShaderLibrary::variantKey(features, 4));
+    if (shadows) {
+        lighting->applyShadows(shaderProgram);
+    }
     
     GLint modelLoc = glGetUniformLocation(shaderProgram, "model");
     GLint viewLoc = glGetUniformLocation(shaderProgram, "view");
     GLint projLoc = glGetUniformLocation(shaderProgram, "projection");
-    GLint objectColorLoc = glGetUniformLocation(shaderProgram, "objectColor");
-    GLint lightPosLoc = glGetUniformLocation(shaderProgram, "lightPos");
+    GLint lightPosLoc = glGetUniformLocation(shaderProgram, "lightPositions");
     GLint lightColorsLoc = glGetUniformLocation(shaderProgram, "lightColors");
     GLint viewPosLoc = glGetUniformLocation(shaderProgram, "viewPos");
-    GLint hasTextureLoc = glGetUniformLocation(shaderProgram, "hasTexture");
-    GLint useWallTextureLoc = glGetUniformLocation(shaderProgram, "useWallTexture");
     GLint wallTextureLoc = glGetUniformLocation(shaderProgram, "wallTexture");
     
-    glUniformMatrix4fv(viewLoc, 1, GL_FALSE, glm::value_ptr(viewMatrix));
-    glUniformMatrix4fv(projLoc, 1, GL_FALSE, glm::value_ptr(projectionMatrix));
+    GLStateCache::uniformMatrix4fv(viewLoc, 1, GL_FALSE, glm::value_ptr(viewMatrix));
+    GLStateCache::uniformMatrix4fv(projLoc, 1, GL_FALSE, glm::value_ptr(projectionMatrix));
     
     glm::mat4 model = glm::mat4(1.0f);
-    glUniformMatrix4fv(modelLoc, 1, GL_FALSE, glm::value_ptr(model));
-    
-    glUniform3fv(lightPosLoc, 4, glm::value_ptr(lightPositions[0]));
-    glUniform3fv(lightColorsLoc, 4, glm::value_ptr(lightColors[0]));
-    glUniform3fv(viewPosLoc, 1, glm::value_ptr(cameraPosition));
+    GLStateCache::uniformMatrix4fv(modelLoc, 1, GL_FALSE, glm::value_ptr(model));
+    glm::mat3 normalMatrix = glm::mat3(1.0f);
+    GLStateCache::uniformMatrix3fv(glGetUniformLocation(shaderProgram, "normalMatrix"), 1, GL_FALSE, glm::value_ptr(normalMatrix));
     
-    glUniform1i(hasTextureLoc, GL_FALSE); 
-    glUniform1i(useWallTextureLoc, GL_TRUE); 
+    GLStateCache::uniform3fv(lightPosLoc, 4, glm::value_ptr(lightPositions[0]));
+    GLStateCache::uniform3fv(lightColorsLoc, 4, glm::value_ptr(lightColors[0]));
+    GLStateCache::uniform3fv(viewPosLoc, 1, glm::value_ptr(cameraPosition));
     
-    glActiveTexture(GL_TEXTURE1); 
-    glBindTexture(GL_TEXTURE_2D, wallTextureID);
-    glUniform1i(wallTextureLoc, 1); 
+    GLStateCache::activeTexture(GL_TEXTURE1); 
+    GLStateCache::bindTexture(GL_TEXTURE_2D, wallTextureID);
+    GLStateCache::uniform1i(wallTextureLoc, 1); 
     
-    glBindVertexArray(roomVAO);
+    GLStateCache::bindVertexArray(roomVAO);
     glDrawArrays(GL_TRIANGLES, 0, 36); 
-    glBindVertexArray(0);
+    GLStateCache::bindVertexArray(0);
 }
 
 // Odanın iskeletini  oluşturdum
@@ -133,8 +138,8 @@ void Room::setupRoom() {
     glGenVertexArrays(1, &roomVAO);
     glGenBuffers(1, &roomVBO);
     
-    glBindVertexArray(roomVAO);
-    glBindBuffer(GL_ARRAY_BUFFER, roomVBO);
+    GLStateCache::bindVertexArray(roomVAO);
+    GLStateCache::bindBuffer(GL_ARRAY_BUFFER, roomVBO);
     glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
     
     glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)0);
@@ -144,8 +149,8 @@ void Room::setupRoom() {
     glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, 8 * sizeof(float), (void*)(6 * sizeof(float)));
     glEnableVertexAttribArray(2);
     
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
-    glBindVertexArray(0);
+    GLStateCache::bindBuffer(GL_ARRAY_BUFFER, 0);
+    GLStateCache::bindVertexArray(0);
 }
 
 // Sahnenin ışıklarını yerleştirme
@@ -0,0 +1,400 @@
+#include "../include/ShaderLibrary.hpp"
+#include "../include/ProgramCache.hpp"
+#include "../include/GLExtensions.hpp"
+#include "../include/GLStateCache.hpp"
+#include <iostream>
+#include <chrono>
+
+// Tüm sahne shader'larının ortak kaynağı. Dallanma yerine #ifdef kullanılır,
+// böylece her varyant sadece ihtiyaç duyduğu kodu içerir.
+const char* ShaderLibrary::vertexShaderSource = R"(
+#ifdef COMPRESSED_VERTICES
+    layout (location = 0) in vec4 aPos;
+    layout (location = 1) in vec4 aNormal;
+    uniform vec3 positionScale;
+    uniform vec3 positionOffset;
+#else
+    layout (location = 0) in vec3 aPos;
+    layout (location = 1) in vec3 aNormal;
+#endif
+    layout (location = 2) in vec2 aTexCoords;
+
+    out vec3 FragPos;
+    out vec3 Normal;
+    out vec2 TexCoords;
+
+    // Derinlik ön geçişi ile renk geçişi GL_EQUAL ile karşılaştırıldığı için
+    // tüm varyantlar aynı konumu bit bit aynı hesaplamalı
+    invariant gl_Position;
+
+    uniform mat4 view;
+    uniform mat4 projection;
+#ifdef INSTANCED
+    // Örnekler eşit ölçekli olduğundan normal matrisi modelin 3x3 kısmıdır
+    layout (location = 3) in mat4 instanceModel;
+#else
+    uniform mat4 model;
+    uniform mat3 normalMatrix;
+#endif
+
+    void main() {
+#ifdef COMPRESSED_VERTICES
+        vec3 position = aPos.xyz * positionScale + positionOffset;
+#else
+        vec3 position = aPos;
+#endif
+#ifdef INSTANCED
+        FragPos = vec3(instanceModel * vec4(position, 1.0));
+        Normal = mat3(instanceModel) * aNormal.xyz;
+#else
+        FragPos = vec3(model * vec4(position, 1.0));
+        Normal = normalMatrix * aNormal.xyz;
+#endif
+        TexCoords = aTexCoords;
+        gl_Position = projection * view * vec4(FragPos, 1.0);
+    }
+)";
+
+const char* ShaderLibrary::fragmentShaderSource = R"(
+    out vec4 FragColor;
+
+#ifdef DEPTH_ONLY
+    void main() {
+        FragColor = vec4(0.0);
+    }
+#else
+    in vec3 FragPos;
+    in vec3 Normal;
+    in vec2 TexCoords;
+
+    uniform vec3 lightPositions[LIGHT_COUNT];
+    uniform vec3 lightColors[LIGHT_COUNT];
+    uniform vec3 viewPos;
+#if defined(TEXTURED)
+    uniform sampler2D texture_diffuse1;
+#elif defined(WALL)
+    uniform sampler2D wallTexture;
+#else
+    uniform vec3 objectColor;
+#endif
+
+#ifdef SHADOWS
+    #define MAX_SHADOWED_LIGHTS 8
+    uniform sampler2D staticShadowAtlas;
+    uniform sampler2D dynamicShadowAtlas;
+    uniform int shadowedLightCount;
+    uniform mat4 shadowMatrices[MAX_SHADOWED_LIGHTS];
+    uniform vec4 shadowRects[MAX_SHADOWED_LIGHTS];
+    uniform vec4 shadowLightPositions[MAX_SHADOWED_LIGHTS];  // w = 1 spot, w = 0 yönlü
+    uniform vec3 shadowLightDirections[MAX_SHADOWED_LIGHTS];
+    uniform vec3 shadowLightColors[MAX_SHADOWED_LIGHTS];
+    uniform vec2 shadowLightCutOffs[MAX_SHADOWED_LIGHTS];   // iç ve dış açının kosinüsü
+
+    // Statik ve dinamik katmandan en yakın engel alınır
+    float shadowVisibility(int i, vec3 norm, vec3 lightDir) {
+        vec4 lightSpace = shadowMatrices[i] * vec4(FragPos, 1.0);
+        vec3 coords = lightSpace.xyz / lightSpace.w * 0.5 + 0.5;
+        if (coords.z > 1.0 || any(lessThan(coords.xy, vec2(0.0))) || any(greaterThan(coords.xy, vec2(1.0)))) {
+            return 1.0;
+        }
+        vec2 uv = shadowRects[i].xy + coords.xy * shadowRects[i].zw;
+        float closest = min(texture(staticShadowAtlas, uv).r, texture(dynamicShadowAtlas, uv).r);
+        float bias = max(0.005 * (1.0 - dot(norm, lightDir)), 0.001);
+        return coords.z - bias > closest ? 0.0 : 1.0;
+    }
+#endif
+
+#ifdef LIGHT_ATTENUATION
+    const float diffuseScale = 1.0;
+    const float specularStrength = 0.5;
+    const float shininess = 32.0;
+#else
+    const float diffuseScale = 0.4;
+    const float specularStrength = 0.12;
+    const float shininess = 16.0;
+#endif
+
+    void main() {
+        vec3 ambient = vec3(0.3);
+        vec3 norm = normalize(Normal);
+        vec3 viewDir = normalize(viewPos - FragPos);
+
+        vec3 lighting = vec3(0.0);
+        for (int i = 0; i < LIGHT_COUNT; i++) {
+            vec3 lightDir = normalize(lightPositions[i] - FragPos);
+            float diff = max(dot(norm, lightDir), 0.0);
+            vec3 reflectDir = reflect(-lightDir, norm);
+            float spec = pow(max(dot(viewDir, reflectDir), 0.0), shininess);
+            vec3 contribution = (diff * diffuseScale + specularStrength * spec) * lightColors[i];
+#ifdef LIGHT_ATTENUATION
+            float distance = length(lightPositions[i] - FragPos);
+            contribution *= 1.0 / (1.0 + 0.09 * distance + 0.032 * (distance * distance));
+#endif
+            lighting += contribution;
+        }
+
+#ifdef SHADOWS
+        for (int i = 0; i < shadowedLightCount; i++) {
+            vec3 lightDir;
+            float spotFactor = 1.0;
+            if (shadowLightPositions[i].w > 0.5) {
+                lightDir = normalize(shadowLightPositions[i].xyz - FragPos);
+                float theta = dot(lightDir, normalize(-shadowLightDirections[i]));
+                spotFactor = clamp((theta - shadowLightCutOffs[i].y) / (shadowLightCutOffs[i].x - shadowLightCutOffs[i].y), 0.0, 1.0);
+            } else {
+                lightDir = normalize(-shadowLightDirections[i]);
+            }
+            float diff = max(dot(norm, lightDir), 0.0);
+            if (diff * spotFactor > 0.0) {
+                lighting += diff * diffuseScale * spotFactor * shadowVisibility(i, norm, lightDir) * shadowLightColors[i];
+            }
+        }
+#endif
+
+#if defined(TEXTURED)
+        vec3 baseColor = texture(texture_diffuse1, TexCoords).rgb;
+#elif defined(WALL)
+        vec3 baseColor = texture(wallTexture, TexCoords).rgb;
+#else
+        vec3 baseColor = objectColor;
+#endif
+
+        FragColor = vec4((ambient + lighting) * baseColor, 1.0);
+    }
+#endif
+)";
+
+ShaderLibrary::ShaderLibrary() : blockedMilliseconds(0.0), nextCustomKey(0) {
+}
+
+ShaderLibrary::~ShaderLibrary() {
+    cleanup();
+}
+
+unsigned int ShaderLibrary::variantKey(unsigned int features, int lightCount) {
+    if (lightCount < 1) lightCount = 1;
+    if (lightCount > MAX_LIGHTS) lightCount = MAX_LIGHTS;
+    return (features & FEATURE_MASK) | (static_cast<unsigned int>(lightCount) << LIGHT_COUNT_SHIFT);
+}
+
+unsigned int ShaderLibrary::featuresOf(unsigned int key) {
+    return key & FEATURE_MASK;
+}
+
+int ShaderLibrary::lightCountOf(unsigned int key) {
+    return static_cast<int>(key >> LIGHT_COUNT_SHIFT);
+}
+
+bool ShaderHandle::isReady() const {
+    return library && library->isReady(key);
+}
+
+GLuint ShaderHandle::get() const {
+    return library ? library->getProgram(key) : 0;
+}
+
+// Varyantın derlemesini başlatır, sonucu ilk kullanımda sorgulanır
+ShaderHandle ShaderLibrary::request(unsigned int key) {
+    if ((key & CUSTOM_KEY_BIT) == 0 && programs.find(key) == programs.end() && pending.find(key) == pending.end()) {
+        std::string vs = buildVertexSource(key);
+        std::string fs = buildFragmentSource(key);
+        pending[key] = beginBuild(vs.c_str(), fs.c_str());
+    }
+    return ShaderHandle(this, key);
+}
+
+ShaderHandle ShaderLibrary::request(const char* vertexSource, const char* fragmentSource) {
+    unsigned int key = CUSTOM_KEY_BIT | nextCustomKey++;
+    pending[key] = beginBuild(vertexSource, fragmentSource);
+    return ShaderHandle(this, key);
+}
+
+void ShaderLibrary::precompile(const std::vector<unsigned int>& keys) {
+    for (unsigned int key : keys) {
+        request(key);
+    }
+}
+
+bool ShaderLibrary::isReady(unsigned int key) {
+    if (programs.find(key) != programs.end()) {
+        return true;
+    }
+    auto it = pending.find(key);
+    return it != pending.end() && isBuildComplete(it->second);
+}
+
+// Varyantı önbellekte arar; derlemesi sürüyorsa bitirir, hiç yoksa derleyip ekler
+GLuint ShaderLibrary::getProgram(unsigned int key) {
+    auto it = programs.find(key);
+    if (it != programs.end()) {
+        return it->second;
+    }
+
+    // Özel programın kaynağı kütüphanede yok; istenmemişse ya da silinmişse yeniden derlenemez
+    if ((key & CUSTOM_KEY_BIT) != 0 && pending.find(key) == pending.end()) {
+        return 0;
+    }
+
+    request(key);
+    auto start = std::chrono::steady_clock::now();
+    GLuint program = finishBuild(pending[key]);
+    blockedMilliseconds += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    pending.erase(key);
+
+    if (program == 0) {
+        std::cerr << "Shader varyantı derlenemedi: 0x" << std::hex << key << std::dec << std::endl;
+    }
+    programs[key] = program;
+    return program;
+}
+
+GLuint ShaderLibrary::use(unsigned int key) {
+    GLuint program = getProgram(key);
+    GLStateCache::useProgram(program);
+    return program;
+}
+
+// Anahtardaki bayrakları #define satırlarına çevirir
+std::string ShaderLibrary::buildDefines(unsigned int key) {
+    unsigned int features = featuresOf(key);
+    std::string defines = "#version 330 core\n";
+    defines += "#define LIGHT_COUNT " + std::to_string(lightCountOf(key)) + "\n";
+    if (features & SHADER_FEATURE_TEXTURED) defines += "#define TEXTURED\n";
+    if (features & SHADER_FEATURE_WALL) defines += "#define WALL\n";
+    if (features & SHADER_FEATURE_ATTENUATION) defines += "#define LIGHT_ATTENUATION\n";
+    if (features & SHADER_FEATURE_COMPRESSED) defines += "#define COMPRESSED_VERTICES\n";
+    if (features & SHADER_FEATURE_DEPTH_ONLY) defines += "#define DEPTH_ONLY\n";
+    if (features & SHADER_FEATURE_SHADOWS) defines += "#define SHADOWS\n";
+    if (features & SHADER_FEATURE_INSTANCED) defines += "#define INSTANCED\n";
+    return defines;
+}
+
+std::string ShaderLibrary::buildVertexSource(unsigned int key) {
+    return buildDefines(key) + vertexShaderSource;
+}
+
+std::string ShaderLibrary::buildFragmentSource(unsigned int key) {
+    return buildDefines(key) + fragmentShaderSource;
+}
+
+// Önce disk önbelleğine bakar, bulamazsa kaynaktan derleyip sonucu önbelleğe yazar
+GLuint ShaderLibrary::compileProgram(const char* vertexSource, const char* fragmentSource) {
+    PendingBuild build = beginBuild(vertexSource, fragmentSource);
+    return finishBuild(build);
+}
+
+void ShaderLibrary::enableParallelCompile() {
+    if (GLExtensions::parallelShaderCompile && GLExtensions::MaxShaderCompilerThreads) {
+        // 0xFFFFFFFF: iş parçacığı sayısını sürücü seçsin
+        GLExtensions::MaxShaderCompilerThreads(0xFFFFFFFFu);
+    }
+}
+
+// Derleme ve bağlama komutlarını verir, hiçbir durum sorgusu yapmaz.
+// Böylece sürücü işi kendi iş parçacıklarında yürütebilir.
+ShaderLibrary::PendingBuild ShaderLibrary::beginBuild(const char* vertexSource, const char* fragmentSource) {
+    PendingBuild build = { 0, 0, 0, 0 };
+
+    if (ProgramCache::isEnabled()) {
+        build.cacheKey = ProgramCache::makeKey(vertexSource, fragmentSource);
+        build.program = ProgramCache::load(build.cacheKey);
+        if (build.program != 0) {
+            return build;
+        }
+    }
+
+    build.vertexShader = glCreateShader(GL_VERTEX_SHADER);
+    glShaderSource(build.vertexShader, 1, &vertexSource, nullptr);
+    glCompileShader(build.vertexShader);
+
+    build.fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
+    glShaderSource(build.fragmentShader, 1, &fragmentSource, nullptr);
+    glCompileShader(build.fragmentShader);
+
+    build.program = glCreateProgram();
+    glAttachShader(build.program, build.vertexShader);
+    glAttachShader(build.program, build.fragmentShader);
+    ProgramCache::prepareForLink(build.program);
+    GLStateCache::linkProgram(build.program);
+    return build;
+}
+
+// Eklenti yoksa tamamlanma durumu beklemeden öğrenilemez
+bool ShaderLibrary::isBuildComplete(const PendingBuild& build) {
+    if (build.vertexShader == 0) {
+        return true;
+    }
+    if (!GLExtensions::parallelShaderCompile) {
+        return false;
+    }
+    GLint complete = GL_FALSE;
+    glGetProgramiv(build.program, GL_COMPLETION_STATUS_KHR, &complete);
+    return complete == GL_TRUE;
+}
+
+// Derleme/bağlama sonucunu sorgular (gerekirse bekler) ve hataları loglar
+GLuint ShaderLibrary::finishBuild(PendingBuild& build) {
+    if (build.vertexShader == 0) {
+        return build.program;
+    }
+
+    int success;
+    char infoLog[512];
+    bool compiled = true;
+
+    glGetShaderiv(build.vertexShader, GL_COMPILE_STATUS, &success);
+    if (!success) {
+        glGetShaderInfoLog(build.vertexShader, 512, NULL, infoLog);
+        std::cerr << "Vertex shader derleme hatası: " << infoLog << std::endl;
+        compiled = false;
+    }
+
+    glGetShaderiv(build.fragmentShader, GL_COMPILE_STATUS, &success);
+    if (!success) {
+        glGetShaderInfoLog(build.fragmentShader, 512, NULL, infoLog);
+        std::cerr << "Fragment shader derleme hatası: " << infoLog << std::endl;
+        compiled = false;
+    }
+
+    glDeleteShader(build.vertexShader);
+    glDeleteShader(build.fragmentShader);
+    build.vertexShader = 0;
+    build.fragmentShader = 0;
+
+    glGetProgramiv(build.program, GL_LINK_STATUS, &success);
+    if (!compiled || !success) {
+        if (compiled) {
+            glGetProgramInfoLog(build.program, 512, NULL, infoLog);
+            std::cerr << "Shader program bağlama hatası: " << infoLog << std::endl;
+        }
+        GLStateCache::deleteProgram(build.program);
+        build.program = 0;
+        return 0;
+    }
+
+    if (ProgramCache::isEnabled()) {
+        ProgramCache::store(build.cacheKey, build.program);
+    }
+    return build.program;
+}
+
+void ShaderLibrary::cleanup() {
+    for (auto& entry : programs) {
+        if (entry.second != 0) {
+            GLStateCache::deleteProgram(entry.second);
+        }
+    }
+    programs.clear();
+
+    for (auto& entry : pending) {
+        PendingBuild& build = entry.second;
+        if (build.vertexShader != 0) {
+            glDeleteShader(build.vertexShader);
+            glDeleteShader(build.fragmentShader);
+        }
+        if (build.program != 0) {
+            GLStateCache::deleteProgram(build.program);
+        }
+    }
+    pending.clear();
+}
@@ -0,0 +1,102 @@
+#include "../include/ShadowAtlas.hpp"
+#include "../include/GLStateCache.hpp"
+#include <iostream>
+
+ShadowAtlas::ShadowAtlas() : activeLayer(STATIC_LAYER), previousFramebuffer(0) {
+    for (int i = 0; i < 2; i++) {
+        framebuffers[i] = 0;
+        textures[i] = 0;
+        tileSizes[i] = 0;
+    }
+    for (int i = 0; i < 4; i++) {
+        previousViewport[i] = 0;
+    }
+}
+
+ShadowAtlas::~ShadowAtlas() {
+    cleanup();
+}
+
+// Her katman için bir derinlik dokusu ve ona bağlı framebuffer oluşturur
+bool ShadowAtlas::initialize(int staticTileSize, int dynamicTileSize) {
+    tileSizes[STATIC_LAYER] = staticTileSize;
+    tileSizes[DYNAMIC_LAYER] = dynamicTileSize;
+
+    GLint previous = 0;
+    glGetIntegerv(GL_FRAMEBUFFER_BINDING, &previous);
+
+    for (int layer = 0; layer < 2; layer++) {
+        int width = tileSizes[layer] * TILE_COLUMNS;
+        int height = tileSizes[layer] * TILE_ROWS;
+
+        glGenTextures(1, &textures[layer]);
+        GLStateCache::bindTexture(GL_TEXTURE_2D, textures[layer]);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_DEPTH_COMPONENT24, width, height, 0, GL_DEPTH_COMPONENT, GL_FLOAT, nullptr);
+        // Karolar arasında karışma olmasın diye filtreleme yok
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+        glGenFramebuffers(1, &framebuffers[layer]);
+        glBindFramebuffer(GL_FRAMEBUFFER, framebuffers[layer]);
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_TEXTURE_2D, textures[layer], 0);
+        glDrawBuffer(GL_NONE);
+        glReadBuffer(GL_NONE);
+
+        if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+            std::cerr << "Gölge atlası framebuffer'ı oluşturulamadı!" << std::endl;
+            glBindFramebuffer(GL_FRAMEBUFFER, previous);
+            cleanup();
+            return false;
+        }
+
+        // Boş atlas "gölge yok" anlamına gelsin
+        glClearDepth(1.0);
+        glClear(GL_DEPTH_BUFFER_BIT);
+    }
+
+    GLStateCache::bindTexture(GL_TEXTURE_2D, 0);
+    glBindFramebuffer(GL_FRAMEBUFFER, previous);
+    return true;
+}
+
+void ShadowAtlas::cleanup() {
+    for (int i = 0; i < 2; i++) {
+        if (framebuffers[i] != 0) glDeleteFramebuffers(1, &framebuffers[i]);
+        if (textures[i] != 0) GLStateCache::deleteTextures(1, &textures[i]);
+        framebuffers[i] = 0;
+        textures[i] = 0;
+    }
+}
+
+void ShadowAtlas::begin(Layer layer) {
+    activeLayer = layer;
+    glGetIntegerv(GL_VIEWPORT, previousViewport);
+    glGetIntegerv(GL_FRAMEBUFFER_BINDING, &previousFramebuffer);
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffers[layer]);
+    GLStateCache::depthMask(GL_TRUE);
+    GLStateCache::enable(GL_SCISSOR_TEST);
+}
+
+void ShadowAtlas::beginTile(int tile) {
+    int size = tileSizes[activeLayer];
+    int x = (tile % TILE_COLUMNS) * size;
+    int y = (tile / TILE_COLUMNS) * size;
+
+    glViewport(x, y, size, size);
+    glScissor(x, y, size, size);
+    glClear(GL_DEPTH_BUFFER_BIT);
+}
+
+void ShadowAtlas::end() {
+    GLStateCache::disable(GL_SCISSOR_TEST);
+    glBindFramebuffer(GL_FRAMEBUFFER, previousFramebuffer);
+    glViewport(previousViewport[0], previousViewport[1], previousViewport[2], previousViewport[3]);
+}
+
+glm::vec4 ShadowAtlas::getTileRect(int tile) const {
+    float width = 1.0f / TILE_COLUMNS;
+    float height = 1.0f / TILE_ROWS;
+    return glm::vec4((tile % TILE_COLUMNS) * width, (tile / TILE_COLUMNS) * height, width, height);
+}
@@ -0,0 +1,814 @@
+#include "../include/SimdKernels.hpp"
+#include <glm/gtc/matrix_transform.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define VM_SIMD_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+// MSVC intrinsic'leri derleme bayrağı olmadan da üretir
+#define VM_TARGET_AVX2
+#else
+#define VM_TARGET_AVX2 __attribute__((target("avx2,fma")))
+#endif
+#endif
+
+#if defined(__aarch64__) && defined(__ARM_NEON)
+#define VM_SIMD_NEON 1
+#include <arm_neon.h>
+#endif
+
+typedef void (*DistancesFunction)(const float*, const float*, const float*, size_t, const glm::vec3&, float*);
+typedef void (*SpheresFunction)(const float*, const float*, const float*, const float*, size_t, const glm::vec4*, uint8_t*);
+typedef void (*BoxesFunction)(const float*, const float*, const float*, const float*, const float*, const float*,
+                              size_t, const glm::vec4*, uint8_t*);
+typedef void (*ComposeFunction)(const float*, const float*, const float*, const float*, const float*, const float*,
+                                const float*, const float*, const float*, size_t, glm::mat4*);
+typedef void (*MultiplyFunction)(const glm::mat4*, const glm::mat4*, size_t, glm::mat4*);
+
+struct KernelTable {
+    DistancesFunction distances;
+    SpheresFunction spheres;
+    BoxesFunction boxes;
+    ComposeFunction compose;
+    MultiplyFunction multiply;
+};
+
+static const float DEGREES_TO_RADIANS = 0.01745329251994329577f;
+
+// ---------------------------------------------------------------------------
+// Skaler yedek; diğer yollar kalan (genişliğe bölünmeyen) öğeler için de bunu kullanır
+
+static void distancesScalar(const float* x, const float* y, const float* z, size_t count,
+                            const glm::vec3& point, float* out) {
+    for (size_t i = 0; i < count; i++) {
+        float dx = x[i] - point.x, dy = y[i] - point.y, dz = z[i] - point.z;
+        out[i] = std::sqrt(dx * dx + dy * dy + dz * dz);
+    }
+}
+
+static void spheresScalar(const float* x, const float* y, const float* z, const float* radius, size_t count,
+                          const glm::vec4* planes, uint8_t* visible) {
+    for (size_t i = 0; i < count; i++) {
+        uint8_t inside = 1;
+        for (int p = 0; p < 6; p++) {
+            float distance = planes[p].x * x[i] + planes[p].y * y[i] + planes[p].z * z[i] + planes[p].w;
+            if (distance < -radius[i]) {
+                inside = 0;
+                break;
+            }
+        }
+        visible[i] = inside;
+    }
+}
+
+static void boxesScalar(const float* centerX, const float* centerY, const float* centerZ,
+                        const float* extentX, const float* extentY, const float* extentZ,
+                        size_t count, const glm::vec4* planes, uint8_t* visible) {
+    for (size_t i = 0; i < count; i++) {
+        uint8_t inside = 1;
+        for (int p = 0; p < 6; p++) {
+            float distance = planes[p].x * centerX[i] + planes[p].y * centerY[i] + planes[p].z * centerZ[i] + planes[p].w;
+            float reach = std::fabs(planes[p].x) * extentX[i] + std::fabs(planes[p].y) * extentY[i] +
+                          std::fabs(planes[p].z) * extentZ[i];
+            if (distance < -reach) {
+                inside = 0;
+                break;
+            }
+        }
+        visible[i] = inside;
+    }
+}
+
+// R = Rx * Ry * Rz açık hali; sütun j, S'nin j. bileşeniyle ölçeklenir
+static void composeScalar(const float* positionX, const float* positionY, const float* positionZ,
+                          const float* rotationX, const float* rotationY, const float* rotationZ,
+                          const float* scaleX, const float* scaleY, const float* scaleZ,
+                          size_t count, glm::mat4* out) {
+    for (size_t i = 0; i < count; i++) {
+        float ca = std::cos(rotationX[i] * DEGREES_TO_RADIANS), sa = std::sin(rotationX[i] * DEGREES_TO_RADIANS);
+        float cb = std::cos(rotationY[i] * DEGREES_TO_RADIANS), sb = std::sin(rotationY[i] * DEGREES_TO_RADIANS);
+        float cc = std::cos(rotationZ[i] * DEGREES_TO_RADIANS), sc = std::sin(rotationZ[i] * DEGREES_TO_RADIANS);
+
+        glm::mat4& m = out[i];
+        m[0] = glm::vec4(cb * cc, ca * sc + sa * sb * cc, sa * sc - ca * sb * cc, 0.0f) * scaleX[i];
+        m[1] = glm::vec4(-cb * sc, ca * cc - sa * sb * sc, sa * cc + ca * sb * sc, 0.0f) * scaleY[i];
+        m[2] = glm::vec4(sb, -sa * cb, ca * cb, 0.0f) * scaleZ[i];
+        m[3] = glm::vec4(positionX[i], positionY[i], positionZ[i], 1.0f);
+    }
+}
+
+static void multiplyScalar(const glm::mat4* a, const glm::mat4* b, size_t count, glm::mat4* out) {
+    for (size_t i = 0; i < count; i++) {
+        out[i] = a[i] * b[i];
+    }
+}
+
+// Açıların sin/cos'u skaler hesaplanır; vektör yollar sadece matris kurulumunu paralel yapar
+static void sinCosDegrees(const float* degrees, size_t count, float* sines, float* cosines) {
+    for (size_t i = 0; i < count; i++) {
+        sines[i] = std::sin(degrees[i] * DEGREES_TO_RADIANS);
+        cosines[i] = std::cos(degrees[i] * DEGREES_TO_RADIANS);
+    }
+}
+
+#ifdef VM_SIMD_X86
+// ---------------------------------------------------------------------------
+// SSE (x86-64'te her zaman var)
+
+static void distancesSSE(const float* x, const float* y, const float* z, size_t count,
+                         const glm::vec3& point, float* out) {
+    __m128 px = _mm_set1_ps(point.x), py = _mm_set1_ps(point.y), pz = _mm_set1_ps(point.z);
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128 dx = _mm_sub_ps(_mm_loadu_ps(x + i), px);
+        __m128 dy = _mm_sub_ps(_mm_loadu_ps(y + i), py);
+        __m128 dz = _mm_sub_ps(_mm_loadu_ps(z + i), pz);
+        __m128 squared = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz));
+        _mm_storeu_ps(out + i, _mm_sqrt_ps(squared));
+    }
+    distancesScalar(x + i, y + i, z + i, count - i, point, out + i);
+}
+
+static void storeMask4(int mask, uint8_t* visible) {
+    for (int lane = 0; lane < 4; lane++) {
+        visible[lane] = static_cast<uint8_t>((mask >> lane) & 1);
+    }
+}
+
+static void spheresSSE(const float* x, const float* y, const float* z, const float* radius, size_t count,
+                       const glm::vec4* planes, uint8_t* visible) {
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128 cx = _mm_loadu_ps(x + i), cy = _mm_loadu_ps(y + i), cz = _mm_loadu_ps(z + i);
+        __m128 negativeRadius = _mm_sub_ps(_mm_setzero_ps(), _mm_loadu_ps(radius + i));
+        __m128 inside = _mm_castsi128_ps(_mm_set1_epi32(-1));
+        for (int p = 0; p < 6; p++) {
+            __m128 distance = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(planes[p].x), cx),
+                                                    _mm_mul_ps(_mm_set1_ps(planes[p].y), cy)),
+                                         _mm_add_ps(_mm_mul_ps(_mm_set1_ps(planes[p].z), cz), _mm_set1_ps(planes[p].w)));
+            inside = _mm_and_ps(inside, _mm_cmpge_ps(distance, negativeRadius));
+        }
+        storeMask4(_mm_movemask_ps(inside), visible + i);
+    }
+    spheresScalar(x + i, y + i, z + i, radius + i, count - i, planes, visible + i);
+}
+
+static void boxesSSE(const float* centerX, const float* centerY, const float* centerZ,
+                     const float* extentX, const float* extentY, const float* extentZ,
+                     size_t count, const glm::vec4* planes, uint8_t* visible) {
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128 cx = _mm_loadu_ps(centerX + i), cy = _mm_loadu_ps(centerY + i), cz = _mm_loadu_ps(centerZ + i);
+        __m128 ex = _mm_loadu_ps(extentX + i), ey = _mm_loadu_ps(extentY + i), ez = _mm_loadu_ps(extentZ + i);
+        __m128 inside = _mm_castsi128_ps(_mm_set1_epi32(-1));
+        for (int p = 0; p < 6; p++) {
+            __m128 distance = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(planes[p].x), cx),
+                                                    _mm_mul_ps(_mm_set1_ps(planes[p].y), cy)),
+                                         _mm_add_ps(_mm_mul_ps(_mm_set1_ps(planes[p].z), cz), _mm_set1_ps(planes[p].w)));
+            __m128 reach = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(std::fabs(planes[p].x)), ex),
+                                                 _mm_mul_ps(_mm_set1_ps(std::fabs(planes[p].y)), ey)),
+                                      _mm_mul_ps(_mm_set1_ps(std::fabs(planes[p].z)), ez));
+            inside = _mm_and_ps(inside, _mm_cmpge_ps(distance, _mm_sub_ps(_mm_setzero_ps(), reach)));
+        }
+        storeMask4(_mm_movemask_ps(inside), visible + i);
+    }
+    boxesScalar(centerX + i, centerY + i, centerZ + i, extentX + i, extentY + i, extentZ + i,
+                count - i, planes, visible + i);
+}
+
+// Dört nesnenin aynı sütununu (satırlar ayrı vektörlerde) her nesnenin matrisine yazar
+static inline void storeColumn4(__m128 row0, __m128 row1, __m128 row2, __m128 row3, glm::mat4* out, int column) {
+    _MM_TRANSPOSE4_PS(row0, row1, row2, row3);
+    _mm_storeu_ps(&out[0][column][0], row0);
+    _mm_storeu_ps(&out[1][column][0], row1);
+    _mm_storeu_ps(&out[2][column][0], row2);
+    _mm_storeu_ps(&out[3][column][0], row3);
+}
+
+static void composeSSE(const float* positionX, const float* positionY, const float* positionZ,
+                       const float* rotationX, const float* rotationY, const float* rotationZ,
+                       const float* scaleX, const float* scaleY, const float* scaleZ,
+                       size_t count, glm::mat4* out) {
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        float sines[3][4], cosines[3][4];
+        sinCosDegrees(rotationX + i, 4, sines[0], cosines[0]);
+        sinCosDegrees(rotationY + i, 4, sines[1], cosines[1]);
+        sinCosDegrees(rotationZ + i, 4, sines[2], cosines[2]);
+        __m128 sa = _mm_loadu_ps(sines[0]), ca = _mm_loadu_ps(cosines[0]);
+        __m128 sb = _mm_loadu_ps(sines[1]), cb = _mm_loadu_ps(cosines[1]);
+        __m128 sc = _mm_loadu_ps(sines[2]), cc = _mm_loadu_ps(cosines[2]);
+        __m128 sx = _mm_loadu_ps(scaleX + i), sy = _mm_loadu_ps(scaleY + i), sz = _mm_loadu_ps(scaleZ + i);
+        __m128 zero = _mm_setzero_ps();
+
+        __m128 sasb = _mm_mul_ps(sa, sb), casb = _mm_mul_ps(ca, sb);
+        storeColumn4(_mm_mul_ps(_mm_mul_ps(cb, cc), sx),
+                     _mm_mul_ps(_mm_add_ps(_mm_mul_ps(ca, sc), _mm_mul_ps(sasb, cc)), sx),
+                     _mm_mul_ps(_mm_sub_ps(_mm_mul_ps(sa, sc), _mm_mul_ps(casb, cc)), sx),
+                     zero, out + i, 0);
+        storeColumn4(_mm_mul_ps(_mm_sub_ps(zero, _mm_mul_ps(cb, sc)), sy),
+                     _mm_mul_ps(_mm_sub_ps(_mm_mul_ps(ca, cc), _mm_mul_ps(sasb, sc)), sy),
+                     _mm_mul_ps(_mm_add_ps(_mm_mul_ps(sa, cc), _mm_mul_ps(casb, sc)), sy),
+                     zero, out + i, 1);
+        storeColumn4(_mm_mul_ps(sb, sz),
+                     _mm_mul_ps(_mm_sub_ps(zero, _mm_mul_ps(sa, cb)), sz),
+                     _mm_mul_ps(_mm_mul_ps(ca, cb), sz),
+                     zero, out + i, 2);
+        storeColumn4(_mm_loadu_ps(positionX + i), _mm_loadu_ps(positionY + i), _mm_loadu_ps(positionZ + i),
+                     _mm_set1_ps(1.0f), out + i, 3);
+    }
+    composeScalar(positionX + i, positionY + i, positionZ + i, rotationX + i, rotationY + i, rotationZ + i,
+                  scaleX + i, scaleY + i, scaleZ + i, count - i, out + i);
+}
+
+// Sonuç sütunu j = a'nın sütunlarının b[j] bileşenleriyle doğrusal birleşimi
+static void multiplySSE(const glm::mat4* a, const glm::mat4* b, size_t count, glm::mat4* out) {
+    for (size_t i = 0; i < count; i++) {
+        const float* left = &a[i][0][0];
+        const float* right = &b[i][0][0];
+        __m128 a0 = _mm_loadu_ps(left), a1 = _mm_loadu_ps(left + 4);
+        __m128 a2 = _mm_loadu_ps(left + 8), a3 = _mm_loadu_ps(left + 12);
+        __m128 columns[4];
+        for (int j = 0; j < 4; j++) {
+            __m128 column = _mm_loadu_ps(right + j * 4);
+            columns[j] = _mm_add_ps(
+                _mm_add_ps(_mm_mul_ps(a0, _mm_shuffle_ps(column, column, 0x00)),
+                           _mm_mul_ps(a1, _mm_shuffle_ps(column, column, 0x55))),
+                _mm_add_ps(_mm_mul_ps(a2, _mm_shuffle_ps(column, column, 0xAA)),
+                           _mm_mul_ps(a3, _mm_shuffle_ps(column, column, 0xFF))));
+        }
+        float* result = &out[i][0][0];
+        for (int j = 0; j < 4; j++) {
+            _mm_storeu_ps(result + j * 4, columns[j]);
+        }
+    }
+}
+
+// ---------------------------------------------------------------------------
+// AVX2 + FMA, sekiz geniş
+
+VM_TARGET_AVX2 static void distancesAVX2(const float* x, const float* y, const float* z, size_t count,
+                                         const glm::vec3& point, float* out) {
+    __m256 px = _mm256_set1_ps(point.x), py = _mm256_set1_ps(point.y), pz = _mm256_set1_ps(point.z);
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256 dx = _mm256_sub_ps(_mm256_loadu_ps(x + i), px);
+        __m256 dy = _mm256_sub_ps(_mm256_loadu_ps(y + i), py);
+        __m256 dz = _mm256_sub_ps(_mm256_loadu_ps(z + i), pz);
+        __m256 squared = _mm256_fmadd_ps(dz, dz, _mm256_fmadd_ps(dy, dy, _mm256_mul_ps(dx, dx)));
+        _mm256_storeu_ps(out + i, _mm256_sqrt_ps(squared));
+    }
+    distancesSSE(x + i, y + i, z + i, count - i, point, out + i);
+}
+
+static void storeMask8(int mask, uint8_t* visible) {
+    for (int lane = 0; lane < 8; lane++) {
+        visible[lane] = static_cast<uint8_t>((mask >> lane) & 1);
+    }
+}
+
+VM_TARGET_AVX2 static void spheresAVX2(const float* x, const float* y, const float* z, const float* radius,
+                                       size_t count, const glm::vec4* planes, uint8_t* visible) {
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256 cx = _mm256_loadu_ps(x + i), cy = _mm256_loadu_ps(y + i), cz = _mm256_loadu_ps(z + i);
+        __m256 negativeRadius = _mm256_sub_ps(_mm256_setzero_ps(), _mm256_loadu_ps(radius + i));
+        __m256 inside = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+        for (int p = 0; p < 6; p++) {
+            __m256 distance = _mm256_fmadd_ps(_mm256_set1_ps(planes[p].x), cx,
+                              _mm256_fmadd_ps(_mm256_set1_ps(planes[p].y), cy,
+                              _mm256_fmadd_ps(_mm256_set1_ps(planes[p].z), cz, _mm256_set1_ps(planes[p].w))));
+            inside = _mm256_and_ps(inside, _mm256_cmp_ps(distance, negativeRadius, _CMP_GE_OQ));
+        }
+        storeMask8(_mm256_movemask_ps(inside), visible + i);
+    }
+    spheresSSE(x + i, y + i, z + i, radius + i, count - i, planes, visible + i);
+}
+
+VM_TARGET_AVX2 static void boxesAVX2(const float* centerX, const float* centerY, const float* centerZ,
+                                     const float* extentX, const float* extentY, const float* extentZ,
+                                     size_t count, const glm::vec4* planes, uint8_t* visible) {
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256 cx = _mm256_loadu_ps(centerX + i), cy = _mm256_loadu_ps(centerY + i), cz = _mm256_loadu_ps(centerZ + i);
+        __m256 ex = _mm256_loadu_ps(extentX + i), ey = _mm256_loadu_ps(extentY + i), ez = _mm256_loadu_ps(extentZ + i);
+        __m256 inside = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+        for (int p = 0; p < 6; p++) {
+            __m256 distance = _mm256_fmadd_ps(_mm256_set1_ps(planes[p].x), cx,
+                              _mm256_fmadd_ps(_mm256_set1_ps(planes[p].y), cy,
+                              _mm256_fmadd_ps(_mm256_set1_ps(planes[p].z), cz, _mm256_set1_ps(planes[p].w))));
+            __m256 reach = _mm256_fmadd_ps(_mm256_set1_ps(std::fabs(planes[p].x)), ex,
+                           _mm256_fmadd_ps(_mm256_set1_ps(std::fabs(planes[p].y)), ey,
+                           _mm256_mul_ps(_mm256_set1_ps(std::fabs(planes[p].z)), ez)));
+            inside = _mm256_and_ps(inside, _mm256_cmp_ps(distance, _mm256_sub_ps(_mm256_setzero_ps(), reach), _CMP_GE_OQ));
+        }
+        storeMask8(_mm256_movemask_ps(inside), visible + i);
+    }
+    boxesSSE(centerX + i, centerY + i, centerZ + i, extentX + i, extentY + i, extentZ + i,
+             count - i, planes, visible + i);
+}
+
+// Sekiz nesnenin bir sütunu; iki yarı ayrı ayrı transpoze edilip yazılır
+VM_TARGET_AVX2 static inline void storeColumn8(__m256 row0, __m256 row1, __m256 row2, __m256 row3,
+                                               glm::mat4* out, int column) {
+    storeColumn4(_mm256_castps256_ps128(row0), _mm256_castps256_ps128(row1),
+                 _mm256_castps256_ps128(row2), _mm256_castps256_ps128(row3), out, column);
+    storeColumn4(_mm256_extractf128_ps(row0, 1), _mm256_extractf128_ps(row1, 1),
+                 _mm256_extractf128_ps(row2, 1), _mm256_extractf128_ps(row3, 1), out + 4, column);
+}
+
+VM_TARGET_AVX2 static void composeAVX2(const float* positionX, const float* positionY, const float* positionZ,
+                                       const float* rotationX, const float* rotationY, const float* rotationZ,
+                                       const float* scaleX, const float* scaleY, const float* scaleZ,
+                                       size_t count, glm::mat4* out) {
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        float sines[3][8], cosines[3][8];
+        sinCosDegrees(rotationX + i, 8, sines[0], cosines[0]);
+        sinCosDegrees(rotationY + i, 8, sines[1], cosines[1]);
+        sinCosDegrees(rotationZ + i, 8, sines[2], cosines[2]);
+        __m256 sa = _mm256_loadu_ps(sines[0]), ca = _mm256_loadu_ps(cosines[0]);
+        __m256 sb = _mm256_loadu_ps(sines[1]), cb = _mm256_loadu_ps(cosines[1]);
+        __m256 sc = _mm256_loadu_ps(sines[2]), cc = _mm256_loadu_ps(cosines[2]);
+        __m256 sx = _mm256_loadu_ps(scaleX + i), sy = _mm256_loadu_ps(scaleY + i), sz = _mm256_loadu_ps(scaleZ + i);
+        __m256 zero = _mm256_setzero_ps();
+
+        __m256 sasb = _mm256_mul_ps(sa, sb), casb = _mm256_mul_ps(ca, sb);
+        storeColumn8(_mm256_mul_ps(_mm256_mul_ps(cb, cc), sx),
+                     _mm256_mul_ps(_mm256_fmadd_ps(sasb, cc, _mm256_mul_ps(ca, sc)), sx),
+                     _mm256_mul_ps(_mm256_fnmadd_ps(casb, cc, _mm256_mul_ps(sa, sc)), sx),
+                     zero, out + i, 0);
+        storeColumn8(_mm256_mul_ps(_mm256_sub_ps(zero, _mm256_mul_ps(cb, sc)), sy),
+                     _mm256_mul_ps(_mm256_fnmadd_ps(sasb, sc, _mm256_mul_ps(ca, cc)), sy),
+                     _mm256_mul_ps(_mm256_fmadd_ps(casb, sc, _mm256_mul_ps(sa, cc)), sy),
+                     zero, out + i, 1);
+        storeColumn8(_mm256_mul_ps(sb, sz),
+                     _mm256_mul_ps(_mm256_sub_ps(zero, _mm256_mul_ps(sa, cb)), sz),
+                     _mm256_mul_ps(_mm256_mul_ps(ca, cb), sz),
+                     zero, out + i, 2);
+        storeColumn8(_mm256_loadu_ps(positionX + i), _mm256_loadu_ps(positionY + i), _mm256_loadu_ps(positionZ + i),
+                     _mm256_set1_ps(1.0f), out + i, 3);
+    }
+    composeSSE(positionX + i, positionY + i, positionZ + i, rotationX + i, rotationY + i, rotationZ + i,
+               scaleX + i, scaleY + i, scaleZ + i, count - i, out + i);
+}
+
+// İki sonuç sütunu birden: b[j] ve b[j+1] tek 256 bit yüklemede, her yarıda kendi bileşeni yayılır
+VM_TARGET_AVX2 static void multiplyAVX2(const glm::mat4* a, const glm::mat4* b, size_t count, glm::mat4* out) {
+    for (size_t i = 0; i < count; i++) {
+        const float* left = &a[i][0][0];
+        const float* right = &b[i][0][0];
+        __m256 a0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(left));
+        __m256 a1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(left + 4));
+        __m256 a2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(left + 8));
+        __m256 a3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(left + 12));
+        __m256 low = _mm256_loadu_ps(right);
+        __m256 high = _mm256_loadu_ps(right + 8);
+
+        __m256 resultLow = _mm256_mul_ps(a0, _mm256_permute_ps(low, 0x00));
+        resultLow = _mm256_fmadd_ps(a1, _mm256_permute_ps(low, 0x55), resultLow);
+        resultLow = _mm256_fmadd_ps(a2, _mm256_permute_ps(low, 0xAA), resultLow);
+        resultLow = _mm256_fmadd_ps(a3, _mm256_permute_ps(low, 0xFF), resultLow);
+        __m256 resultHigh = _mm256_mul_ps(a0, _mm256_permute_ps(high, 0x00));
+        resultHigh = _mm256_fmadd_ps(a1, _mm256_permute_ps(high, 0x55), resultHigh);
+        resultHigh = _mm256_fmadd_ps(a2, _mm256_permute_ps(high, 0xAA), resultHigh);
+        resultHigh = _mm256_fmadd_ps(a3, _mm256_permute_ps(high, 0xFF), resultHigh);
+
+        float* result = &out[i][0][0];
+        _mm256_storeu_ps(result, resultLow);
+        _mm256_storeu_ps(result + 8, resultHigh);
+    }
+}
+#endif
+
+#ifdef VM_SIMD_NEON
+// ---------------------------------------------------------------------------
+// AArch64 NEON, dört geniş
+
+static void distancesNEON(const float* x, const float* y, const float* z, size_t count,
+                          const glm::vec3& point, float* out) {
+    float32x4_t px = vdupq_n_f32(point.x), py = vdupq_n_f32(point.y), pz = vdupq_n_f32(point.z);
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        float32x4_t dx = vsubq_f32(vld1q_f32(x + i), px);
+        float32x4_t dy = vsubq_f32(vld1q_f32(y + i), py);
+        float32x4_t dz = vsubq_f32(vld1q_f32(z + i), pz);
+        float32x4_t squared = vfmaq_f32(vfmaq_f32(vmulq_f32(dx, dx), dy, dy), dz, dz);
+        vst1q_f32(out + i, vsqrtq_f32(squared));
+    }
+    distancesScalar(x + i, y + i, z + i, count - i, point, out + i);
+}
+
+static void storeMaskNEON(uint32x4_t mask, uint8_t* visible) {
+    uint32_t lanes[4];
+    vst1q_u32(lanes, mask);
+    for (int lane = 0; lane < 4; lane++) {
+        visible[lane] = lanes[lane] ? 1 : 0;
+    }
+}
+
+static void spheresNEON(const float* x, const float* y, const float* z, const float* radius, size_t count,
+                        const glm::vec4* planes, uint8_t* visible) {
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        float32x4_t cx = vld1q_f32(x + i), cy = vld1q_f32(y + i), cz = vld1q_f32(z + i);
+        float32x4_t negativeRadius = vnegq_f32(vld1q_f32(radius + i));
+        uint32x4_t inside = vdupq_n_u32(0xFFFFFFFFu);
+        for (int p = 0; p < 6; p++) {
+            float32x4_t distance = vdupq_n_f32(planes[p].w);
+            distance = vfmaq_n_f32(distance, cx, planes[p].x);
+            distance = vfmaq_n_f32(distance, cy, planes[p].y);
+            distance = vfmaq_n_f32(distance, cz, planes[p].z);
+            inside = vandq_u32(inside, vcgeq_f32(distance, negativeRadius));
+        }
+        storeMaskNEON(inside, visible + i);
+    }
+    spheresScalar(x + i, y + i, z + i, radius + i, count - i, planes, visible + i);
+}
+
+static void boxesNEON(const float* centerX, const float* centerY, const float* centerZ,
+                      const float* extentX, const float* extentY, const float* extentZ,
+                      size_t count, const glm::vec4* planes, uint8_t* visible) {
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        float32x4_t cx = vld1q_f32(centerX + i), cy = vld1q_f32(centerY + i), cz = vld1q_f32(centerZ + i);
+        float32x4_t ex = vld1q_f32(extentX + i), ey = vld1q_f32(extentY + i), ez = vld1q_f32(extentZ + i);
+        uint32x4_t inside = vdupq_n_u32(0xFFFFFFFFu);
+        for (int p = 0; p < 6; p++) {
+            float32x4_t distance = vdupq_n_f32(planes[p].w);
+            distance = vfmaq_n_f32(distance, cx, planes[p].x);
+            distance = vfmaq_n_f32(distance, cy, planes[p].y);
+            distance = vfmaq_n_f32(distance, cz, planes[p].z);
+            float32x4_t reach = vmulq_n_f32(ex, std::fabs(planes[p].x));
+            reach = vfmaq_n_f32(reach, ey, std::fabs(planes[p].y));
+            reach = vfmaq_n_f32(reach, ez, std::fabs(planes[p].z));
+            inside = vandq_u32(inside, vcgeq_f32(distance, vnegq_f32(reach)));
+        }
+        storeMaskNEON(inside, visible + i);
+    }
+    boxesScalar(centerX + i, centerY + i, centerZ + i, extentX + i, extentY + i, extentZ + i,
+                count - i, planes, visible + i);
+}
+
+static void multiplyNEON(const glm::mat4* a, const glm::mat4* b, size_t count, glm::mat4* out) {
+    for (size_t i = 0; i < count; i++) {
+        const float* left = &a[i][0][0];
+        const float* right = &b[i][0][0];
+        float32x4_t a0 = vld1q_f32(left), a1 = vld1q_f32(left + 4);
+        float32x4_t a2 = vld1q_f32(left + 8), a3 = vld1q_f32(left + 12);
+        float32x4_t columns[4];
+        for (int j = 0; j < 4; j++) {
+            float32x4_t column = vld1q_f32(right + j * 4);
+            float32x4_t result = vmulq_laneq_f32(a0, column, 0);
+            result = vfmaq_laneq_f32(result, a1, column, 1);
+            result = vfmaq_laneq_f32(result, a2, column, 2);
+            result = vfmaq_laneq_f32(result, a3, column, 3);
+            columns[j] = result;
+        }
+        float* result = &out[i][0][0];
+        for (int j = 0; j < 4; j++) {
+            vst1q_f32(result + j * 4, columns[j]);
+        }
+    }
+}
+#endif
+
+// ---------------------------------------------------------------------------
+// Seçim
+
+static KernelTable tables[SimdKernels::PATH_COUNT];
+static bool supported[SimdKernels::PATH_COUNT];
+static std::atomic<int> currentPath(-1);
+
+static bool detectAVX2() {
+#ifdef VM_SIMD_X86
+#if defined(_MSC_VER) && !defined(__clang__)
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] < 7) return false;
+    __cpuid(info, 1);
+    bool osxsave = (info[2] & (1 << 27)) != 0;
+    bool fma = (info[2] & (1 << 12)) != 0;
+    if (!osxsave || !fma) return false;
+    // İşletim sistemi YMM yazmaçlarını kaydediyor mu
+    if ((_xgetbv(0) & 0x6) != 0x6) return false;
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) != 0;
+#else
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+#endif
+#else
+    return false;
+#endif
+}
+
+void SimdKernels::initialize() {
+    if (currentPath.load() >= 0) return;
+
+    KernelTable scalar = { distancesScalar, spheresScalar, boxesScalar, composeScalar, multiplyScalar };
+    for (int path = 0; path < PATH_COUNT; path++) {
+        tables[path] = scalar;
+        supported[path] = false;
+    }
+    supported[PATH_SCALAR] = true;
+    Path best = PATH_SCALAR;
+
+#ifdef VM_SIMD_X86
+    tables[PATH_SSE] = { distancesSSE, spheresSSE, boxesSSE, composeSSE, multiplySSE };
+    supported[PATH_SSE] = true;
+    best = PATH_SSE;
+    if (detectAVX2()) {
+        tables[PATH_AVX2] = { distancesAVX2, spheresAVX2, boxesAVX2, composeAVX2, multiplyAVX2 };
+        supported[PATH_AVX2] = true;
+        best = PATH_AVX2;
+    }
+#endif
+#ifdef VM_SIMD_NEON
+    // TRS kurulumu NEON'da skaler kalır
+    tables[PATH_NEON] = { distancesNEON, spheresNEON, boxesNEON, composeScalar, multiplyNEON };
+    supported[PATH_NEON] = true;
+    best = PATH_NEON;
+#endif
+
+    const char* requested = std::getenv("VM_SIMD");
+    if (requested) {
+        bool found = false;
+        for (int path = 0; path < PATH_COUNT; path++) {
+            if (std::strcmp(requested, getPathName(static_cast<Path>(path))) == 0) {
+                found = true;
+                if (supported[path]) {
+                    best = static_cast<Path>(path);
+                } else {
+                    std::cerr << "VM_SIMD=" << requested << " bu işlemcide desteklenmiyor" << std::endl;
+                }
+            }
+        }
+        if (!found) {
+            std::cerr << "Bilinmeyen VM_SIMD değeri: " << requested << std::endl;
+        }
+    }
+    currentPath = best;
+}
+
+SimdKernels::Path SimdKernels::getPath() {
+    initialize();
+    return static_cast<Path>(currentPath.load());
+}
+
+const char* SimdKernels::getPathName(Path path) {
+    static const char* NAMES[PATH_COUNT] = { "scalar", "sse", "avx2", "neon" };
+    return path >= 0 && path < PATH_COUNT ? NAMES[path] : "?";
+}
+
+bool SimdKernels::isSupported(Path path) {
+    initialize();
+    return path >= 0 && path < PATH_COUNT && supported[path];
+}
+
+bool SimdKernels::setPath(Path path) {
+    if (!isSupported(path)) return false;
+    currentPath = path;
+    return true;
+}
+
+static const KernelTable& activeTable() {
+    return tables[SimdKernels::getPath()];
+}
+
+void SimdKernels::distances(const float* x, const float* y, const float* z, size_t count,
+                            const glm::vec3& point, float* out) {
+    activeTable().distances(x, y, z, count, point, out);
+}
+
+void SimdKernels::spheresInFrustum(const float* x, const float* y, const float* z, const float* radius,
+                                   size_t count, const glm::vec4 planes[6], uint8_t* visible) {
+    activeTable().spheres(x, y, z, radius, count, planes, visible);
+}
+
+void SimdKernels::boxesInFrustum(const float* centerX, const float* centerY, const float* centerZ,
+                                 const float* extentX, const float* extentY, const float* extentZ,
+                                 size_t count, const glm::vec4 planes[6], uint8_t* visible) {
+    activeTable().boxes(centerX, centerY, centerZ, extentX, extentY, extentZ, count, planes, visible);
+}
+
+void SimdKernels::composeTRS(const float* positionX, const float* positionY, const float* positionZ,
+                             const float* rotationX, const float* rotationY, const float* rotationZ,
+                             const float* scaleX, const float* scaleY, const float* scaleZ,
+                             size_t count, glm::mat4* out) {
+    activeTable().compose(positionX, positionY, positionZ, rotationX, rotationY, rotationZ,
+                          scaleX, scaleY, scaleZ, count, out);
+}
+
+void SimdKernels::multiply(const glm::mat4* a, const glm::mat4* b, size_t count, glm::mat4* out) {
+    activeTable().multiply(a, b, count, out);
+}
+
+void SimdKernels::extractFrustumPlanes(const glm::mat4& viewProjection, glm::vec4 planes[6]) {
+    glm::vec4 rows[4];
+    for (int row = 0; row < 4; row++) {
+        rows[row] = glm::vec4(viewProjection[0][row], viewProjection[1][row], viewProjection[2][row], viewProjection[3][row]);
+    }
+    planes[0] = rows[3] + rows[0];  // sol
+    planes[1] = rows[3] - rows[0];  // sağ
+    planes[2] = rows[3] + rows[1];  // alt
+    planes[3] = rows[3] - rows[1];  // üst
+    planes[4] = rows[3] + rows[2];  // yakın
+    planes[5] = rows[3] - rows[2];  // uzak
+    for (int p = 0; p < 6; p++) {
+        planes[p] /= glm::length(glm::vec3(planes[p]));
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Doğrulama ve ölçüm
+
+static double elapsedSeconds(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+static float matrixError(const glm::mat4& a, const glm::mat4& b) {
+    float error = 0.0f;
+    for (int column = 0; column < 4; column++) {
+        for (int row = 0; row < 4; row++) {
+            error = std::max(error, std::fabs(a[column][row] - b[column][row]));
+        }
+    }
+    return error;
+}
+
+// Optimize edici sonucu atmasın diye ölçülen çıktılar buraya katlanır
+static volatile float benchmarkSink;
+
+bool SimdKernels::runBenchmarks() {
+    initialize();
+    Path original = getPath();
+
+    // Tek sayı seçildi ki vektör yolların kalan kısmı da sınansın
+    const size_t COUNT = 100003;
+    const int REPEAT = 50;
+
+    std::mt19937 random(12345);
+    std::uniform_real_distribution<float> position(-100.0f, 100.0f);
+    std::uniform_real_distribution<float> angle(-180.0f, 180.0f);
+    std::uniform_real_distribution<float> size(0.1f, 4.0f);
+
+    std::vector<float> x(COUNT), y(COUNT), z(COUNT), rx(COUNT), ry(COUNT), rz(COUNT), sx(COUNT), sy(COUNT), sz(COUNT);
+    for (size_t i = 0; i < COUNT; i++) {
+        x[i] = position(random); y[i] = position(random); z[i] = position(random);
+        rx[i] = angle(random); ry[i] = angle(random); rz[i] = angle(random);
+        sx[i] = size(random); sy[i] = size(random); sz[i] = size(random);
+    }
+    glm::vec3 point(3.0f, -2.0f, 7.0f);
+
+    glm::mat4 viewProjection = glm::perspective(glm::radians(60.0f), 16.0f / 9.0f, 0.1f, 150.0f) *
+                               glm::lookAt(glm::vec3(0.0f, 0.0f, 0.0f), glm::vec3(1.0f, 0.2f, 0.5f), glm::vec3(0.0f, 1.0f, 0.0f));
+    glm::vec4 planes[6];
+    extractFrustumPlanes(viewProjection, planes);
+
+    // glm ile referans sonuçlar
+    std::vector<float> referenceDistances(COUNT);
+    std::vector<uint8_t> referenceSpheres(COUNT), referenceBoxes(COUNT);
+    std::vector<glm::mat4> referenceMatrices(COUNT), referenceProducts(COUNT);
+    for (size_t i = 0; i < COUNT; i++) {
+        glm::vec3 center(x[i], y[i], z[i]);
+        referenceDistances[i] = glm::distance(center, point);
+
+        bool sphereInside = true, boxInside = true;
+        for (int p = 0; p < 6; p++) {
+            glm::vec3 normal(planes[p]);
+            float distance = glm::dot(normal, center) + planes[p].w;
+            if (distance < -sx[i]) sphereInside = false;
+            float reach = glm::dot(glm::abs(normal), glm::vec3(sx[i], sy[i], sz[i]));
+            if (distance < -reach) boxInside = false;
+        }
+        referenceSpheres[i] = sphereInside ? 1 : 0;
+        referenceBoxes[i] = boxInside ? 1 : 0;
+
+        glm::mat4 model = glm::translate(glm::mat4(1.0f), center);
+        model = glm::rotate(model, glm::radians(rx[i]), glm::vec3(1.0f, 0.0f, 0.0f));
+        model = glm::rotate(model, glm::radians(ry[i]), glm::vec3(0.0f, 1.0f, 0.0f));
+        model = glm::rotate(model, glm::radians(rz[i]), glm::vec3(0.0f, 0.0f, 1.0f));
+        referenceMatrices[i] = glm::scale(model, glm::vec3(sx[i], sy[i], sz[i]));
+    }
+    for (size_t i = 0; i < COUNT; i++) {
+        referenceProducts[i] = referenceMatrices[i] * referenceMatrices[(i + 1) % COUNT];
+    }
+    std::vector<glm::mat4> rightMatrices(COUNT);
+    for (size_t i = 0; i < COUNT; i++) {
+        rightMatrices[i] = referenceMatrices[(i + 1) % COUNT];
+    }
+
+    std::vector<float> distanceOut(COUNT);
+    std::vector<uint8_t> visibleOut(COUNT);
+    std::vector<glm::mat4> matrixOut(COUNT);
+
+    std::cout << "SIMD çekirdekleri: " << COUNT << " öğe, " << REPEAT << " tekrar, seçili yol "
+              << getPathName(original) << std::endl;
+
+    double scalarTimes[5] = {};
+    bool allValid = true;
+    for (int pathIndex = 0; pathIndex < PATH_COUNT; pathIndex++) {
+        Path path = static_cast<Path>(pathIndex);
+        if (!setPath(path)) continue;
+
+        // Doğruluk
+        distances(x.data(), y.data(), z.data(), COUNT, point, distanceOut.data());
+        float distanceError = 0.0f;
+        for (size_t i = 0; i < COUNT; i++) {
+            distanceError = std::max(distanceError, std::fabs(distanceOut[i] - referenceDistances[i]) /
+                                                    std::max(1.0f, referenceDistances[i]));
+        }
+
+        spheresInFrustum(x.data(), y.data(), z.data(), sx.data(), COUNT, planes, visibleOut.data());
+        size_t sphereMismatches = 0;
+        for (size_t i = 0; i < COUNT; i++) sphereMismatches += visibleOut[i] != referenceSpheres[i];
+
+        boxesInFrustum(x.data(), y.data(), z.data(), sx.data(), sy.data(), sz.data(), COUNT, planes, visibleOut.data());
+        size_t boxMismatches = 0;
+        for (size_t i = 0; i < COUNT; i++) boxMismatches += visibleOut[i] != referenceBoxes[i];
+
+        composeTRS(x.data(), y.data(), z.data(), rx.data(), ry.data(), rz.data(), sx.data(), sy.data(), sz.data(),
+                   COUNT, matrixOut.data());
+        float composeError = 0.0f;
+        for (size_t i = 0; i < COUNT; i++) {
+            composeError = std::max(composeError, matrixError(matrixOut[i], referenceMatrices[i]) /
+                                                  std::max(1.0f, std::fabs(referenceMatrices[i][3][0]) + 1.0f));
+        }
+
+        multiply(referenceMatrices.data(), rightMatrices.data(), COUNT, matrixOut.data());
+        float multiplyError = 0.0f;
+        for (size_t i = 0; i < COUNT; i++) {
+            float magnitude = 1.0f;
+            for (int column = 0; column < 4; column++) {
+                magnitude = std::max(magnitude, std::fabs(referenceProducts[i][column][0]));
+            }
+            multiplyError = std::max(multiplyError, matrixError(matrixOut[i], referenceProducts[i]) / magnitude);
+        }
+
+        // Eşik üstündeki nesnelerde düzleme teğet olanlar yuvarlama yüzünden farklı çıkabilir
+        bool valid = distanceError < 1e-5f && composeError < 1e-4f && multiplyError < 1e-4f &&
+                     sphereMismatches <= COUNT / 10000 && boxMismatches <= COUNT / 10000;
+        std::cout << "[" << getPathName(path) << "] doğruluk " << (valid ? "TAMAM" : "HATA")
+                  << ": mesafe " << distanceError << ", küre farkı " << sphereMismatches
+                  << ", kutu farkı " << boxMismatches << ", TRS " << composeError
+                  << ", çarpım " << multiplyError << std::endl;
+        allValid = allValid && valid;
+
+        // Hız
+        double times[5];
+        auto start = std::chrono::steady_clock::now();
+        for (int r = 0; r < REPEAT; r++) distances(x.data(), y.data(), z.data(), COUNT, point, distanceOut.data());
+        times[0] = elapsedSeconds(start);
+        benchmarkSink = distanceOut[COUNT / 2];
+
+        start = std::chrono::steady_clock::now();
+        for (int r = 0; r < REPEAT; r++) spheresInFrustum(x.data(), y.data(), z.data(), sx.data(), COUNT, planes, visibleOut.data());
+        times[1] = elapsedSeconds(start);
+        benchmarkSink = visibleOut[COUNT / 2];
+
+        start = std::chrono::steady_clock::now();
+        for (int r = 0; r < REPEAT; r++) {
+            boxesInFrustum(x.data(), y.data(), z.data(), sx.data(), sy.data(), sz.data(), COUNT, planes, visibleOut.data());
+        }
+        times[2] = elapsedSeconds(start);
+        benchmarkSink = visibleOut[COUNT / 2];
+
+        start = std::chrono::steady_clock::now();
+        for (int r = 0; r < REPEAT; r++) {
+            composeTRS(x.data(), y.data(), z.data(), rx.data(), ry.data(), rz.data(), sx.data(), sy.data(), sz.data(),
+                       COUNT, matrixOut.data());
+        }
+        times[3] = elapsedSeconds(start);
+        benchmarkSink = matrixOut[COUNT / 2][3][0];
+
+        start = std::chrono::steady_clock::now();
+        for (int r = 0; r < REPEAT; r++) multiply(referenceMatrices.data(), rightMatrices.data(), COUNT, matrixOut.data());
+        times[4] = elapsedSeconds(start);
+        benchmarkSink = matrixOut[COUNT / 2][3][0];
+
+        static const char* KERNEL_NAMES[5] = { "mesafe", "küre-frustum", "kutu-frustum", "TRS", "4x4 çarpım" };
+        for (int kernel = 0; kernel < 5; kernel++) {
+            if (path == PATH_SCALAR) scalarTimes[kernel] = times[kernel];
+            double perItem = times[kernel] * 1e9 / (static_cast<double>(COUNT) * REPEAT);
+            std::cout << "    " << KERNEL_NAMES[kernel] << ": " << perItem << " ns/öğe";
+            if (path != PATH_SCALAR && scalarTimes[kernel] > 0.0) {
+                std::cout << " (skalere göre " << scalarTimes[kernel] / times[kernel] << "x)";
+            }
+            std::cout << std::endl;
+        }
+    }
+
+    setPath(original);
+    return allValid;
+}
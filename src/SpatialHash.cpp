@@ -0,0 +1,240 @@
+#include "../include/SpatialHash.hpp"
+#include <algorithm>
+#include <climits>
+#include <cmath>
+
+SpatialHash::SpatialHash(float cellSize)
+    : cellSize(cellSize > 0.0f ? cellSize : 1.0f), version(0),
+      minCellX(INT_MAX), maxCellX(INT_MIN), minCellZ(INT_MAX), maxCellZ(INT_MIN), currentStamp(0) {
+    inverseCellSize = 1.0f / this->cellSize;
+}
+
+int SpatialHash::cellCoordinate(float value) const {
+    return static_cast<int>(std::floor(value * inverseCellSize));
+}
+
+int64_t SpatialHash::cellKey(int x, int z) {
+    return static_cast<int64_t>((static_cast<uint64_t>(static_cast<uint32_t>(x)) << 32) | static_cast<uint32_t>(z));
+}
+
+SpatialHash::Handle SpatialHash::insert(const glm::vec3& position, float radius) {
+    Handle handle;
+    if (!freeList.empty()) {
+        handle = freeList.back();
+        freeList.pop_back();
+        positions[handle] = position;
+        radii[handle] = radius;
+        alive[handle] = 1;
+    } else {
+        handle = static_cast<Handle>(positions.size());
+        positions.push_back(position);
+        radii.push_back(radius);
+        alive.push_back(1);
+        visitStamps.push_back(0);
+    }
+    addToCells(handle);
+    version++;
+    return handle;
+}
+
+void SpatialHash::update(Handle handle, const glm::vec3& position) {
+    if (positions[handle] == position) return;
+    removeFromCells(handle);
+    positions[handle] = position;
+    addToCells(handle);
+    version++;
+}
+
+void SpatialHash::remove(Handle handle) {
+    if (!alive[handle]) return;
+    removeFromCells(handle);
+    alive[handle] = 0;
+    freeList.push_back(handle);
+    version++;
+}
+
+void SpatialHash::clear() {
+    positions.clear();
+    radii.clear();
+    alive.clear();
+    freeList.clear();
+    visitStamps.clear();
+    cells.clear();
+    minCellX = minCellZ = INT_MAX;
+    maxCellX = maxCellZ = INT_MIN;
+    version++;
+}
+
+// Öğe, merkezinin hücresine ve yarıçap karesinin değdiği tüm hücrelere yazılır
+void SpatialHash::addToCells(Handle handle) {
+    const glm::vec3& position = positions[handle];
+    float radius = radii[handle];
+    int x0 = cellCoordinate(position.x - radius), x1 = cellCoordinate(position.x + radius);
+    int z0 = cellCoordinate(position.z - radius), z1 = cellCoordinate(position.z + radius);
+    for (int x = x0; x <= x1; x++) {
+        for (int z = z0; z <= z1; z++) {
+            cells[cellKey(x, z)].push_back(handle);
+        }
+    }
+    minCellX = std::min(minCellX, x0);
+    maxCellX = std::max(maxCellX, x1);
+    minCellZ = std::min(minCellZ, z0);
+    maxCellZ = std::max(maxCellZ, z1);
+}
+
+void SpatialHash::removeFromCells(Handle handle) {
+    const glm::vec3& position = positions[handle];
+    float radius = radii[handle];
+    int x0 = cellCoordinate(position.x - radius), x1 = cellCoordinate(position.x + radius);
+    int z0 = cellCoordinate(position.z - radius), z1 = cellCoordinate(position.z + radius);
+    for (int x = x0; x <= x1; x++) {
+        for (int z = z0; z <= z1; z++) {
+            auto cell = cells.find(cellKey(x, z));
+            if (cell == cells.end()) continue;
+            std::vector<Handle>& handles = cell->second;
+            handles.erase(std::remove(handles.begin(), handles.end(), handle), handles.end());
+            if (handles.empty()) {
+                cells.erase(cell);
+            }
+        }
+    }
+}
+
+uint32_t SpatialHash::nextStamp() const {
+    // Sayaç taşarsa eski damgalar yeni sorguyla karışmasın
+    if (++currentStamp == 0) {
+        std::fill(visitStamps.begin(), visitStamps.end(), 0);
+        currentStamp = 1;
+    }
+    return currentStamp;
+}
+
+bool SpatialHash::visit(Handle handle) const {
+    if (visitStamps[handle] == currentStamp) return false;
+    visitStamps[handle] = currentStamp;
+    return true;
+}
+
+SpatialHash::Handle SpatialHash::nearestWithin(const glm::vec3& point, float maxDistance) const {
+    if (cells.empty()) return INVALID_HANDLE;
+
+    int x0 = std::max(cellCoordinate(point.x - maxDistance), minCellX);
+    int x1 = std::min(cellCoordinate(point.x + maxDistance), maxCellX);
+    int z0 = std::max(cellCoordinate(point.z - maxDistance), minCellZ);
+    int z1 = std::min(cellCoordinate(point.z + maxDistance), maxCellZ);
+
+    nextStamp();
+    Handle nearest = INVALID_HANDLE;
+    float nearestDistance = maxDistance;
+    for (int x = x0; x <= x1; x++) {
+        for (int z = z0; z <= z1; z++) {
+            auto cell = cells.find(cellKey(x, z));
+            if (cell == cells.end()) continue;
+            for (Handle handle : cell->second) {
+                if (!visit(handle)) continue;
+                float distance = glm::distance(point, positions[handle]);
+                if (distance < nearestDistance) {
+                    nearestDistance = distance;
+                    nearest = handle;
+                }
+            }
+        }
+    }
+    return nearest;
+}
+
+// Merkez hücreden dışa doğru halka halka aranır. Her öğe merkezinin hücresinde de
+// bulunduğu için r. halka bittiğinde bulunmamış öğeler en az r * cellSize uzaktadır.
+void SpatialHash::kNearest(const glm::vec3& point, int k, float maxDistance, std::vector<Handle>& result) const {
+    result.clear();
+    if (k <= 0 || cells.empty()) return;
+
+    std::vector<std::pair<float, Handle>> best;
+    best.reserve(k + 1);
+
+    int centerX = cellCoordinate(point.x);
+    int centerZ = cellCoordinate(point.z);
+    int maxRing = std::max(std::max(centerX - minCellX, maxCellX - centerX),
+                           std::max(centerZ - minCellZ, maxCellZ - centerZ));
+    float distanceRings = std::ceil(maxDistance * inverseCellSize) + 1.0f;
+    if (distanceRings < static_cast<float>(maxRing)) {
+        maxRing = static_cast<int>(distanceRings);
+    }
+
+    nextStamp();
+    auto visitCell = [&](int x, int z) {
+        if (x < minCellX || x > maxCellX || z < minCellZ || z > maxCellZ) return;
+        auto cell = cells.find(cellKey(x, z));
+        if (cell == cells.end()) return;
+        for (Handle handle : cell->second) {
+            if (!visit(handle)) continue;
+            float distance = glm::distance(point, positions[handle]);
+            if (distance >= maxDistance) continue;
+            if (static_cast<int>(best.size()) == k && distance >= best.back().first) continue;
+            best.insert(std::upper_bound(best.begin(), best.end(), std::make_pair(distance, handle)),
+                        std::make_pair(distance, handle));
+            if (static_cast<int>(best.size()) > k) best.pop_back();
+        }
+    };
+
+    for (int ring = 0; ring <= maxRing; ring++) {
+        if (ring == 0) {
+            visitCell(centerX, centerZ);
+        } else {
+            for (int x = centerX - ring; x <= centerX + ring; x++) {
+                visitCell(x, centerZ - ring);
+                visitCell(x, centerZ + ring);
+            }
+            for (int z = centerZ - ring + 1; z <= centerZ + ring - 1; z++) {
+                visitCell(centerX - ring, z);
+                visitCell(centerX + ring, z);
+            }
+        }
+        if (static_cast<int>(best.size()) == k && best.back().first <= ring * cellSize) break;
+    }
+
+    for (const auto& entry : best) {
+        result.push_back(entry.second);
+    }
+}
+
+void SpatialHash::containing(const glm::vec3& point, std::vector<Handle>& result) const {
+    result.clear();
+    auto cell = cells.find(cellKey(cellCoordinate(point.x), cellCoordinate(point.z)));
+    if (cell == cells.end()) return;
+    for (Handle handle : cell->second) {
+        if (glm::distance(point, positions[handle]) < radii[handle]) {
+            result.push_back(handle);
+        }
+    }
+}
+
+void SpatialHash::updateTrigger(Trigger& trigger, const glm::vec3& point) const {
+    int64_t cell = cellKey(cellCoordinate(point.x), cellCoordinate(point.z));
+    if (!trigger.valid || trigger.cell != cell || trigger.version != version) {
+        trigger.candidates.clear();
+        auto found = cells.find(cell);
+        if (found != cells.end()) {
+            trigger.candidates = found->second;
+        }
+        trigger.cell = cell;
+        trigger.version = version;
+        trigger.valid = true;
+    }
+
+    std::vector<Handle> inside;
+    for (Handle handle : trigger.candidates) {
+        if (glm::distance(point, positions[handle]) < radii[handle]) {
+            inside.push_back(handle);
+        }
+    }
+    std::sort(inside.begin(), inside.end());
+
+    trigger.entered.clear();
+    trigger.left.clear();
+    std::set_difference(inside.begin(), inside.end(), trigger.inside.begin(), trigger.inside.end(),
+                        std::back_inserter(trigger.entered));
+    std::set_difference(trigger.inside.begin(), trigger.inside.end(), inside.begin(), inside.end(),
+                        std::back_inserter(trigger.left));
+    trigger.inside.swap(inside);
+}
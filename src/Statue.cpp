@@ -1,4 +1,6 @@
 #include "../include/Statue.hpp"
+#include "../include/Profiler.hpp"
+#include "../include/GLStateCache.hpp"
 #include <iostream>
 #include <fstream>
 #include <sstream>
@@ -40,20 +42,24 @@ const int Statue::YEARS[5] = {100, 200, 180, -800, -100};
 // Heykeli oluşturur. Konum, boyut vs. ayarları burada
 Statue::Statue(const std::string& modelPath, const glm::vec3& position,
                const glm::vec3& scale, const glm::vec3& rotation)
-    : modelPath(modelPath), position(position), scale(scale), rotation(rotation),
+    : modelPath(modelPath),
+      transform(TransformSystem::instance().create(position, rotation, scale)),
       title(""), description(""), artist(""), year(0), VAO(0), VBO(0), EBO(0) {}
 
 // Heykel silinince hafizayı temizler
 Statue::~Statue() {
+    TransformSystem::instance().release(transform);
 
-    glDeleteVertexArrays(1, &VAO);
-    glDeleteBuffers(1, &VBO);
-    glDeleteBuffers(1, &EBO);
+    GLStateCache::deleteVertexArrays(1, &VAO);
+    GLStateCache::deleteBuffers(1, &VBO);
+    GLStateCache::deleteBuffers(1, &EBO);
 
     for (auto& mesh : meshes) {
-        glDeleteVertexArrays(1, &mesh.VAO);
-        glDeleteBuffers(1, &mesh.VBO);
-        glDeleteBuffers(1, &mesh.EBO);
+        GLStateCache::deleteVertexArrays(1, &mesh.VAO);
+        GLStateCache::deleteBuffers(1, &mesh.VBO);
+        GLStateCache::deleteBuffers(1, &mesh.EBO);
+        GLStateCache::deleteVertexArrays(1, &mesh.depthVAO);
+        GLStateCache::deleteBuffers(1, &mesh.depthVBO);
     }
 }
 
@@ -64,38 +70,94 @@ bool Statue::initialize() {
 
 // Heykeli ekrana çizme yeri
 void Statue::render(const glm::mat4& viewMatrix, const glm::mat4& projectionMatrix, GLuint shaderProgram) {
-    glUseProgram(shaderProgram);
+    GLStateCache::useProgram(shaderProgram);
 
-    glm::mat4 model = glm::mat4(1.0f);
-    model = glm::translate(model, position);
-    model = glm::rotate(model, glm::radians(rotation.x), glm::vec3(1.0f, 0.0f, 0.0f));
-    model = glm::rotate(model, glm::radians(rotation.y), glm::vec3(0.0f, 1.0f, 0.0f));
-    model = glm::rotate(model, glm::radians(rotation.z), glm::vec3(0.0f, 0.0f, 1.0f));
-    model = glm::scale(model, scale);
-
-    glUniformMatrix4fv(glGetUniformLocation(shaderProgram, "model"), 1, GL_FALSE, glm::value_ptr(model));
-    glUniformMatrix4fv(glGetUniformLocation(shaderProgram, "view"), 1, GL_FALSE, glm::value_ptr(viewMatrix));
-    glUniformMatrix4fv(glGetUniformLocation(shaderProgram, "projection"), 1, GL_FALSE, glm::value_ptr(projectionMatrix));
+    applyTransformUniforms(shaderProgram);
+    GLStateCache::uniformMatrix4fv(glGetUniformLocation(shaderProgram, "view"), 1, GL_FALSE, glm::value_ptr(viewMatrix));
+    GLStateCache::uniformMatrix4fv(glGetUniformLocation(shaderProgram, "projection"), 1, GL_FALSE, glm::value_ptr(projectionMatrix));
 
     GLint colorLoc = glGetUniformLocation(shaderProgram, "objectColor");
-    if (colorLoc != -1) glUniform3f(colorLoc, 1.0f, 0.5f, 0.0f);
+    if (colorLoc != -1) GLStateCache::uniform3f(colorLoc, 1.0f, 0.5f, 0.0f);
+
+    for (const auto& mesh : meshes) {
+        drawMesh(mesh);
+    }
+}
 
+// Dokusu olan mesh'ler TEXTURED varyantıyla, olmayanlar düz renkle çizilir
+void Statue::render(const glm::mat4& viewMatrix, const glm::mat4& projectionMatrix,
+                    ShaderLibrary& shaderLibrary, unsigned int baseFeatures) {
+    GLuint currentProgram = 0;
     for (const auto& mesh : meshes) {
         if (mesh.VAO == 0) continue;
 
-        for (size_t i = 0; i < mesh.textures.size(); i++) {
-            glActiveTexture(GL_TEXTURE0 + i);
-            glBindTexture(GL_TEXTURE_2D, mesh.textures[i].id);
+        unsigned int features = baseFeatures;
+        if (!mesh.textures.empty()) features |= SHADER_FEATURE_TEXTURED;
+
+        GLuint program = shaderLibrary.getProgram(ShaderLibrary::variantKey(features));
+        if (program != currentProgram) {
+            currentProgram = program;
+            GLStateCache::useProgram(program);
+            applyTransformUniforms(program);
+            GLStateCache::uniformMatrix4fv(glGetUniformLocation(program, "view"), 1, GL_FALSE, glm::value_ptr(viewMatrix));
+            GLStateCache::uniformMatrix4fv(glGetUniformLocation(program, "projection"), 1, GL_FALSE, glm::value_ptr(projectionMatrix));
+
+            GLint colorLoc = glGetUniformLocation(program, "objectColor");
+            if (colorLoc != -1) GLStateCache::uniform3f(colorLoc, 1.0f, 0.5f, 0.0f);
         }
 
-        glBindVertexArray(mesh.VAO);
+        drawMesh(mesh);
+    }
+}
+
+// Ön geçişte doku ve ışık yok; her mesh aynı programla konum akışından çizilir
+void Statue::renderDepth(const glm::mat4& viewMatrix, const glm::mat4& projectionMatrix, ShaderLibrary& shaderLibrary) {
+    GLuint program = shaderLibrary.use(ShaderLibrary::variantKey(SHADER_FEATURE_DEPTH_ONLY, 1));
+    applyTransformUniforms(program);
+    GLStateCache::uniformMatrix4fv(glGetUniformLocation(program, "view"), 1, GL_FALSE, glm::value_ptr(viewMatrix));
+    GLStateCache::uniformMatrix4fv(glGetUniformLocation(program, "projection"), 1, GL_FALSE, glm::value_ptr(projectionMatrix));
+
+    for (const auto& mesh : meshes) {
+        if (mesh.depthVAO == 0) continue;
+        GLStateCache::bindVertexArray(mesh.depthVAO);
         glDrawElements(GL_TRIANGLES, mesh.indices.size(), GL_UNSIGNED_INT, 0);
-        glBindVertexArray(0);
     }
+    GLStateCache::bindVertexArray(0);
+}
+
+// Mesh'ler yüklendikten sonra CPU kopyası durduğu için GPU'ya dokunmadan okunur
+void Statue::collectTriangles(std::vector<glm::vec3>& triangles) const {
+    glm::mat4 model = TransformSystem::instance().getWorldMatrix(transform);
+    for (const auto& mesh : meshes) {
+        for (unsigned int index : mesh.indices) {
+            if (index >= mesh.vertices.size()) continue;
+            triangles.push_back(glm::vec3(model * glm::vec4(mesh.vertices[index].position, 1.0f)));
+        }
+    }
+}
+
+// Önceden hesaplanmış dünya ve normal matrisini shader'a gönderir
+void Statue::applyTransformUniforms(GLuint program) const {
+    TransformSystem& transforms = TransformSystem::instance();
+    GLStateCache::uniformMatrix4fv(glGetUniformLocation(program, "model"), 1, GL_FALSE, glm::value_ptr(transforms.getWorldMatrix(transform)));
+    GLStateCache::uniformMatrix3fv(glGetUniformLocation(program, "normalMatrix"), 1, GL_FALSE, glm::value_ptr(transforms.getNormalMatrix(transform)));
 }
 
-glm::vec3 Statue::getPosition() const { return position; }
-glm::vec3 Statue::getRotation() const { return rotation; }
+void Statue::drawMesh(const Mesh& mesh) const {
+    if (mesh.VAO == 0) return;
+
+    for (size_t i = 0; i < mesh.textures.size(); i++) {
+        GLStateCache::activeTexture(GL_TEXTURE0 + i);
+        GLStateCache::bindTexture(GL_TEXTURE_2D, mesh.textures[i].id);
+    }
+
+    GLStateCache::bindVertexArray(mesh.VAO);
+    glDrawElements(GL_TRIANGLES, mesh.indices.size(), GL_UNSIGNED_INT, 0);
+    GLStateCache::bindVertexArray(0);
+}
+
+glm::vec3 Statue::getPosition() const { return TransformSystem::instance().getPosition(transform); }
+glm::vec3 Statue::getRotation() const { return TransformSystem::instance().getRotation(transform); }
 // Heykel bilgilerini atama yeri
 void Statue::setInformation(const std::string& t, const std::string& d, const std::string& a, int y) {
     title = t; description = d; artist = a; year = y;
@@ -135,23 +197,9 @@ std::vector<Statue*> Statue::createStatueCollection(float roomWidth, float roomH
     return statues;
 }
 
-// Robotun en yakinindaki heykeli bulur
-int Statue::checkProximity(const std::vector<Statue*>& statues, const glm::vec3& robotPos, float proximityDistance) {
-    int closest = -1;
-    float minDist = proximityDistance;
-
-    for (size_t i = 0; i < statues.size(); i++) {
-        float dist = glm::distance(robotPos, statues[i]->getPosition());
-        if (dist < minDist) {
-            minDist = dist;
-            closest = i;
-        }
-    }
-    return closest;
-}
-
 // Modeli dosyadan yükler (Assimp)
 bool Statue::loadModel(const std::string& path) {
+    VM_PROFILE_ZONE("Statue::loadModel");
     Assimp::Importer importer;
     const aiScene* scene = importer.ReadFile(path,
         aiProcess_Triangulate | aiProcess_GenSmoothNormals |
@@ -221,12 +269,12 @@ void Statue::setupMesh(Mesh& mesh) {
     glGenBuffers(1, &mesh.VBO);
     glGenBuffers(1, &mesh.EBO);
 
-    glBindVertexArray(mesh.VAO);
+    GLStateCache::bindVertexArray(mesh.VAO);
 
-    glBindBuffer(GL_ARRAY_BUFFER, mesh.VBO);
+    GLStateCache::bindBuffer(GL_ARRAY_BUFFER, mesh.VBO);
     glBufferData(GL_ARRAY_BUFFER, mesh.vertices.size() * sizeof(Vertex), &mesh.vertices[0], GL_STATIC_DRAW);
 
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mesh.EBO);
+    GLStateCache::bindBuffer(GL_ELEMENT_ARRAY_BUFFER, mesh.EBO);
     glBufferData(GL_ELEMENT_ARRAY_BUFFER, mesh.indices.size() * sizeof(unsigned int), &mesh.indices[0], GL_STATIC_DRAW);
 
     glEnableVertexAttribArray(0);
@@ -238,7 +286,27 @@ void Statue::setupMesh(Mesh& mesh) {
     glEnableVertexAttribArray(2);
     glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, texCoords));
 
-    glBindVertexArray(0);
+    // Ön geçiş için konumları ayrı bir tampona kopyala, indeksler ortak
+    std::vector<glm::vec3> positions;
+    positions.reserve(mesh.vertices.size());
+    for (const auto& vertex : mesh.vertices) {
+        positions.push_back(vertex.position);
+    }
+
+    glGenVertexArrays(1, &mesh.depthVAO);
+    glGenBuffers(1, &mesh.depthVBO);
+
+    GLStateCache::bindVertexArray(mesh.depthVAO);
+
+    GLStateCache::bindBuffer(GL_ARRAY_BUFFER, mesh.depthVBO);
+    glBufferData(GL_ARRAY_BUFFER, positions.size() * sizeof(glm::vec3), positions.data(), GL_STATIC_DRAW);
+
+    GLStateCache::bindBuffer(GL_ELEMENT_ARRAY_BUFFER, mesh.EBO);
+
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(glm::vec3), (void*)0);
+
+    GLStateCache::bindVertexArray(0);
 }
 
 std::vector<Statue::Texture> Statue::loadMaterialTextures(aiMaterial* mat, aiTextureType type, std::string typeName) {
@@ -270,6 +338,7 @@ std::vector<Statue::Texture> Statue::loadMaterialTextures(aiMaterial* mat, aiTex
 }
 
 GLuint Statue::textureFromFile(const std::string& path, const std::string& directory) {
+    VM_PROFILE_ZONE("Statue::textureFromFile");
     std::string filename = (directory != ".") ? directory + '/' + path : path;
 
     GLuint textureID;
@@ -284,7 +353,7 @@ GLuint Statue::textureFromFile(const std::string& path, const std::string& direc
 
     GLenum format = nrComponents == 1 ? GL_RED : nrComponents == 3 ? GL_RGB : GL_RGBA;
 
-    glBindTexture(GL_TEXTURE_2D, textureID);
+    GLStateCache::bindTexture(GL_TEXTURE_2D, textureID);
     glTexImage2D(GL_TEXTURE_2D, 0, format, width, height, 0, format, GL_UNSIGNED_BYTE, data);
     glGenerateMipmap(GL_TEXTURE_2D);
 
@@ -1,10 +1,11 @@
 #include "../include/StatueManager.hpp"
+#include "../include/MuseumWorld.hpp"
 
 // Heykel yöneticisini kurar
 StatueManager::StatueManager(float proximityThreshold, float scanDuration)
     : proximityThreshold(proximityThreshold), scanDuration(scanDuration),
       activeStatueIndex(-1), scanning(false), scanProgress(0.0f),
-      showInfoPanel(false), infoDisplayTime(0.0f) {
+      showInfoPanel(false), infoDisplayTime(0.0f), world(nullptr), statueIndex(proximityThreshold * 2.0f) {
 }
 
 // Kapanırken temizlik yapar
@@ -18,8 +19,26 @@ bool StatueManager::initialize(float roomWidth, float roomHeight, float roomLeng
     return !statues.empty();
 }
 
-// Robotun yakınındaki heykeli bulur
+void StatueManager::setWorld(MuseumWorld* museumWorld) {
+    world = museumWorld;
+    statueIndex.clear();
+    robotTrigger = SpatialHash::Trigger();
+    if (!world) return;
+    
+    std::vector<glm::vec3> positions;
+    world->collectStatues(positions);
+    for (const glm::vec3& position : positions) {
+        statueIndex.insert(position, proximityThreshold);
+    }
+}
+
+// Robotun yakınındaki heykeli bulur. Sadece robotun hücresindeki heykeller denetlenir;
+// maliyet koleksiyonun boyutundan bağımsızdır.
 void StatueManager::updateStatueProximity(const Robot* robot) {
+    if (!world) return;
+    glm::vec3 robotPos = robot->getPosition();
+    statueIndex.updateTrigger(robotTrigger, robotPos);
+    
     if (scanning) {
         if (scanProgress >= 1.0f) {
             if (activeStatueIndex >= 0) {
@@ -35,8 +54,19 @@ void StatueManager::updateStatueProximity(const Robot* robot) {
         return;
     }
     
-    glm::vec3 robotPos = robot->getPosition();
-    activeStatueIndex = Statue::checkProximity(statues, robotPos, proximityThreshold);
+    activeStatueIndex = -1;
+    float minDist = proximityThreshold;
+    for (int index : robotTrigger.inside) {
+        float dist = glm::distance(robotPos, world->getStatuePosition(index));
+        if (dist < minDist) {
+            minDist = dist;
+            activeStatueIndex = index;
+        }
+    }
+}
+
+void StatueManager::findNearestStatues(const glm::vec3& position, int count, float maxDistance, std::vector<int>& result) const {
+    statueIndex.kNearest(position, count, maxDistance, result);
 }
 
 // Heykel taramasını başlatır.
@@ -78,6 +108,9 @@ void StatueManager::cleanup() {
         delete statue;
     }
     statues.clear();
+    world = nullptr;
+    statueIndex.clear();
+    robotTrigger = SpatialHash::Trigger();
     activeStatueIndex = -1;
     scanning = false;
     showInfoPanel = false;
@@ -0,0 +1,249 @@
+#include "../include/Tracer.hpp"
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+std::atomic<bool> Tracer::active(false);
+
+namespace {
+
+enum TraceEventType : uint8_t {
+    TRACE_ZONE,
+    TRACE_GPU_ZONE,
+    TRACE_COUNTER
+};
+
+struct TraceEvent {
+    const char* name;
+    uint64_t start;
+    uint64_t end;
+    double value;
+    TraceEventType type;
+};
+
+// Bir thread'in doldurduğu olay bloğu; dolunca yazıcıya devredilir
+struct TraceChunk {
+    static const int CAPACITY = 1024;
+
+    int threadIndex;
+    int count;
+    TraceChunk* next;
+    TraceEvent events[CAPACITY];
+};
+
+struct TraceThread {
+    int threadIndex;
+    std::string name;
+    TraceChunk* current;
+};
+
+// GPU bölgeleri izleyicide bu numaralı ayrı bir satırda görünür
+const int GPU_THREAD_ID = 999;
+
+std::mutex registryMutex;
+std::vector<TraceThread*> threads;
+
+// Dolu bloklar: çok yazarlı, tek okurlu kilitsiz yığın
+std::atomic<TraceChunk*> fullChunks(nullptr);
+
+std::thread writerThread;
+std::mutex writerMutex;
+std::condition_variable writerWake;
+bool writerStopping = false;
+
+std::ofstream output;
+uint64_t origin = 0;
+
+}
+
+uint64_t Tracer::now() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+// İlk kayıtta thread'e ait yapı oluşturulur; kilit sadece bu sırada alınır
+static TraceThread* currentThread() {
+    static thread_local TraceThread* thread = nullptr;
+    if (!thread) {
+        thread = new TraceThread();
+        thread->current = nullptr;
+
+        std::lock_guard<std::mutex> lock(registryMutex);
+        thread->threadIndex = static_cast<int>(threads.size());
+        threads.push_back(thread);
+    }
+    return thread;
+}
+
+static void publishChunk(TraceChunk* chunk) {
+    chunk->next = fullChunks.load(std::memory_order_relaxed);
+    while (!fullChunks.compare_exchange_weak(chunk->next, chunk, std::memory_order_release,
+                                             std::memory_order_relaxed)) {
+    }
+}
+
+static void pushEvent(const TraceEvent& event) {
+    TraceThread* thread = currentThread();
+    if (!thread->current) {
+        thread->current = new TraceChunk();
+        thread->current->threadIndex = thread->threadIndex;
+        thread->current->count = 0;
+        thread->current->next = nullptr;
+    }
+
+    TraceChunk* chunk = thread->current;
+    chunk->events[chunk->count++] = event;
+    if (chunk->count == TraceChunk::CAPACITY) {
+        publishChunk(chunk);
+        thread->current = nullptr;
+    }
+}
+
+static void writeString(const char* text) {
+    output << '"';
+    for (const char* c = text; *c; c++) {
+        if (*c == '"' || *c == '\\') output << '\\';
+        if (static_cast<unsigned char>(*c) >= 0x20) output << *c;
+    }
+    output << '"';
+}
+
+// Mikrosaniye, kayıt başlangıcına göre
+static void writeTime(const char* key, uint64_t nanoseconds) {
+    char text[32];
+    std::snprintf(text, sizeof(text), "%.3f", nanoseconds / 1000.0);
+    output << ",\"" << key << "\":" << text;
+}
+
+static void writeEvent(const TraceEvent& event, int threadIndex) {
+    uint64_t start = event.start > origin ? event.start - origin : 0;
+
+    output << ",\n{\"name\":";
+    writeString(event.name);
+    switch (event.type) {
+        case TRACE_ZONE:
+        case TRACE_GPU_ZONE:
+            output << ",\"cat\":\"" << (event.type == TRACE_GPU_ZONE ? "gpu" : "cpu") << "\",\"ph\":\"X\"";
+            writeTime("ts", start);
+            writeTime("dur", event.end > event.start ? event.end - event.start : 0);
+            break;
+        case TRACE_COUNTER:
+            output << ",\"ph\":\"C\"";
+            writeTime("ts", start);
+            output << ",\"args\":{\"value\":" << event.value << "}";
+            break;
+    }
+    output << ",\"pid\":1,\"tid\":" << (event.type == TRACE_GPU_ZONE ? GPU_THREAD_ID : threadIndex) << "}";
+}
+
+static void writeMetadata(const char* type, int threadIndex, const char* name) {
+    output << ",\n{\"name\":\"" << type << "\",\"ph\":\"M\",\"pid\":1,\"tid\":" << threadIndex << ",\"args\":{\"name\":";
+    writeString(name);
+    output << "}}";
+}
+
+// Yığından alınan liste en yeni blokla başlar; dosyada kronolojik kalsın diye çevrilir
+static void writeChunks(TraceChunk* chunk) {
+    TraceChunk* ordered = nullptr;
+    while (chunk) {
+        TraceChunk* next = chunk->next;
+        chunk->next = ordered;
+        ordered = chunk;
+        chunk = next;
+    }
+
+    while (ordered) {
+        for (int i = 0; i < ordered->count; i++) {
+            writeEvent(ordered->events[i], ordered->threadIndex);
+        }
+        TraceChunk* next = ordered->next;
+        delete ordered;
+        ordered = next;
+    }
+}
+
+// Dosya yazımı kare döngüsünü hiç beklemez; dolu bloklar periyodik olarak toplanır
+static void writerLoop() {
+    std::unique_lock<std::mutex> lock(writerMutex);
+    while (!writerStopping) {
+        writerWake.wait_for(lock, std::chrono::milliseconds(100));
+        lock.unlock();
+        writeChunks(fullChunks.exchange(nullptr, std::memory_order_acquire));
+        lock.lock();
+    }
+}
+
+bool Tracer::start(const std::string& path) {
+    if (isActive()) return true;
+
+    output.open(path, std::ios::out | std::ios::trunc);
+    if (!output) {
+        std::cerr << "İz dosyası açılamadı: " << path << std::endl;
+        return false;
+    }
+
+    origin = now();
+    output << "{\"traceEvents\":[\n{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":\"VirtualMuseum\"}}";
+    writeMetadata("thread_name", GPU_THREAD_ID, "GPU");
+
+    writerStopping = false;
+    writerThread = std::thread(writerLoop);
+    active.store(true, std::memory_order_release);
+
+    std::cout << "İz kaydı: " << path << std::endl;
+    return true;
+}
+
+// Diğer thread'ler durdurulduktan sonra çağrılır; yarım kalan bloklar da yazılır
+void Tracer::stop() {
+    if (!isActive()) return;
+    active.store(false, std::memory_order_release);
+
+    {
+        std::lock_guard<std::mutex> lock(writerMutex);
+        writerStopping = true;
+    }
+    writerWake.notify_one();
+    writerThread.join();
+    writeChunks(fullChunks.exchange(nullptr, std::memory_order_acquire));
+
+    std::lock_guard<std::mutex> lock(registryMutex);
+    for (TraceThread* thread : threads) {
+        if (thread->current) {
+            writeChunks(thread->current);
+            thread->current = nullptr;
+        }
+        if (!thread->name.empty()) {
+            writeMetadata("thread_name", thread->threadIndex, thread->name.c_str());
+        }
+    }
+
+    output << "\n]}\n";
+    output.close();
+}
+
+void Tracer::recordZone(const char* name, uint64_t start, uint64_t end) {
+    if (!isActive()) return;
+    pushEvent({ name, start, end, 0.0, TRACE_ZONE });
+}
+
+void Tracer::recordGpuZone(const char* name, uint64_t start, uint64_t end) {
+    if (!isActive()) return;
+    pushEvent({ name, start, end, 0.0, TRACE_GPU_ZONE });
+}
+
+void Tracer::recordCounter(const char* name, double value) {
+    if (!isActive()) return;
+    uint64_t time = now();
+    pushEvent({ name, time, time, value, TRACE_COUNTER });
+}
+
+void Tracer::setThreadName(const char* name) {
+    if (!isActive()) return;
+    currentThread()->name = name;
+}
@@ -0,0 +1,141 @@
+#include "../include/TransformSystem.hpp"
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/matrix_inverse.hpp>
+
+thread_local const TransformSystem::Snapshot* TransformSystem::boundSnapshot = nullptr;
+
+TransformSystem& TransformSystem::instance() {
+    static TransformSystem system;
+    return system;
+}
+
+TransformSystem::TransformSystem() : anyDirty(false), lastRecomputeCount(0) {
+}
+
+TransformSystem::Handle TransformSystem::create(const glm::vec3& position, const glm::vec3& rotation,
+                                                const glm::vec3& scale, Handle parent) {
+    // Boş bir yuvayı yalnızca ebeveynden sonra geliyorsa kullanırız, sıralama bozulmasın
+    Handle handle = INVALID_HANDLE;
+    for (size_t i = 0; i < freeList.size(); i++) {
+        if (freeList[i] > parent) {
+            handle = freeList[i];
+            freeList.erase(freeList.begin() + i);
+            break;
+        }
+    }
+
+    if (handle == INVALID_HANDLE) {
+        handle = static_cast<Handle>(positions.size());
+        positions.push_back(position);
+        rotations.push_back(rotation);
+        scales.push_back(scale);
+        parents.push_back(parent);
+        dirty.push_back(1);
+        alive.push_back(1);
+        changed.push_back(0);
+        versions.push_back(0);
+        worldMatrices.push_back(glm::mat4(1.0f));
+        normalMatrices.push_back(glm::mat3(1.0f));
+    } else {
+        positions[handle] = position;
+        rotations[handle] = rotation;
+        scales[handle] = scale;
+        parents[handle] = parent;
+        alive[handle] = 1;
+    }
+
+    markDirty(handle);
+    return handle;
+}
+
+void TransformSystem::release(Handle handle) {
+    if (handle < 0 || handle >= static_cast<Handle>(positions.size()) || !alive[handle]) return;
+    alive[handle] = 0;
+    dirty[handle] = 0;
+    freeList.push_back(handle);
+}
+
+void TransformSystem::setPosition(Handle handle, const glm::vec3& position) {
+    if (positions[handle] == position) return;
+    positions[handle] = position;
+    markDirty(handle);
+}
+
+void TransformSystem::setRotation(Handle handle, const glm::vec3& rotation) {
+    if (rotations[handle] == rotation) return;
+    rotations[handle] = rotation;
+    markDirty(handle);
+}
+
+void TransformSystem::setScale(Handle handle, const glm::vec3& scale) {
+    if (scales[handle] == scale) return;
+    scales[handle] = scale;
+    markDirty(handle);
+}
+
+void TransformSystem::setLocal(Handle handle, const glm::vec3& position, const glm::vec3& rotation, const glm::vec3& scale) {
+    setPosition(handle, position);
+    setRotation(handle, rotation);
+    setScale(handle, scale);
+}
+
+const glm::mat4& TransformSystem::getWorldMatrix(Handle handle) {
+    if (boundSnapshot) return boundSnapshot->worldMatrices[handle];
+    if (anyDirty) update();
+    return worldMatrices[handle];
+}
+
+const glm::mat3& TransformSystem::getNormalMatrix(Handle handle) {
+    if (boundSnapshot) return boundSnapshot->normalMatrices[handle];
+    if (anyDirty) update();
+    return normalMatrices[handle];
+}
+
+// Vektörler kareler arasında yeniden kullanılır; kapasite bir kez ayrıldıktan sonra bellek ayrılmaz
+void TransformSystem::captureSnapshot(Snapshot& snapshot) {
+    if (anyDirty) update();
+    snapshot.worldMatrices.assign(worldMatrices.begin(), worldMatrices.end());
+    snapshot.normalMatrices.assign(normalMatrices.begin(), normalMatrices.end());
+    snapshot.versions.assign(versions.begin(), versions.end());
+}
+
+// Ebeveynler her zaman çocuklardan önce geldiği için tek geçiş yeterli
+void TransformSystem::update() {
+    lastRecomputeCount = 0;
+    if (!anyDirty) return;
+
+    const size_t count = positions.size();
+    for (size_t i = 0; i < count; i++) {
+        changed[i] = 0;
+        if (!alive[i]) continue;
+
+        Handle parent = parents[i];
+        bool parentChanged = parent != INVALID_HANDLE && changed[parent];
+        if (!dirty[i] && !parentChanged) continue;
+
+        glm::mat4 local = composeLocal(static_cast<Handle>(i));
+        worldMatrices[i] = parent != INVALID_HANDLE ? worldMatrices[parent] * local : local;
+        normalMatrices[i] = glm::inverseTranspose(glm::mat3(worldMatrices[i]));
+
+        dirty[i] = 0;
+        changed[i] = 1;
+        lastRecomputeCount++;
+    }
+    anyDirty = false;
+}
+
+void TransformSystem::markDirty(Handle handle) {
+    dirty[handle] = 1;
+    versions[handle]++;
+    anyDirty = true;
+}
+
+// Statue::render'daki sırayla aynı: T * Rx * Ry * Rz * S
+glm::mat4 TransformSystem::composeLocal(Handle handle) const {
+    const glm::vec3& rotation = rotations[handle];
+    glm::mat4 model = glm::translate(glm::mat4(1.0f), positions[handle]);
+    if (rotation.x != 0.0f) model = glm::rotate(model, glm::radians(rotation.x), glm::vec3(1.0f, 0.0f, 0.0f));
+    if (rotation.y != 0.0f) model = glm::rotate(model, glm::radians(rotation.y), glm::vec3(0.0f, 1.0f, 0.0f));
+    if (rotation.z != 0.0f) model = glm::rotate(model, glm::radians(rotation.z), glm::vec3(0.0f, 0.0f, 1.0f));
+    return glm::scale(model, scales[handle]);
+}
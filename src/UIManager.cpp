@@ -1,5 +1,7 @@
 #include "../include/UIManager.hpp"
+#include "../include/GLStateCache.hpp"
 #include <iostream>
+#include <fstream>
 
 UIManager::UIManager() {
 }
@@ -22,6 +24,10 @@ bool UIManager::initialize(GLFWwindow* window) {
     
     ImGui_ImplGlfw_InitForOpenGL(window, true);
     ImGui_ImplOpenGL3_Init("#version 330");
+
+    // Cihaz nesneleri burada oluşturulur ki newFrame() GL bağlamı olmayan bir thread'den
+    // de çağrılabilsin
+    ImGui_ImplOpenGL3_CreateDeviceObjects();
     
     return true;
 }
@@ -39,9 +45,26 @@ void UIManager::setupFonts() {
         0,
     };
     
+    // Türkçe karakterler için sistem fontu eklenir; bulunamazsa varsayılan font yeterli
+    static const char* fontPaths[] = {
+        "C:\\Windows\\Fonts\\arial.ttf",
+        "/usr/share/fonts/truetype/dejavu/DejaVuSans.ttf",
+        "/usr/share/fonts/TTF/DejaVuSans.ttf",
+        "/Library/Fonts/Arial.ttf",
+    };
+    
     ImFontConfig config;
     config.MergeMode = true;
-    io.Fonts->AddFontFromFileTTF("C:\\Windows\\Fonts\\arial.ttf", 14.0f, &config, ranges);
+    bool merged = false;
+    for (const char* path : fontPaths) {
+        if (std::ifstream(path).good()) {
+            merged = io.Fonts->AddFontFromFileTTF(path, 14.0f, &config, ranges) != nullptr;
+            if (merged) break;
+        }
+    }
+    if (!merged) {
+        std::cerr << "Sistem fontu bulunamadı, varsayılan font kullanılıyor." << std::endl;
+    }
     io.Fonts->Build();
 }
 
@@ -61,8 +84,19 @@ void UIManager::newFrame() {
 
 void UIManager::render() {
   
+    renderDrawData(endFrame());
+}
+
+ImDrawData* UIManager::endFrame() {
     ImGui::Render();
-    ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+    return ImGui::GetDrawData();
+}
+
+void UIManager::renderDrawData(ImDrawData* drawData) {
+    ImGui_ImplOpenGL3_RenderDrawData(drawData);
+
+    // Backend önbelleği atlayarak durum değiştirir ama çıkışta eski durumu geri kurar
+    GLStateCache::validate("ImGui");
 }
 
 void UIManager::renderScanEffect(GLFWwindow* window, const Statue& statue, const glm::mat4& view, const glm::mat4& projection, 
@@ -162,6 +196,9 @@ void UIManager::renderRobotControlPanel(int screenWidth, int screenHeight, int a
     ImGui::BulletText("Z: Asagi");
     ImGui::BulletText("E: Tarama baslat/durdur");
     ImGui::BulletText("F: Bilgi paneli goster/gizle");
+    ImGui::BulletText("P: Derinlik on gecisi ac/kapat");
+    ImGui::BulletText("F3: Profiler ac/kapat");
+    ImGui::BulletText("F4: Kare zamanlama paneli");
     ImGui::BulletText("ESC: Cikis/Kapat");
     ImGui::Separator();
     
@@ -175,3 +212,18 @@ void UIManager::renderRobotControlPanel(int screenWidth, int screenHeight, int a
     
     ImGui::End();
 }
+
+void UIManager::renderDepthPrepassPanel(bool enabled, double offMilliseconds, double offFragments,
+                                        double onMilliseconds, double onFragments) {
+    ImGui::SetNextWindowPos(ImVec2(10, 10), ImGuiCond_FirstUseEver);
+    ImGui::SetNextWindowSize(ImVec2(260, 110), ImGuiCond_FirstUseEver);
+    ImGui::Begin("Derinlik On Gecisi");
+
+    ImGui::Text("Durum: %s", enabled ? "Acik" : "Kapali");
+    ImGui::Text("Heykel gecisi: GPU suresi / golgelenen fragment");
+    ImGui::Separator();
+    ImGui::Text("Kapali: %.3f ms  %.0f", offMilliseconds, offFragments);
+    ImGui::Text("Acik:   %.3f ms  %.0f", onMilliseconds, onFragments);
+
+    ImGui::End();
+}
@@ -5,10 +5,14 @@
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtc/type_ptr.hpp>
-#include "../include/Shader.hpp"
+#include "../include/ShaderLibrary.hpp"
+#include "../include/GLExtensions.hpp"
+#include "../include/ProgramCache.hpp"
+#include "../include/TransformSystem.hpp"
 #include <iostream>
 #include <vector>
 #include <string>
+#include <cstring>
 #include "stb_image.h"
 #include "imgui.h"
 #include "imgui_impl_glfw.h"
@@ -25,6 +29,29 @@
 #include "../include/Camera.hpp"
 #include "../include/StatueManager.hpp"
 #include "../include/InputManager.hpp"
+#include "../include/LightingSystem.hpp"
+#include "../include/DynamicResolution.hpp"
+#include "../include/RenderThread.hpp"
+#include "../include/JobSystem.hpp"
+#include "../include/FrameCapture.hpp"
+#include "../include/Benchmark.hpp"
+#include "../include/GLStats.hpp"
+#include "../include/GLDebugLayer.hpp"
+#include "../include/Profiler.hpp"
+#include "../include/Tracer.hpp"
+#include "../include/FlightRecorder.hpp"
+#include "../include/GLStateCache.hpp"
+#include "../include/FixedTimestep.hpp"
+#include "../include/FramePacer.hpp"
+#include "../include/SimdKernels.hpp"
+#include "../include/RobotFleet.hpp"
+#include "../include/MuseumWorld.hpp"
+#include "../include/NavigationSystem.hpp"
+#include "../include/CollisionWorld.hpp"
+#include <filesystem>
+#include <cstdio>
+#include <cstdlib>
+#include <chrono>
 
 // Pencere boyutları - standart 800x600 kullanıyoruz
 const unsigned int SCR_WIDTH = 800;
@@ -40,50 +67,321 @@ InputManager* inputManager = nullptr;
 const float STATUE_PROXIMITY_THRESHOLD = 1.5f;
 const float SCAN_DURATION = 1.0f;
 
-// Fps bağımsız hareketi için
+// Rehber robotların bir heykelde geçirdiği tarama süresi
+const float GUIDE_SCAN_DURATION = 4.0f;
+
+// Yol haritası: hücre boyu ve heykellerle çarpışabilecek boy; yarıçap Robot::NAV_RADIUS
+const float NAV_CELL_SIZE = 0.1f;
+const float NAV_AGENT_HEIGHT = 1.2f;
+
+// Son karenin gerçek süresi; simülasyon bunun yerine sabit adım kullanır
 float deltaTime = 0.0f;
-float lastFrame = 0.0f;
+double lastFrame = 0.0;
 
 Robot* robot = nullptr;
+RobotFleet* robotFleet = nullptr;
+MuseumWorld* museumWorld = nullptr;
+NavigationSystem* navigation = nullptr;
+CollisionWorld* collisionWorld = nullptr;
 std::vector<Statue*> statues;
 
-// Pencere boyutu değişince çağrılacak fonksiyon
-void framebuffer_size_callback(GLFWwindow* window, int width, int height);
-
 UIManager* uiManager = nullptr;
-Shader* shader = nullptr;
-
-void framebuffer_size_callback(GLFWwindow*, int width, int height) {
-    glViewport(0, 0, width, height);
-}
-
-int main() {
-
-    glfwInit();
+ShaderLibrary* shaderLibrary = nullptr;
+LightingSystem* lightingSystem = nullptr;
+DynamicResolution* dynamicResolution = nullptr;
+RenderThread* renderThread = nullptr;
+FrameCapture* frameCapture = nullptr;
+Benchmark* benchmark = nullptr;
+FlightRecorder* flightRecorder = nullptr;
+FramePacer* framePacer = nullptr;
+
+// Başsız modda çizilecek kare sayısı varsayılanı
+const int HEADLESS_DEFAULT_FRAMES = 300;
+const int BENCHMARK_DEFAULT_FRAMES = 600;
+
+// Bu süreyi aşan kareler uçuş kaydını diske yazdırır
+const double HITCH_DEFAULT_MILLISECONDS = 50.0;
+
+// Simülasyon kare hızından bağımsız olarak bu sıklıkta ilerler
+const double SIMULATION_TICK_RATE = 60.0;
+const int SIMULATION_MAX_TICKS = 5;
+
+// --gl-debug: KHR_debug mesajları sadece debug bağlamında gelir
+static bool debugContext = false;
+
+static void setContextHints() {
     // OpenGL 3.3 kullanıyoruz
     glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
     glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
     glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+    glfwWindowHint(GLFW_OPENGL_DEBUG_CONTEXT, debugContext ? GLFW_TRUE : GLFW_FALSE);
+}
+
+// Önce ekran gerektirmeyen null platform + OSMesa (llvmpipe) denenir; o yoksa
+// normal platformda gizli bir pencere açılır
+static GLFWwindow* createHeadlessWindow() {
+    glfwInitHint(GLFW_PLATFORM, GLFW_PLATFORM_NULL);
+    if (glfwInit()) {
+        setContextHints();
+        glfwWindowHint(GLFW_CONTEXT_CREATION_API, GLFW_OSMESA_CONTEXT_API);
+        GLFWwindow* window = glfwCreateWindow(SCR_WIDTH, SCR_HEIGHT, "Virtual Museum", NULL, NULL);
+        if (window) {
+            return window;
+        }
+        glfwTerminate();
+    }
+
+    glfwInitHint(GLFW_PLATFORM, GLFW_ANY_PLATFORM);
+    if (!glfwInit()) {
+        return nullptr;
+    }
+    setContextHints();
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+    return glfwCreateWindow(SCR_WIDTH, SCR_HEIGHT, "Virtual Museum", NULL, NULL);
+}
+
+int main(int argc, char** argv) {
+
+    // --render-thread: GL çizimi ayrı bir thread'de, simülasyonla örtüşerek yapılır
+    // --job-benchmark: iş sisteminin ölçümlerini yazdırıp çıkar
+    // --simd-benchmark: SIMD çekirdeklerini doğrulayıp hızlarını yazdırır ve çıkar (VM_SIMD yolu zorlar)
+    // --headless: pencere göstermeden offscreen çizer, --frames N kare sonra çıkar
+    // --dump-frames KLASÖR: her kareyi PNG olarak kaydeder
+    // --benchmark: senaryolu, sabit adımlı ölçüm; sonuç --benchmark-out dosyasına (.json + .csv)
+    // --trace DOSYA (ya da VM_TRACE=DOSYA): Chrome trace JSON; chrome://tracing veya ui.perfetto.dev ile açılır
+    // --hitch-ms N: uçuş kaydedicisi eşiği (0 kapatır), --hitch-dir KLASÖR: takılma kayıtlarının yeri
+    // --gl-debug: GL çağrılarını sayan, gereksiz durum değişikliklerini ve sürücü uyarılarını raporlayan katman
+    // --tick-rate HZ: simülasyon adım hızı (varsayılan 60), --max-ticks N: bir karede en fazla adım
+    // --pacing off|limit|jit: kare temposu, --fps N: hedef hız (0 ekran hızı), --vsync off|on|adaptive
+    // --record-input DOSYA: input olaylarını adım numarasıyla kaydeder, --replay-input DOSYA: kaydı oynatır
+    // --guides N: heykelleri kendi başına gezen N rehber robot (tek instanced çizim)
+    // --visitors N: varlık dünyasında heykeller arasında dolaşan N ziyaretçi
+    // --ecs-benchmark: nesne dizisi ile ECS parçalarının gezinme hızını karşılaştırıp çıkar
+    // --autopilot: robot açılışta heykelleri otomatik gezmeye başlar (T ile aç/kapa)
+    // --nav-benchmark: yol planlayıcıyı doğrular, büyük bir müzede sorgu sürelerini yazdırıp çıkar
+    // --collision-benchmark: süpürme testini kaba kuvvetle doğrular, yüzlerce ajanın adım süresini yazdırıp çıkar
+    bool useRenderThread = false;
+    bool runBenchmark = false;
+    std::string benchmarkOutput = "benchmark.json";
+    bool runJobBenchmark = false;
+    bool runSimdBenchmark = false;
+    bool runEcsBenchmark = false;
+    bool runNavBenchmark = false;
+    bool runCollisionBenchmark = false;
+    bool autopilot = false;
+    bool headless = false;
+    int frameLimit = 0;
+    std::string dumpDirectory;
+    std::string traceOutput;
+    double hitchMilliseconds = HITCH_DEFAULT_MILLISECONDS;
+    bool hitchRequested = false;
+    std::string hitchDirectory = "hitches";
+    double tickRate = SIMULATION_TICK_RATE;
+    int maxTicks = SIMULATION_MAX_TICKS;
+    FramePacer::Mode pacingMode = FramePacer::MODE_UNLIMITED;
+    FramePacer::Vsync vsync = FramePacer::VSYNC_ON;
+    double targetRate = 0.0;
+    std::string recordInput;
+    std::string replayInput;
+    int guideCount = 0;
+    int visitorCount = 0;
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--render-thread") == 0) {
+            useRenderThread = true;
+        } else if (std::strcmp(argv[i], "--job-benchmark") == 0) {
+            runJobBenchmark = true;
+        } else if (std::strcmp(argv[i], "--simd-benchmark") == 0) {
+            runSimdBenchmark = true;
+        } else if (std::strcmp(argv[i], "--ecs-benchmark") == 0) {
+            runEcsBenchmark = true;
+        } else if (std::strcmp(argv[i], "--nav-benchmark") == 0) {
+            runNavBenchmark = true;
+        } else if (std::strcmp(argv[i], "--collision-benchmark") == 0) {
+            runCollisionBenchmark = true;
+        } else if (std::strcmp(argv[i], "--autopilot") == 0) {
+            autopilot = true;
+        } else if (std::strcmp(argv[i], "--headless") == 0) {
+            headless = true;
+        } else if (std::strcmp(argv[i], "--frames") == 0 && i + 1 < argc) {
+            frameLimit = std::atoi(argv[++i]);
+        } else if (std::strcmp(argv[i], "--dump-frames") == 0 && i + 1 < argc) {
+            dumpDirectory = argv[++i];
+        } else if (std::strcmp(argv[i], "--benchmark") == 0) {
+            runBenchmark = true;
+        } else if (std::strcmp(argv[i], "--benchmark-out") == 0 && i + 1 < argc) {
+            benchmarkOutput = argv[++i];
+        } else if (std::strcmp(argv[i], "--trace") == 0 && i + 1 < argc) {
+            traceOutput = argv[++i];
+        } else if (std::strcmp(argv[i], "--hitch-ms") == 0 && i + 1 < argc) {
+            hitchMilliseconds = std::atof(argv[++i]);
+            hitchRequested = true;
+        } else if (std::strcmp(argv[i], "--hitch-dir") == 0 && i + 1 < argc) {
+            hitchDirectory = argv[++i];
+        } else if (std::strcmp(argv[i], "--gl-debug") == 0) {
+            debugContext = true;
+        } else if (std::strcmp(argv[i], "--tick-rate") == 0 && i + 1 < argc) {
+            tickRate = std::atof(argv[++i]);
+        } else if (std::strcmp(argv[i], "--max-ticks") == 0 && i + 1 < argc) {
+            maxTicks = std::atoi(argv[++i]);
+        } else if (std::strcmp(argv[i], "--pacing") == 0 && i + 1 < argc) {
+            const char* value = argv[++i];
+            if (std::strcmp(value, "limit") == 0) {
+                pacingMode = FramePacer::MODE_LIMIT;
+            } else if (std::strcmp(value, "jit") == 0) {
+                pacingMode = FramePacer::MODE_JUST_IN_TIME;
+            } else {
+                pacingMode = FramePacer::MODE_UNLIMITED;
+            }
+        } else if (std::strcmp(argv[i], "--record-input") == 0 && i + 1 < argc) {
+            recordInput = argv[++i];
+        } else if (std::strcmp(argv[i], "--replay-input") == 0 && i + 1 < argc) {
+            replayInput = argv[++i];
+        } else if (std::strcmp(argv[i], "--guides") == 0 && i + 1 < argc) {
+            guideCount = std::atoi(argv[++i]);
+        } else if (std::strcmp(argv[i], "--visitors") == 0 && i + 1 < argc) {
+            visitorCount = std::atoi(argv[++i]);
+        } else if (std::strcmp(argv[i], "--fps") == 0 && i + 1 < argc) {
+            targetRate = std::atof(argv[++i]);
+        } else if (std::strcmp(argv[i], "--vsync") == 0 && i + 1 < argc) {
+            const char* value = argv[++i];
+            if (std::strcmp(value, "off") == 0) {
+                vsync = FramePacer::VSYNC_OFF;
+            } else if (std::strcmp(value, "adaptive") == 0) {
+                vsync = FramePacer::VSYNC_ADAPTIVE;
+            } else {
+                vsync = FramePacer::VSYNC_ON;
+            }
+        }
+    }
+    if (traceOutput.empty() && std::getenv("VM_TRACE")) {
+        traceOutput = std::getenv("VM_TRACE");
+    }
+    if (frameLimit <= 0) {
+        if (runBenchmark) {
+            frameLimit = BENCHMARK_DEFAULT_FRAMES;
+        } else if (headless) {
+            frameLimit = HEADLESS_DEFAULT_FRAMES;
+        }
+    }
+
+    if (runJobBenchmark) {
+        return JobSystem::runBenchmarks() ? 0 : -1;
+    }
+    if (runSimdBenchmark) {
+        return SimdKernels::runBenchmarks() ? 0 : -1;
+    }
+    if (runEcsBenchmark) {
+        return MuseumWorld::runBenchmarks() ? 0 : -1;
+    }
+    if (runNavBenchmark) {
+        return NavigationSystem::runBenchmarks() ? 0 : -1;
+    }
+    if (runCollisionBenchmark) {
+        return CollisionWorld::runBenchmarks() ? 0 : -1;
+    }
+
+    if (!traceOutput.empty()) {
+        Tracer::start(traceOutput);
+        Tracer::setThreadName("main");
+    }
+
+    // Başlangıç aşamaları ölçüm raporuna ve iz dosyasına yazılır; nullptr son aşamayı kapatır
+    if (runBenchmark) {
+        benchmark = new Benchmark();
+    }
+
+    // Ölçüm modunda diske yazım sonuçları bozacağı için kaydedici kapalıdır. Başsız çalışmada
+    // (çoğu zaman yazılım rasterizer) her kare eşiği aşabilir; orada sadece --hitch-ms ile açılır.
+    if (hitchMilliseconds > 0.0 && !runBenchmark && (!headless || hitchRequested)) {
+        flightRecorder = new FlightRecorder();
+        if (!flightRecorder->initialize(hitchDirectory, hitchMilliseconds)) {
+            delete flightRecorder;
+            flightRecorder = nullptr;
+        }
+    }
+    const char* tracePhase = nullptr;
+    uint64_t tracePhaseStart = 0;
+    auto startupPhase = [&](const char* name) {
+        if (benchmark) {
+            if (name) {
+                benchmark->beginPhase(name);
+            } else {
+                benchmark->endPhases();
+            }
+        }
+        uint64_t time = Tracer::now();
+        if (tracePhase) {
+            Tracer::recordZone(tracePhase, tracePhaseStart, time);
+        }
+        tracePhase = name;
+        tracePhaseStart = time;
+    };
+    startupPhase("jobs");
+
+    // Çalışan sayısı donanım thread sayısı kadar; ana thread de çalışan 0'dır
+    if (!JobSystem::instance().initialize()) {
+        std::cerr << "İş sistemi başlatılamadı!" << std::endl;
+    }
+    SimdKernels::initialize();
+    std::cout << "SIMD yolu: " << SimdKernels::getPathName(SimdKernels::getPath()) << std::endl;
 
     // Pencereyi oluştur
-    GLFWwindow* window = glfwCreateWindow(SCR_WIDTH, SCR_HEIGHT, "Virtual Museum", NULL, NULL);
+    startupPhase("window");
+    GLFWwindow* window = nullptr;
+    if (headless) {
+        window = createHeadlessWindow();
+    } else {
+        glfwInit();
+        setContextHints();
+        window = glfwCreateWindow(SCR_WIDTH, SCR_HEIGHT, "Virtual Museum", NULL, NULL);
+    }
     if (window == NULL) {
         std::cout << "GLFW penceresi oluşturulamadı!" << std::endl;
         glfwTerminate();
         return -1;
     }
     glfwMakeContextCurrent(window);
-    glfwSetFramebufferSizeCallback(window, framebuffer_size_callback);
+    // Viewport her kare DynamicResolution tarafından ayarlandığı için boyut geri çağrısı gerekmez
     // Mouse'u gizliyoruz ki kamera kontrolü düzgün çalışsın
     glfwSetInputMode(window, GLFW_CURSOR, GLFW_CURSOR_DISABLED);
 
 
+    startupPhase("gl_loader");
     if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress)) {
         std::cerr << "GLAD yüklenemedi!\n";
         return -1;
     }
 
+    // Ölçümde ve uçuş kaydında çizim çağrıları ve durum değişiklikleri sayılır
+    if (benchmark || flightRecorder) {
+        GLStats::install();
+    }
+    // Ölçümde ve başsız modda dikey senkron ve tempo kapatılır
+    framePacer = new FramePacer();
+    if (benchmark || headless) {
+        pacingMode = FramePacer::MODE_UNLIMITED;
+        vsync = FramePacer::VSYNC_OFF;
+    }
+    framePacer->setMode(pacingMode);
+    framePacer->setVsync(vsync);
+    framePacer->setTargetRate(targetRate);
+    GLFWmonitor* monitor = glfwGetPrimaryMonitor();
+    const GLFWvidmode* videoMode = monitor ? glfwGetVideoMode(monitor) : nullptr;
+    if (videoMode) {
+        framePacer->setRefreshRate(videoMode->refreshRate);
+    }
+    framePacer->applySwapInterval();
+
+    // Eklentileri yükle ve derlenmiş shader önbelleğini aç
+    GLExtensions::load((GLADloadproc)glfwGetProcAddress);
+    if (debugContext) {
+        GLDebugLayer::install();
+        GLStateCache::setValidation(true);
+    }
+    ProgramCache::initialize();
 
+
+    startupPhase("ui");
     uiManager = new UIManager();
     if (!uiManager->initialize(window)) {
         std::cerr << "UI Yöneticisi başlatılamadı!" << std::endl;
@@ -91,13 +389,24 @@ int main() {
     }
 
     // Depth testing  3D görüntü için
-    glEnable(GL_DEPTH_TEST);
-
-    // Shader programını yükle
-    shader = new Shader();
-    if (!shader->initialize()) {
-        std::cerr << "Shader programı başlatılamadı!" << std::endl;
-        return -1;
+    GLStateCache::enable(GL_DEPTH_TEST);
+
+    // Sahnede kullanılan tüm varyantların derlemesini hemen başlat. Sonuçlar
+    // ilk kullanıldıkları karede sorgulanır, böylece derleme model yüklemeyle örtüşür.
+    startupPhase("shader_requests");
+    shaderLibrary = new ShaderLibrary();
+    ShaderLibrary::enableParallelCompile();
+    shaderLibrary->precompile({
+        ShaderLibrary::variantKey(SHADER_FEATURE_WALL | SHADER_FEATURE_SHADOWS),
+        ShaderLibrary::variantKey(Renderer::SCENE_FEATURES | SHADER_FEATURE_SHADOWS),
+        ShaderLibrary::variantKey(Renderer::SCENE_FEATURES | SHADER_FEATURE_SHADOWS | SHADER_FEATURE_TEXTURED),
+        ShaderLibrary::variantKey(SHADER_FEATURE_DEPTH_ONLY, 1)
+    });
+    if (guideCount > 0) {
+        shaderLibrary->precompile({
+            ShaderLibrary::variantKey(Renderer::SCENE_FEATURES | SHADER_FEATURE_SHADOWS | SHADER_FEATURE_TEXTURED | SHADER_FEATURE_INSTANCED),
+            ShaderLibrary::variantKey(SHADER_FEATURE_DEPTH_ONLY | SHADER_FEATURE_INSTANCED, 1)
+        });
     }
 
     // Kamerayı oluştur - biraz yüksekten bakıyor başlangıçta
@@ -107,14 +416,13 @@ int main() {
         return -1;
     }
 
-    unsigned int shaderProgram = shader->getID();
-
     // Oda boyutları -
     float roomWidth = 3.0f;
     float roomHeight = 2.0f;
     float roomLength = 6.0f;
 
     // Heykelleri yönetecek sınıfı başlat
+    startupPhase("statues");
     statueManager = new StatueManager(STATUE_PROXIMITY_THRESHOLD, SCAN_DURATION);
     if (!statueManager->initialize(roomWidth, roomHeight, roomLength)) {
         std::cerr << "Heykel koleksiyonu oluşturulamadı!" << std::endl;
@@ -124,77 +432,444 @@ int main() {
     statues = statueManager->getStatues();
 
     // Robotu oluştup odanin girisine alma
+    startupPhase("robot");
     robot = new Robot(glm::vec3(0.0f, -1.8f, -2.0f));
     if (!robot->initialize()) {
         std::cerr << "Robot başlatılamadı!" << std::endl;
         return -1;
     }
 
+    // Heykellerin konumu, dönüşü ve sınırı varlık dünyasında; yakınlık, turlar ve ziyaretçiler
+    // buradan sorgular. Ziyaretçiler sadece orada yaşar ve robotun gövde mesh'iyle çizilir
+    museumWorld = new MuseumWorld();
+    museumWorld->initialize(statues, &robot->getMesh(), glm::vec3(roomWidth, roomHeight, roomLength));
+    statueManager->setWorld(museumWorld);
+    if (visitorCount > 0) {
+        museumWorld->spawnVisitors(visitorCount);
+        std::cout << "Ziyaretçi: " << museumWorld->getVisitorCount() << std::endl;
+    }
+    std::vector<glm::vec3> tourStops;
+    museumWorld->collectStatues(tourStops);
+
+    // Tek odalı yol haritası; heykellerin mesh üçgenleri engel olarak işlenir
+    startupPhase("navigation");
+    navigation = new NavigationSystem();
+    navigation->addRoom(glm::vec3(-roomWidth, -roomHeight, -roomLength),
+                        glm::vec3(roomWidth, -roomHeight + NAV_AGENT_HEIGHT, roomLength),
+                        NAV_CELL_SIZE, Robot::NAV_RADIUS);
+    for (Statue* statue : statues) {
+        navigation->addStatue(*statue);
+    }
+    navigation->build();
+    robot->setNavigation(navigation, tourStops);
+
+    // Çarpışma: duvarlar ve tavan ince kutular, heykellerin vekilleri mesh üçgenlerinden
+    collisionWorld = new CollisionWorld();
+    const float WALL = 0.2f;
+    collisionWorld->addBox(glm::vec3(-roomWidth - WALL, -roomHeight, -roomLength), glm::vec3(-roomWidth, roomHeight, roomLength));
+    collisionWorld->addBox(glm::vec3(roomWidth, -roomHeight, -roomLength), glm::vec3(roomWidth + WALL, roomHeight, roomLength));
+    collisionWorld->addBox(glm::vec3(-roomWidth, -roomHeight, -roomLength - WALL), glm::vec3(roomWidth, roomHeight, -roomLength));
+    collisionWorld->addBox(glm::vec3(-roomWidth, -roomHeight, roomLength), glm::vec3(roomWidth, roomHeight, roomLength + WALL));
+    collisionWorld->addBox(glm::vec3(-roomWidth, roomHeight, -roomLength), glm::vec3(roomWidth, roomHeight + WALL, roomLength));
+    for (Statue* statue : statues) {
+        collisionWorld->addStatue(*statue);
+    }
+    collisionWorld->build();
+    robot->setCollision(collisionWorld);
+    if (autopilot) {
+        robot->setAutopilot(true);
+    }
+
+    // Rehber robotlar oyuncu robotunun mesh'ini paylaşır
+    if (guideCount > 0) {
+        robotFleet = new RobotFleet();
+        if (robotFleet->initialize(&robot->getMesh(), tourStops, glm::vec3(roomWidth, roomHeight, roomLength), GUIDE_SCAN_DURATION)) {
+            robotFleet->spawn(guideCount);
+            std::cout << "Rehber filosu: " << guideCount << " robot" << std::endl;
+        } else {
+            delete robotFleet;
+            robotFleet = nullptr;
+        }
+    }
+
     // Input manager'ı başlat - klavye ve mouse kontrolü için
     inputManager = new InputManager(window, robot, camera, statueManager);
     inputManager->setupCallbacks();
 
+    // Spot ve yönlü ışıklar; gölge atlası tüm odayı kapsar
+    startupPhase("lighting");
+    lightingSystem = new LightingSystem();
+    if (!lightingSystem->initialize(*shaderLibrary)) {
+        std::cerr << "Işık sistemi başlatılamadı!" << std::endl;
+        return -1;
+    }
+    if (!lightingSystem->initializeShadows(glm::vec3(0.0f), glm::length(glm::vec3(roomWidth, roomHeight, roomLength)))) {
+        std::cerr << "Gölge atlası oluşturulamadı, gölgeler kapalı." << std::endl;
+    }
+
     // Renderer'ı başlat
+    startupPhase("renderer");
     renderer = new Renderer();
-    if (!renderer->initialize(roomWidth, roomHeight, roomLength)) {
+    if (!renderer->initialize(roomWidth, roomHeight, roomLength, shaderLibrary, lightingSystem)) {
         std::cerr << "Renderer başlatılamadı!" << std::endl;
         return -1;
     }
+    inputManager->setRenderer(renderer);
+    inputManager->setFramePacer(framePacer);
+    inputManager->setMovementEnabled(!benchmark);
+    if (!replayInput.empty()) {
+        inputManager->startReplay(replayInput);
+    }
+    if (!recordInput.empty()) {
+        inputManager->startRecording(recordInput);
+    }
 
     // Odayı oluştur
+    startupPhase("room");
     Room* room = new Room(roomWidth, roomHeight, roomLength);
     if (!room->initialize()) {
         std::cerr << "Oda başlatılamadı!" << std::endl;
         return -1;
     }
 
-    // Ana döngü - ESC'ye basana kadar çalışır
-    while (!glfwWindowShouldClose(window)) {
-
-        float currentFrame = glfwGetTime();
-        deltaTime = currentFrame - lastFrame;
-        lastFrame = currentFrame;
+    // Kare süresi hedefi aşılırsa sahne daha düşük çözünürlükte çizilir
+    startupPhase("render_targets");
+    int framebufferWidth, framebufferHeight;
+    glfwGetFramebufferSize(window, &framebufferWidth, &framebufferHeight);
+    dynamicResolution = new DynamicResolution();
+    if (!dynamicResolution->initialize(framebufferWidth, framebufferHeight, *shaderLibrary)) {
+        std::cerr << "Sahne hedefi oluşturulamadı!" << std::endl;
+        return -1;
+    }
 
-        // Input'ları kontrol et
-        if (inputManager) {
-            inputManager->processInput(deltaTime);
+    // Gizli pencerenin framebuffer'ı okunamaz; son görüntü kendi hedefimize çizilir
+    if (headless) {
+        frameCapture = new FrameCapture();
+        if (!frameCapture->initialize(framebufferWidth, framebufferHeight)) {
+            return -1;
         }
+        dynamicResolution->setOutputFramebuffer(frameCapture->getFramebuffer());
+
+        if (!dumpDirectory.empty()) {
+            std::error_code error;
+            std::filesystem::create_directories(dumpDirectory, error);
+            if (error) {
+                std::cerr << "Kare klasörü oluşturulamadı: " << dumpDirectory << std::endl;
+                dumpDirectory.clear();
+            }
+        }
+    }
 
-        // Robot heykele yakın mı kontrol
-        if (statueManager && robot) {
-            statueManager->updateStatueProximity(robot);
-            statueManager->updateScanning(deltaTime);
+    // Ölçüm sırasında çözünürlük sabit kalmalı, yoksa iş miktarı kareden kareye değişir
+    if (benchmark) {
+        dynamicResolution->setEnabled(false);
+    }
+    startupPhase(nullptr);
+
+    ProgramCache::logStats();
+
+    // Bir karenin tüm GL çizimi; paket ister bu thread'de ister render thread'de çizilir
+    int capturedFrames = 0;
+    auto renderFrame = [&](const FramePacket& packet) {
+        GLStats::reset();
+        Profiler::instance().beginGpuFrame();
+
+        // Gölge atlası sadece bir şey değiştiyse yeniden çizilir
+        if (robotFleet) {
+            robotFleet->upload(packet.fleet);
+        }
+        museumWorld->uploadVisitors(packet.visitors);
+        {
+            VM_PROFILE_GPU_ZONE("shadows");
+            lightingSystem->updateShadows(statues, robot, *shaderLibrary, robotFleet);
         }
 
+        // Sahne ölçekli offscreen hedefe çizilir
+        dynamicResolution->beginScene(packet.framebufferWidth, packet.framebufferHeight);
+
         // Ekranı temizlemek için
         glClearColor(0.1f, 0.1f, 0.1f, 1.0f);  // Koyu gri arka plan
         glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
-        // UI'ı hazırla
-        uiManager->newFrame();
+        //  oda, heykeller, robot çizmek icin
+        {
+            VM_PROFILE_GPU_ZONE("room");
+            room->render(packet.view, packet.projection, *shaderLibrary, lightingSystem);
+        }
+        {
+            VM_PROFILE_GPU_ZONE("scene");
+            renderer->renderScene(statues, robot, packet.cameraPosition, packet.view, packet.projection,
+                                  packet.robotPopupVisible, robotFleet,
+                                  museumWorld);
+        }
 
-        // Kamera hesaplamaları
-        glm::mat4 projection = camera->getProjectionMatrix((float)SCR_WIDTH/SCR_HEIGHT);
-        glm::mat4 view = camera->getViewMatrix();
+        // Sahneyi pencereye büyüt, arayüzü tam çözünürlükte üstüne çiz
+        {
+            VM_PROFILE_GPU_ZONE("present");
+            dynamicResolution->endScene();
+            dynamicResolution->present();
+        }
+        Tracer::recordCounter("render_scale", dynamicResolution->getScale());
+        if (packet.drawData) {
+            VM_PROFILE_GPU_ZONE("ui_render");
+            uiManager->renderDrawData(packet.drawData);
+        }
 
-        //  oda, heykeller, robot çizmek icin
-        room->render(view, projection, shader->getID());
-        renderer->renderScene(window, statues, robot, uiManager,
-                              camera->getPosition(), view, projection,
-                              statueManager->getActiveStatueIndex(),
-                              statueManager->shouldShowInfoPanel(),
-                              statueManager->isScanning(),
-                              statueManager->getScanProgress(),
-                              statueManager->getScanDuration());
-
-        // ekran senkronizasyonu için
-        glfwSwapBuffers(window);
+        if (frameCapture && !dumpDirectory.empty()) {
+            char fileName[32];
+            std::snprintf(fileName, sizeof(fileName), "/frame_%05d.png", capturedFrames++);
+            frameCapture->capture(dumpDirectory + fileName);
+        }
+
+        // Kare süresi GPU işini de kapsasın diye ölçümde kare bitene kadar beklenir
+        if (benchmark) {
+            glFinish();
+            benchmark->recordRenderStats(GLStats::get());
+        }
+        if (flightRecorder) {
+            flightRecorder->recordRenderStats(GLStats::get());
+        }
+        GLStateCache::validate("frame");
+        GLDebugLayer::endFrame();
+
+        // Panelden değiştirilen vsync bağlamın bulunduğu thread'de uygulanır
+        framePacer->applySwapInterval();
+        framePacer->frameSubmitted(packet.inputTime);
+    };
+    auto presentFrame = [&](const FramePacket& packet) {
+        framePacer->framePresented(packet.inputTime);
+    };
+
+    // Bağlam render thread'e geçer; bundan sonra bu thread GL çağrısı yapmaz
+    if (useRenderThread) {
+        renderThread = new RenderThread();
+        if (!renderThread->start(window, renderFrame, presentFrame)) {
+            delete renderThread;
+            renderThread = nullptr;
+        }
+    }
+    FramePacket localPacket;
+    FixedTimestep timestep(tickRate, maxTicks);
+    lastFrame = glfwGetTime();
+
+    // Ana döngü - ESC'ye basana ya da kare sınırına ulaşana kadar çalışır
+    int frameCount = 0;
+    while (!glfwWindowShouldClose(window) && (frameLimit <= 0 || frameCount < frameLimit)) {
+
+        // Tempo beklemesi olaylar okunmadan önce yapılır ki input mümkün olan en geç anda örneklensin
+        framePacer->waitForFrame();
+        auto frameStart = std::chrono::steady_clock::now();
         glfwPollEvents();
+
+        // Callback'ler olayları okundukları anla damgalar; örnekleme anı okumadan sonra alınır
+        // ki bu karede gelen her olay bu karenin adımlarında tüketilsin
+        double inputTime = FramePacer::now();
+
+        // Önceki karenin bölgeleri istatistiklere işlenir
+        Profiler::instance().beginFrame();
+        if (flightRecorder) {
+            flightRecorder->beginFrame();
+        }
+
+        // Başsız ve ölçüm modunda sonuç tekrarlanabilir olsun diye her kareye tam bir adım düşer
+        double currentFrame = glfwGetTime();
+        double frameSeconds = (headless || benchmark) ? timestep.getStep() : currentFrame - lastFrame;
+        deltaTime = static_cast<float>(frameSeconds);
+        lastFrame = currentFrame;
+
+        // Simülasyon sabit adımlarla ilerler; kare hızı ne olursa olsun aynı sonucu verir
+        int ticks = timestep.advance(frameSeconds);
+        float step = static_cast<float>(timestep.getStep());
+        for (int tick = 0; tick < ticks; tick++) {
+            robot->beginTick();
+            if (robotFleet) {
+                robotFleet->beginTick();
+            }
+
+            // Bu adıma düşen input olayları işlenir; adımlar geriye doğru gerçek zamana yayılır,
+            // son adım input'un örneklendiği ana karşılık gelir. Ölçümde robotu senaryo sürer.
+            {
+                VM_PROFILE_ZONE("input");
+                double tickTime = inputTime - (ticks - 1 - tick) * timestep.getStep();
+                inputManager->processTick(step, tickTime);
+                if (benchmark) {
+                    int tickIndex = static_cast<int>(timestep.getTickCount() - ticks + tick);
+                    benchmark->driveRobot(tickIndex, step, robot, camera);
+                }
+            }
+
+            // Otomatik turda robot planlanan rotayı izler
+            {
+                VM_PROFILE_ZONE("autopilot");
+                robot->updateAutopilot(step);
+            }
+
+            // Robot heykele yakın mı kontrol
+            if (statueManager) {
+                {
+                    VM_PROFILE_ZONE("proximity");
+                    statueManager->updateStatueProximity(robot);
+                }
+                VM_PROFILE_ZONE("scanning");
+                statueManager->updateScanning(step);
+            }
+
+            // Rehber robotlar iş sistemine dağıtılır
+            if (robotFleet) {
+                VM_PROFILE_ZONE("fleet");
+                robotFleet->update(step);
+            }
+
+            // Ziyaretçiler parça parça güncellenir
+            if (visitorCount > 0) {
+                VM_PROFILE_ZONE("world");
+                museumWorld->updateVisitors(step);
+            }
+        }
+        Tracer::recordCounter("sim_ticks", ticks);
+
+        // Çizim son iki adımın arasından yapılır; kamera da çizilen pozu takip eder
+        robot->applyInterpolation(timestep.getAlpha());
+        if (robotFleet) {
+            VM_PROFILE_ZONE("fleet_pose");
+            robotFleet->applyInterpolation(timestep.getAlpha());
+            Tracer::recordCounter("fleet_scanning", robotFleet->getScanningCount());
+        }
+        if (visitorCount > 0) {
+            Tracer::recordCounter("visitors_viewing", museumWorld->getViewingCount());
+        }
+        camera->updateCameraWithRobot(robot->getRenderPosition(), robot->getRenderRotation());
+
+        // Bu karede değişen transformların matrislerini bir kerede hesapla
+        TransformSystem::instance().update();
+
+        // Pencere küçültüldüyse çizecek bir şey yok
+        int framebufferWidth, framebufferHeight;
+        glfwGetFramebufferSize(window, &framebufferWidth, &framebufferHeight);
+        if (framebufferWidth == 0 || framebufferHeight == 0) {
+            // Çekirdeği boşa döndürmemek için pencere geri açılana kadar olay beklenir
+            glfwWaitEvents();
+            continue;
+        }
+
+        // Render thread bir önceki kareyi çizerken bu kare için paket hazırlanır
+        FramePacket& packet = renderThread ? renderThread->acquirePacket() : localPacket;
+        packet.framebufferWidth = framebufferWidth;
+        packet.framebufferHeight = framebufferHeight;
+        packet.inputTime = inputTime;
+        if (robotFleet) {
+            robotFleet->captureInstances(packet.fleet);
+        }
+        if (visitorCount > 0) {
+            VM_PROFILE_ZONE("visitor_pose");
+            museumWorld->captureVisitors(packet.visitors);
+        }
+
+        // Kamera hesaplamaları - en boy oranı gerçek framebuffer'dan
+        packet.projection = camera->getProjectionMatrix((float)framebufferWidth / framebufferHeight);
+        packet.view = camera->getViewMatrix();
+        packet.cameraPosition = camera->getPosition();
+        packet.robotPopupVisible = robot->isShowingPopup();
+
+        // UI'ı hazırla
+        {
+            VM_PROFILE_ZONE("ui");
+            uiManager->newFrame();
+            renderer->renderUI(window, statues, uiManager, packet.view, packet.projection,
+                               statueManager->getActiveStatueIndex(),
+                               statueManager->shouldShowInfoPanel(),
+                               statueManager->isScanning(),
+                               statueManager->getScanProgress(),
+                               statueManager->getScanDuration());
+            Profiler::instance().renderOverlay();
+            GLDebugLayer::renderPanel();
+            framePacer->renderPanel();
+        }
+
+        if (renderThread) {
+            // Render thread canlı verilere dokunmaz; matrisler ve arayüz pakete kopyalanır
+            TransformSystem::instance().captureSnapshot(packet.transforms);
+            packet.copyDrawData(uiManager->endFrame());
+            renderThread->submitPacket();
+        } else {
+            packet.drawData = uiManager->endFrame();
+            renderFrame(packet);
+
+            // ekran senkronizasyonu için
+            {
+                VM_PROFILE_ZONE("swap");
+                glfwSwapBuffers(window);
+            }
+            presentFrame(packet);
+        }
+        frameCount++;
+
+        double frameMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - frameStart).count();
+        Tracer::recordCounter("frame_ms", frameMilliseconds);
+        if (benchmark) {
+            benchmark->recordFrame(frameMilliseconds);
+        }
+        if (flightRecorder) {
+            FlightRecorder::FrameSample sample;
+            sample.milliseconds = frameMilliseconds;
+            sample.deltaTime = deltaTime;
+            sample.robotPosition = robot->getPosition();
+            sample.activeStatue = statueManager->getActiveStatueIndex();
+            sample.scanning = statueManager->isScanning();
+            sample.heldKeys = inputManager->getHeldKeys();
+            sample.inputEvents = inputManager->takeEventCount();
+            flightRecorder->endFrame(sample);
+        }
+    }
+
+    // GL nesneleri silinmeden önce bağlam bu thread'e geri alınır
+    if (renderThread) {
+        renderThread->stop();
+        delete renderThread;
+        renderThread = nullptr;
+    }
+    Profiler::instance().cleanup();
+    GLDebugLayer::logReport();
+
+    if (benchmark) {
+        benchmark->writeReport(benchmarkOutput);
+        delete benchmark;
+        benchmark = nullptr;
+    }
+
+    // Sürmekte olan bir takılma yazımı bitene kadar beklenir
+    if (flightRecorder) {
+        delete flightRecorder;
+        flightRecorder = nullptr;
     }
 
-    // Hafızayı temizle kodu dolmasın diye
+    if (framePacer) {
+        delete framePacer;
+        framePacer = nullptr;
+    }
+
+    if (museumWorld) {
+        delete museumWorld;
+        museumWorld = nullptr;
+    }
+
+    // Hafızayı temizle kodu dolmasın diye; filo robotun mesh'ini kullandığı için önce silinir
+    if (robotFleet) {
+        delete robotFleet;
+        robotFleet = nullptr;
+    }
     delete robot;
 
+    if (navigation) {
+        delete navigation;
+        navigation = nullptr;
+    }
+
+    if (collisionWorld) {
+        delete collisionWorld;
+        collisionWorld = nullptr;
+    }
+
     if (statueManager) {
         delete statueManager;
         statueManager = nullptr;
@@ -217,9 +892,24 @@ int main() {
         renderer = nullptr;
     }
 
-    if (shader) {
-        delete shader;
-        shader = nullptr;
+    if (frameCapture) {
+        delete frameCapture;
+        frameCapture = nullptr;
+    }
+
+    if (dynamicResolution) {
+        delete dynamicResolution;
+        dynamicResolution = nullptr;
+    }
+
+    if (lightingSystem) {
+        delete lightingSystem;
+        lightingSystem = nullptr;
+    }
+
+    if (shaderLibrary) {
+        delete shaderLibrary;
+        shaderLibrary = nullptr;
     }
 
     if (camera) {
@@ -232,6 +922,11 @@ int main() {
         inputManager = nullptr;
     }
 
+    JobSystem::instance().shutdown();
+
+    // Tüm thread'ler durduktan sonra yarım kalan iz blokları da yazılır
+    Tracer::stop();
+
     glfwTerminate();
     return 0;
 }